@@ -0,0 +1,39 @@
+// Calls a trivial add(i32, i32) 100M times.
+//
+// Through the symbol bun:ffi returns, the DFG/FTL calls the unboxed DOMJIT
+// stub once the loop is compiled. Calling the native function without `this`
+// fails DOMJIT's `this` check, so every call goes through the generic host
+// call instead.
+import { dlopen } from "bun:ffi";
+import { ffiFastCallCount } from "bun:jsc";
+
+const { symbols } = dlopen(import.meta.dir + "/src/ffi_napi_bench.node", {
+  ffi_add: { args: ["i32", "i32"], returns: "i32" },
+});
+
+const iterations = Number(process.env.ITERATIONS ?? 100_000_000);
+
+function time(label, fn) {
+  const fastCalls = ffiFastCallCount();
+  const start = performance.now();
+  const result = fn();
+  const elapsed = performance.now() - start;
+  console.log(
+    `${label}: ${elapsed.toFixed(0)}ms (${((elapsed * 1e6) / iterations).toFixed(2)}ns/call) [${result}], ` +
+      `${ffiFastCallCount() - fastCalls} unboxed calls`,
+  );
+}
+
+const add = symbols.ffi_add;
+time("ffi_add(i, 1)", () => {
+  let sum = 0;
+  for (let i = 0; i < iterations; i++) sum = add(sum, 1);
+  return sum;
+});
+
+const generic = symbols.ffi_add.native;
+time("ffi_add.native(i, 1), no this", () => {
+  let sum = 0;
+  for (let i = 0; i < iterations; i++) sum = generic(sum, 1);
+  return sum;
+});
@@ -46,4 +46,9 @@ fn hash(buf: &[u8]) -> u32 {
 
 #[no_mangle] unsafe extern "C" fn ffi_hash(ptr: *const u8, length: u32) -> u32 {
   return hash(std::slice::from_raw_parts(ptr, length as usize));
-}
\ No newline at end of file
+}
+
+
+#[no_mangle] unsafe extern "C" fn ffi_add(a: i32, b: i32) -> i32 {
+  return a.wrapping_add(b);
+}
@@ -0,0 +1,14 @@
+const { run } = require(import.meta.dir + "/src/build/Release/tsfn_bench.node");
+
+const threads = 8;
+const callsPerThread = Number(process.env.CALLS ?? 250_000);
+
+const start = performance.now();
+run(threads, callsPerThread, count => {
+  const elapsed = performance.now() - start;
+  console.log(
+    `${count} calls from ${threads} threads in ${elapsed.toFixed(1)}ms (${Math.round(
+      (count / elapsed) * 1000,
+    ).toLocaleString()} calls/sec)`,
+  );
+});
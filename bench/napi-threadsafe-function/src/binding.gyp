@@ -0,0 +1,8 @@
+{
+  "targets": [
+    {
+      "target_name": "tsfn_bench",
+      "sources": ["tsfn_bench.c"]
+    }
+  ]
+}
@@ -0,0 +1,83 @@
+// Measures how fast napi_call_threadsafe_function() calls from several
+// producer threads reach JavaScript.
+//
+//   run(threads, callsPerThread, done) -> calls done(callCount) once every
+//   call has been delivered.
+
+#include <node_api.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+  napi_threadsafe_function tsfn;
+  napi_ref done;
+  uint64_t expected;
+  uint64_t received;
+  uint32_t calls_per_thread;
+  uint32_t thread_count;
+  pthread_t *threads;
+} Run;
+
+static void call_js(napi_env env, napi_value js_callback, void *context, void *data) {
+  (void)js_callback;
+  (void)data;
+  Run *run = context;
+  if (env == NULL || ++run->received != run->expected) return;
+
+  napi_value done, global, count;
+  napi_get_reference_value(env, run->done, &done);
+  napi_get_global(env, &global);
+  napi_create_double(env, (double)run->received, &count);
+  napi_call_function(env, global, done, 1, &count, NULL);
+
+  for (uint32_t i = 0; i < run->thread_count; i++) pthread_join(run->threads[i], NULL);
+  napi_delete_reference(env, run->done);
+  napi_release_threadsafe_function(run->tsfn, napi_tsfn_release);
+}
+
+static void finalize(napi_env env, void *data, void *hint) {
+  (void)env;
+  (void)hint;
+  Run *run = data;
+  free(run->threads);
+  free(run);
+}
+
+static void *produce(void *arg) {
+  Run *run = arg;
+  // The creating thread's reference keeps the function alive until call_js
+  // has seen every call, so producers don't acquire their own.
+  for (uint32_t i = 0; i < run->calls_per_thread; i++) {
+    napi_call_threadsafe_function(run->tsfn, NULL, napi_tsfn_blocking);
+  }
+  return NULL;
+}
+
+static napi_value run(napi_env env, napi_callback_info info) {
+  size_t argc = 3;
+  napi_value argv[3], name;
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+  Run *run = calloc(1, sizeof(Run));
+  napi_get_value_uint32(env, argv[0], &run->thread_count);
+  napi_get_value_uint32(env, argv[1], &run->calls_per_thread);
+  napi_create_reference(env, argv[2], 1, &run->done);
+  run->expected = (uint64_t)run->thread_count * run->calls_per_thread;
+  run->threads = calloc(run->thread_count, sizeof(pthread_t));
+
+  napi_create_string_utf8(env, "tsfn_bench", NAPI_AUTO_LENGTH, &name);
+  napi_create_threadsafe_function(env, NULL, NULL, name, 0, 1, run, finalize, run, call_js, &run->tsfn);
+
+  for (uint32_t i = 0; i < run->thread_count; i++) {
+    pthread_create(&run->threads[i], NULL, produce, run);
+  }
+  return NULL;
+}
+
+NAPI_MODULE_INIT() {
+  napi_value fn;
+  napi_create_function(env, "run", NAPI_AUTO_LENGTH, run, NULL, &fn);
+  napi_set_named_property(env, exports, "run", fn);
+  return exports;
+}
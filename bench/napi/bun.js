@@ -0,0 +1,17 @@
+import { run, bench, group } from "mitata";
+
+const { Wrapped, rewrap, referenceChurn } = require(import.meta.dir + "/src/build/Release/napi_bench.node");
+
+const wrapped = new Wrapped(42);
+
+group("napi_wrap", () => {
+  bench("new Wrapped()", () => new Wrapped(1));
+  bench("unwrap", () => wrapped.value());
+  bench("remove_wrap + wrap", () => rewrap(wrapped));
+});
+
+group("napi_ref", () => {
+  bench("create + delete reference x1000", () => referenceChurn(wrapped, 1000));
+});
+
+await run();
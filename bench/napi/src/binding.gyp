@@ -0,0 +1,8 @@
+{
+  "targets": [
+    {
+      "target_name": "napi_bench",
+      "sources": ["napi_bench.c"]
+    }
+  ]
+}
@@ -0,0 +1,78 @@
+// Exercises the napi_wrap() and napi_ref paths that object-heavy addons hit.
+//
+//   new Wrapped(n)           wraps a malloc'd counter
+//   wrapped.value()          napi_unwrap()
+//   rewrap(wrapped)          napi_remove_wrap() + napi_wrap()
+//   referenceChurn(obj, n)   n x napi_create_reference() + napi_delete_reference()
+
+#include <node_api.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+static void finalize_counter(napi_env env, void *data, void *hint) {
+  (void)env;
+  (void)hint;
+  free(data);
+}
+
+static napi_value wrapped_constructor(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv[1], this_value;
+  napi_get_cb_info(env, info, &argc, argv, &this_value, NULL);
+
+  int64_t *counter = malloc(sizeof(int64_t));
+  napi_get_value_int64(env, argv[0], counter);
+  napi_wrap(env, this_value, counter, finalize_counter, NULL, NULL);
+  return this_value;
+}
+
+static napi_value wrapped_value(napi_env env, napi_callback_info info) {
+  napi_value this_value, result;
+  napi_get_cb_info(env, info, NULL, NULL, &this_value, NULL);
+
+  int64_t *counter = NULL;
+  napi_unwrap(env, this_value, (void **)&counter);
+  napi_create_int64(env, counter ? *counter : -1, &result);
+  return result;
+}
+
+static napi_value rewrap(napi_env env, napi_callback_info info) {
+  size_t argc = 1;
+  napi_value argv[1];
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+
+  void *counter = NULL;
+  napi_remove_wrap(env, argv[0], &counter);
+  napi_wrap(env, argv[0], counter, finalize_counter, NULL, NULL);
+  return NULL;
+}
+
+static napi_value reference_churn(napi_env env, napi_callback_info info) {
+  size_t argc = 2;
+  napi_value argv[2];
+  uint32_t count = 0;
+  napi_get_cb_info(env, info, &argc, argv, NULL, NULL);
+  napi_get_value_uint32(env, argv[1], &count);
+
+  for (uint32_t i = 0; i < count; i++) {
+    napi_ref ref;
+    napi_create_reference(env, argv[0], 1, &ref);
+    napi_delete_reference(env, ref);
+  }
+  return NULL;
+}
+
+NAPI_MODULE_INIT() {
+  napi_property_descriptor methods[] = {
+      {"value", NULL, wrapped_value, NULL, NULL, NULL, napi_default, NULL},
+  };
+  napi_value wrapped, fn;
+  napi_define_class(env, "Wrapped", NAPI_AUTO_LENGTH, wrapped_constructor, NULL, 1, methods, &wrapped);
+  napi_set_named_property(env, exports, "Wrapped", wrapped);
+
+  napi_create_function(env, "rewrap", NAPI_AUTO_LENGTH, rewrap, NULL, &fn);
+  napi_set_named_property(env, exports, "rewrap", fn);
+  napi_create_function(env, "referenceChurn", NAPI_AUTO_LENGTH, reference_churn, NULL, &fn);
+  napi_set_named_property(env, exports, "referenceChurn", fn);
+  return exports;
+}
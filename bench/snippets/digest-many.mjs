@@ -0,0 +1,18 @@
+// so it can run in environments without node module resolution
+import { bench, run } from "./runner.mjs";
+
+const { subtle } = globalThis.crypto;
+
+const objects = Array.from({ length: 20_000 }, (_, i) => new TextEncoder().encode(`content-addressed object ${i}`.repeat(8)));
+
+bench("subtle.digest() x 20k", async () => {
+  await Promise.all(objects.map(object => subtle.digest("SHA-256", object)));
+});
+
+if (typeof subtle.digestMany === "function") {
+  bench("subtle.digestMany() x 20k", async () => {
+    await subtle.digestMany("SHA-256", objects);
+  });
+}
+
+await run();
@@ -0,0 +1,38 @@
+// Cost of matching a specifier against onResolve filters as more plugins
+// are registered. Each namespace gets `count` plugins; only the last one
+// matches, so every filter before it has to be ruled out.
+import { bench, group, run } from "./runner.mjs";
+
+function register(namespace, count, filterFor) {
+  Bun.plugin({
+    name: `${namespace} filters`,
+    setup(builder) {
+      for (let i = 0; i < count - 1; i++) {
+        builder.onResolve({ filter: filterFor(i), namespace }, () => {
+          throw new Error("unreachable");
+        });
+      }
+      builder.onResolve({ filter: /\.txt$/, namespace }, () => ({ path: import.meta.path }));
+    },
+  });
+}
+
+for (const count of [1, 10, 50]) {
+  // Extension filters, e.g. /\.ext3$/
+  register(`ext${count}`, count, i => new RegExp(`\\.ext${i}$`));
+  // Filters that have to run as regular expressions, e.g. /^ext3\b/
+  register(`regex${count}`, count, i => new RegExp(`^ext${i}\\b`));
+}
+
+for (const kind of ["ext", "regex"]) {
+  group(`${kind} filters`, () => {
+    for (const count of [1, 10, 50]) {
+      const specifier = `${kind}${count}:file.txt`;
+      bench(`${count} plugins`, () => {
+        import.meta.resolveSync(specifier);
+      });
+    }
+  });
+}
+
+await run();
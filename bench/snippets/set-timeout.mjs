@@ -11,6 +11,36 @@ bench("setTimeout(, 4) 100 times", async () => {
   }
 });
 
+function noop() {}
+
+// Request/idle timeouts are mostly cancelled before they fire
+bench("setTimeout + clearTimeout 1M times", () => {
+  for (let i = 0; i < 1_000_000; i++) {
+    clearTimeout(setTimeout(noop, 30_000));
+  }
+});
+
+bench("1M pending setTimeout, then clearTimeout all", () => {
+  const timers = new Array(1_000_000);
+  for (let i = 0; i < timers.length; i++) {
+    timers[i] = setTimeout(noop, 1000 + (i % 1000));
+  }
+  for (let i = 0; i < timers.length; i++) {
+    clearTimeout(timers[i]);
+  }
+});
+
+bench("100k setTimeout with the same deadline", async () => {
+  let remaining = 100_000;
+  await new Promise(resolve => {
+    for (let i = 0; i < 100_000; i++) {
+      setTimeout(() => {
+        if (--remaining === 0) resolve();
+      }, 1);
+    }
+  });
+});
+
 setTimeout(() => {
   run({}).then(() => {});
 }, 1);
@@ -0,0 +1,22 @@
+// so it can run in environments without node module resolution
+import { bench, run } from "./runner.mjs";
+
+const { subtle } = globalThis.crypto;
+
+const sizes = [1024, 1024 * 1024, 16 * 1024 * 1024];
+const key = await subtle.generateKey({ name: "AES-GCM", length: 256 }, false, ["encrypt", "decrypt"]);
+const iv = new Uint8Array(12);
+
+for (const size of sizes) {
+  const data = new Uint8Array(size).fill(42);
+
+  bench(`subtle.digest("SHA-256", ${size} bytes)`, async () => {
+    await subtle.digest("SHA-256", data);
+  });
+
+  bench(`subtle.encrypt("AES-GCM", ${size} bytes)`, async () => {
+    await subtle.encrypt({ name: "AES-GCM", iv }, key, data);
+  });
+}
+
+await run();
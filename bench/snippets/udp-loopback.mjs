@@ -0,0 +1,35 @@
+// node:dgram packets per second over loopback, sending small datagrams the
+// way a metrics client would (many sends per tick). Run it with node as well
+// as bun to compare.
+import dgram from "node:dgram";
+
+const total = 500_000;
+const batch = 256;
+const payload = Buffer.from("requests.completed:1|c|#route:/api/v1/items");
+
+const server = dgram.createSocket("udp4");
+const client = dgram.createSocket("udp4");
+server.bind(0, "127.0.0.1");
+await new Promise(resolve => server.once("listening", resolve));
+const { port } = server.address();
+
+let received = 0;
+server.on("message", () => received++);
+
+const start = performance.now();
+let sent = 0;
+await new Promise(resolve => {
+  function sendBatch() {
+    for (let i = 0; i < batch && sent < total; i++, sent++) client.send(payload, port, "127.0.0.1");
+    if (sent < total) setImmediate(sendBatch);
+    else client.send(payload, port, "127.0.0.1", () => setTimeout(resolve, 100));
+  }
+  sendBatch();
+});
+const elapsed = (performance.now() - start) / 1000;
+
+console.log(`sent     ${((sent + 1) / elapsed) | 0} packets/s`);
+console.log(`received ${(received / elapsed) | 0} packets/s (${((received / (sent + 1)) * 100).toFixed(1)}% delivered)`);
+
+client.close();
+server.close();
@@ -0,0 +1,40 @@
+// node:zlib throughput for the sync helpers and for a createGzip() stream fed
+// in 64 KB chunks, the way a log shipper would. Run it with node as well as
+// bun to compare against Node's native zlib; `bun.gzipSync` is the lower bound.
+import { bench, group, run } from "./runner.mjs";
+import * as zlib from "node:zlib";
+
+const line = '{"level":"info","msg":"request completed","status":200,"path":"/api/v1/items","duration_ms":12}\n';
+const input = Buffer.from(line.repeat(Math.ceil((4 * 1024 * 1024) / line.length)));
+const chunkSize = 64 * 1024;
+const gzipped = zlib.gzipSync(input);
+
+group(`gzip ${(input.length / 1024 / 1024) | 0} MB`, () => {
+  bench("zlib.gzipSync", () => zlib.gzipSync(input));
+  if (typeof Bun !== "undefined") {
+    bench("Bun.gzipSync", () => Bun.gzipSync(input));
+  }
+  bench("zlib.createGzip() stream", () => compressStream(zlib.createGzip()));
+});
+
+group(`gunzip ${(input.length / 1024 / 1024) | 0} MB`, () => {
+  bench("zlib.gunzipSync", () => zlib.gunzipSync(gzipped));
+  if (typeof Bun !== "undefined") {
+    bench("Bun.gunzipSync", () => Bun.gunzipSync(gzipped));
+  }
+});
+
+function compressStream(stream) {
+  return new Promise((resolve, reject) => {
+    let length = 0;
+    stream.on("data", chunk => (length += chunk.length));
+    stream.on("end", () => resolve(length));
+    stream.on("error", reject);
+    for (let offset = 0; offset < input.length; offset += chunkSize) {
+      stream.write(input.subarray(offset, offset + chunkSize));
+    }
+    stream.end();
+  });
+}
+
+await run();
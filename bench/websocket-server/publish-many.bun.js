@@ -0,0 +1,76 @@
+// Compares server.publish() in a loop against a single server.publishMany()
+// when fanning out small updates to many distinct topics.
+//
+//   bun ./publish-many.bun.js
+//
+// SUBSCRIBERS and TOPICS can be set through the environment.
+const SUBSCRIBERS = parseInt(process.env.SUBSCRIBERS || "", 10) || 10_000;
+const TOPICS = parseInt(process.env.TOPICS || "", 10) || 1_000;
+const ROUNDS = parseInt(process.env.ROUNDS || "", 10) || 50;
+
+const topics = Array.from({ length: TOPICS }, (_, i) => `room:${i}`);
+let nextSubscriber = 0;
+
+const server = Bun.serve({
+  port: 0,
+  websocket: {
+    open(ws) {
+      ws.subscribe(topics[nextSubscriber++ % TOPICS]);
+    },
+    message() {},
+    perMessageDeflate: false,
+  },
+  fetch(req, server) {
+    if (server.upgrade(req)) return;
+    return new Response("Error");
+  },
+});
+
+const url = `ws://${server.hostname}:${server.port}`;
+let opened = 0;
+let received = 0;
+const clients = [];
+await new Promise(resolve => {
+  for (let i = 0; i < SUBSCRIBERS; i++) {
+    const ws = new WebSocket(url);
+    ws.onopen = () => {
+      if (++opened === SUBSCRIBERS) resolve();
+    };
+    ws.onmessage = () => {
+      received++;
+    };
+    clients.push(ws);
+  }
+});
+
+async function waitFor(expected) {
+  while (received < expected) await Bun.sleep(1);
+}
+
+async function run(label, publishRound) {
+  received = 0;
+  const start = Bun.nanoseconds();
+  for (let round = 0; round < ROUNDS; round++) {
+    publishRound(`tick ${round}`);
+  }
+  const published = Bun.nanoseconds();
+  await waitFor(SUBSCRIBERS * ROUNDS);
+  const end = Bun.nanoseconds();
+  console.log(
+    `${label.padEnd(12)} publish: ${((published - start) / 1e6).toFixed(2)}ms, delivered ${received} messages in ${(
+      (end - start) /
+      1e6
+    ).toFixed(2)}ms`,
+  );
+}
+
+await run("publish()", message => {
+  for (const topic of topics) server.publish(topic, message);
+});
+
+await run("publishMany()", message => {
+  server.publishMany(topics.map(topic => [topic, message]));
+});
+
+for (const ws of clients) ws.close();
+server.stop(true);
@@ -1834,6 +1834,54 @@ declare module "bun" {
      */
     development?: boolean;
 
+    /**
+     * Set `SO_REUSEPORT` on the listening socket, so that several processes
+     * can listen on the same {@link port} and the kernel load-balances
+     * incoming connections between them.
+     *
+     * Set to `false` to fail with an error when the port is already in use.
+     *
+     * @default true
+     */
+    reusePort?: boolean;
+
+    /**
+     * Listen from this many threads. The main thread starts `workers - 1`
+     * threads, each running the entry point in its own VM, and their
+     * `Bun.serve` calls listen on the same {@link port}. Calling `stop()`
+     * on the main thread's server terminates them.
+     *
+     * Requires {@link reusePort}.
+     *
+     * @default 1
+     */
+    workers?: number;
+
+    /**
+     * Responses served for exact paths without calling {@link fetch}.
+     *
+     * Each `Response` is read once when the server starts. Requests for these
+     * paths are answered from native code, so they stay fast even while
+     * JavaScript is busy. `GET` and `HEAD` are supported, and an `ETag` is
+     * added to `200` responses which don't already have one.
+     *
+     * The body must be a string, buffer, `Blob` or `Bun.file()`. Streams are not supported.
+     *
+     * @example
+     * ```js
+     * Bun.serve({
+     *   static: {
+     *     "/health": new Response("ok"),
+     *     "/logo.png": new Response(Bun.file("./logo.png")),
+     *   },
+     *   fetch(req) {
+     *     return new Response("dynamic");
+     *   },
+     * });
+     * ```
+     */
+    static?: Record<`/${string}`, Response>;
+
     error?: (
       this: Server,
       request: Errorlike,
@@ -2177,6 +2225,36 @@ declare module "bun" {
       compress?: boolean,
     ): ServerWebSocketSendStatus;
 
+    /**
+     * Publish many messages, each to its own topic, in a single call.
+     *
+     * This is equivalent to calling {@link publish} for each pair, but only
+     * crosses from JavaScript into native code once.
+     *
+     * @param messages An array of `[topic, data]` pairs
+     * @param compress Should the data be compressed? Ignored if the client does not support compression.
+     *
+     * @returns The number of messages that were published to at least one subscriber.
+     *
+     * @example
+     *
+     * ```js
+     * server.publishMany([
+     *   ["room:1", "Hello"],
+     *   ["room:2", new Uint8Array([1, 2, 3])],
+     * ]);
+     * ```
+     */
+    publishMany(
+      messages: Array<
+        [
+          topic: string,
+          data: string | ArrayBufferView | ArrayBuffer | SharedArrayBuffer,
+        ]
+      >,
+      compress?: boolean,
+    ): number;
+
     /**
      * How many requests are in-flight right now?
      */
@@ -3443,6 +3521,92 @@ declare module "bun" {
     options: UnixSocketOptions<Data>,
   ): UnixSocketListener<Data>;
 
+  interface UDPSocketAddress {
+    address: string;
+    family: "IPv4" | "IPv6";
+    port: number;
+  }
+
+  interface UDPSocketHandler {
+    /**
+     * Called once per datagram. Datagrams are read in batches, so several
+     * calls may happen in a row without returning to the event loop.
+     */
+    data?(
+      socket: UDPSocket,
+      data: Buffer,
+      port: number,
+      address: string,
+    ): void | Promise<void>;
+    /**
+     * Called when the socket can send again after `send()` returned `false`
+     * or `sendMany()` sent fewer datagrams than it was given.
+     */
+    drain?(socket: UDPSocket): void | Promise<void>;
+    error?(socket: UDPSocket, error: Error): void | Promise<void>;
+    binaryType?: BinaryType;
+  }
+
+  interface UDPSocketOptions {
+    /**
+     * The IP address to bind to. Hostnames are not resolved.
+     * @default "0.0.0.0"
+     */
+    hostname?: string;
+    /**
+     * @default 0 (any free port)
+     */
+    port?: number;
+    reuseAddr?: boolean;
+    ipv6Only?: boolean;
+    recvBufferSize?: number;
+    sendBufferSize?: number;
+    socket: UDPSocketHandler;
+  }
+
+  interface UDPSocket {
+    /**
+     * Send a datagram. `port` and `address` may be omitted once the socket
+     * is connected.
+     *
+     * @returns `false` if the socket's send buffer is full; wait for `drain`.
+     */
+    send(data: BufferSource, port?: number, address?: string): boolean;
+    /**
+     * Send many datagrams at once, passed as a flat list of
+     * `data, port, address` triples. On Linux this uses `sendmmsg()`.
+     *
+     * @returns How many datagrams were sent. Sending stops at the first one
+     * that fails.
+     */
+    sendMany(packets: Array<BufferSource | number | string | undefined>): number;
+    connect(port: number, address: string): void;
+    disconnect(): void;
+    close(): void;
+    ref(): void;
+    unref(): void;
+    setBroadcast(enabled: boolean): void;
+    setTTL(ttl: number): void;
+    setMulticastTTL(ttl: number): void;
+    setMulticastLoopback(enabled: boolean): void;
+    setMulticastInterface(address: string): void;
+    addMembership(group: string, interfaceAddress?: string): void;
+    dropMembership(group: string, interfaceAddress?: string): void;
+    setRecvBufferSize(size: number): void;
+    setSendBufferSize(size: number): void;
+    getRecvBufferSize(): number;
+    getSendBufferSize(): number;
+    readonly address: UDPSocketAddress;
+    readonly remoteAddress: UDPSocketAddress | undefined;
+    readonly closed: boolean;
+  }
+
+  /**
+   * Create a UDP socket bound to `hostname` and `port`. This is the
+   * primitive `node:dgram` is built on.
+   */
+  export function udpSocket(options: UDPSocketOptions): UDPSocket;
+
   namespace SpawnOptions {
     /**
      * Option for stdout/stderr
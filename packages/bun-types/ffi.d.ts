@@ -447,6 +447,83 @@ declare module "bun:ffi" {
     | "usize"
     | "callback";
 
+  type StructFields = Record<string, FFITypeOrString | StructType<any>>;
+
+  type StructFieldToType<T> = T extends StructType<infer F>
+    ? Struct<F>
+    : T extends FFITypeOrString
+    ? FFITypeToType[ToFFIType<T>]
+    : never;
+
+  /**
+   * An instance of a {@link StructType}: a typed view over the struct's bytes.
+   */
+  export type Struct<Fields extends StructFields> = {
+    -readonly [K in keyof Fields]: StructFieldToType<Fields[K]>;
+  } & {
+    /**
+     * The memory backing this struct. Pass it to {@link ptr} to get a pointer.
+     */
+    readonly view: DataView;
+    toJSON(): Record<keyof Fields, unknown>;
+  };
+
+  /**
+   * A C struct type returned by {@link struct}
+   */
+  export interface StructType<Fields extends StructFields = StructFields> {
+    /**
+     * Allocate zeroed memory for a struct, optionally assigning fields
+     */
+    new (init?: Partial<Record<keyof Fields, unknown>>): Struct<Fields>;
+    /**
+     * View existing memory as a struct. Writes go to that memory.
+     */
+    new (buffer: ArrayBufferLike | ArrayBufferView, byteOffset?: number): Struct<Fields>;
+
+    /**
+     * `sizeof` the struct, including padding
+     */
+    readonly byteLength: number;
+    /**
+     * `alignof` the struct
+     */
+    readonly alignment: number;
+    /**
+     * Fields in declaration order, with their offset in bytes
+     */
+    readonly fields: ReadonlyArray<{ name: string; type: FFIType | StructType; offset: number }>;
+  }
+
+  /**
+   * Define a C struct, laid out the way a C compiler would lay it out
+   *
+   * Struct types can be passed to and returned from FFI functions by value.
+   * Fields may be any {@link FFIType} except `void`, or another struct type.
+   *
+   * @param fields Map of field names to types, in declaration order
+   *
+   * @example
+   * ```js
+   * import { dlopen, struct } from "bun:ffi";
+   *
+   * const Point = struct({ x: "f64", y: "f64" });
+   *
+   * const lib = dlopen("libgeometry.so", {
+   *   midpoint: { args: [Point, Point], returns: Point },
+   * });
+   *
+   * const mid = lib.symbols.midpoint(new Point({ x: 0, y: 0 }), { x: 2, y: 4 });
+   * console.log(mid.x, mid.y); // 1 2
+   * ```
+   * In C:
+   * ```c
+   * typedef struct { double x; double y; } Point;
+   * Point midpoint(Point a, Point b);
+   * ```
+   */
+  export function struct<Fields extends StructFields>(fields: Fields): StructType<Fields>;
+
   interface FFIFunction {
     /**
      * Arguments to a FFI function (C ABI)
@@ -476,7 +553,7 @@ declare module "bun:ffi" {
      * }
      * ```
      */
-    args?: FFITypeOrString[];
+    args?: Array<FFITypeOrString | StructType<any>>;
     /**
      * Return type to a FFI function (C ABI)
      *
@@ -504,7 +581,7 @@ declare module "bun:ffi" {
      * }
      * ```
      */
-    returns?: FFITypeOrString;
+    returns?: FFITypeOrString | StructType<any>;
 
     /**
      * Function pointer to the native function
@@ -533,6 +610,23 @@ declare module "bun:ffi" {
      * @default false
      */
     threadsafe?: boolean;
+
+    /**
+     * Should a {@link threadsafe} callback wait for the JavaScript function to
+     * return?
+     *
+     * Calls from other threads are queued and run on the JavaScript thread. By
+     * default the calling thread doesn't wait, and the callback must return
+     * `void`. With `blocking`, the calling thread waits and receives the
+     * function's return value. Calls made on the JavaScript thread itself run
+     * immediately.
+     *
+     * A blocking call deadlocks if the JavaScript thread is waiting on the
+     * calling thread, for example while joining it.
+     *
+     * @default false
+     */
+    blocking?: boolean;
   }
 
   type Symbols = Record<string, FFIFunction>;
@@ -578,10 +672,10 @@ declare module "bun:ffi" {
 
   type ConvertFns<Fns extends Record<string, FFIFunction>> = {
     [K in keyof Fns]: (
-      ...args: Fns[K]["args"] extends infer A extends FFITypeOrString[]
-        ? { [L in keyof A]: FFITypeToType[ToFFIType<A[L]>] }
+      ...args: Fns[K]["args"] extends infer A extends Array<FFITypeOrString | StructType<any>>
+        ? { [L in keyof A]: StructFieldToType<A[L]> }
         : never
-    ) => FFITypeToType[ToFFIType<NonNullable<Fns[K]["returns"]>>];
+    ) => StructFieldToType<NonNullable<Fns[K]["returns"]>>;
   };
 
   /**
@@ -881,6 +975,10 @@ declare module "bun:ffi" {
      * Free the memory allocated for the callback
      *
      * If called multiple times, does nothing after the first call.
+     *
+     * For a {@link threadsafe} callback, calls already running on other
+     * threads finish safely, but native code must not call the callback
+     * again once `close()` has returned.
      */
     close(): void;
   }
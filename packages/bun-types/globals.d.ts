@@ -2759,6 +2759,20 @@ interface SubtleCrypto {
     algorithm: AlgorithmIdentifier,
     data: BufferSource,
   ): Promise<ArrayBuffer>;
+  /**
+   * Hash many inputs with the same algorithm in one call. Large batches
+   * are spread across the threads used for other WebCrypto work.
+   *
+   * This is a Bun-specific extension to `SubtleCrypto`.
+   *
+   * @param algorithm `"SHA-1"`, `"SHA-256"`, `"SHA-384"`, or `"SHA-512"`
+   * @param data The inputs to hash
+   * @returns One digest per input, in the same order
+   */
+  digestMany(
+    algorithm: AlgorithmIdentifier,
+    data: BufferSource[],
+  ): Promise<ArrayBuffer[]>;
   encrypt(
     algorithm:
       | AlgorithmIdentifier
@@ -39,6 +39,48 @@ declare module "bun:jsc" {
   export function reoptimizationRetryCount(func: Function): number;
   export function drainMicrotasks(): void;
 
+  /**
+   * Inspect the `process.nextTick()` queue
+   *
+   * - `depth` is the number of callbacks waiting to run
+   * - `peakDepth` is the largest `depth` seen since the process started
+   */
+  export function nextTickQueueStats(): {
+    depth: number;
+    peakDepth: number;
+  };
+
+  /**
+   * Inspect tasks that other threads (the thread pool, workers) post to this
+   * thread's event loop
+   *
+   * - `concurrentTasks` is the number of tasks run so far
+   * - `concurrentBatches` is the number of ticks that found tasks waiting
+   * - `peakConcurrentDepth` is the most tasks found waiting in one tick
+   * - `wakeups` is the number of times a posting thread woke the event loop
+   */
+  export function eventLoopStats(): {
+    concurrentTasks: number;
+    concurrentBatches: number;
+    peakConcurrentDepth: number;
+    wakeups: number;
+  };
+
+  /**
+   * Inspect the cache of CommonJS `require()` resolutions
+   *
+   * - `hits` and `misses` count lookups since the process started
+   * - `size` is the number of cached resolutions
+   *
+   * Deleting a module from `require.cache` drops its entries, and `--hot`
+   * reloads clear the cache.
+   */
+  export function requireResolutionCacheStats(): {
+    hits: number;
+    misses: number;
+    size: number;
+  };
+
   /**
    * Set the timezone used by Intl, Date, etc.
    *
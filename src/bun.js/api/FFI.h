@@ -110,6 +110,8 @@ static EncodedJSValue _FFI_Callback_call(void* ctx, size_t argCount, ZIG_REPR_TY
   return_value.asZigRepr = FFI_Callback_call(ctx, argCount, args);
   return return_value;
 }
+// Threadsafe callbacks copy their arguments into `frame` and may be called from any thread
+void FFI_Callback_threadsafe_call(void* ctx, const void* frame, size_t frameSize, void* result);
 #endif
 
 static bool JSVALUE_IS_CELL(EncodedJSValue val) __attribute__((__always_inline__));
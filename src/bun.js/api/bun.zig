@@ -1287,6 +1287,10 @@ pub const Class = NewClass(
         .connect = .{
             .rfn = &JSC.wrapWithHasContainer(JSC.API.Listener, "connect", false, false, false),
         },
+
+        .udpSocket = .{
+            .rfn = &JSC.wrapWithHasContainer(JSC.API.UDPSocket, "udpSocket", false, false, false),
+        },
     },
     .{
         .main = .{
@@ -3632,6 +3636,17 @@ pub const Timer = struct {
     last_id: i32 = 1,
     warned: bool = false,
 
+    /// Every pending setTimeout() and setInterval(), ordered by deadline.
+    /// clearTimeout() and refresh() only update `maps`; the stale heap entry
+    /// is skipped when it reaches the top, or dropped by `collectStaleEntries`.
+    heap: TimerHeap = .{},
+    next_sequence: u64 = 0,
+
+    /// One uSockets timer, armed for the earliest deadline in `heap`.
+    /// Timers that expire together are run from a single wakeup.
+    loop_timer: ?*uws.Timer = null,
+    armed_deadline: ?i64 = null,
+
     // We split up the map here to avoid storing an extra "repeat" boolean
     maps: struct {
         setTimeout: TimeoutMap = .{},
@@ -3666,6 +3681,171 @@ pub const Timer = struct {
 
     const uws = @import("root").bun.uws;
 
+    /// 4-ary min-heap of timer deadlines. Ties are broken by insertion order so
+    /// timers with the same deadline run in the order they were created.
+    pub const TimerHeap = struct {
+        items: std.ArrayListUnmanaged(Entry) = .{},
+
+        const arity = 4;
+
+        pub const Entry = struct {
+            deadline: i64,
+            sequence: u64,
+            id: i32,
+            kind: Timeout.Kind,
+
+            pub fn lessThan(a: Entry, b: Entry) bool {
+                return a.deadline < b.deadline or (a.deadline == b.deadline and a.sequence < b.sequence);
+            }
+        };
+
+        pub fn count(this: *const TimerHeap) usize {
+            return this.items.items.len;
+        }
+
+        pub fn peek(this: *const TimerHeap) ?Entry {
+            if (this.items.items.len == 0) return null;
+            return this.items.items[0];
+        }
+
+        pub fn push(this: *TimerHeap, allocator: std.mem.Allocator, entry: Entry) void {
+            this.items.append(allocator, entry) catch @panic("Out of memory while allocating Timeout");
+            this.siftUp(this.items.items.len - 1);
+        }
+
+        pub fn pop(this: *TimerHeap) ?Entry {
+            if (this.items.items.len == 0) return null;
+            const top = this.items.items[0];
+            const last = this.items.pop();
+            if (this.items.items.len > 0) {
+                this.items.items[0] = last;
+                this.siftDown(0);
+            }
+            return top;
+        }
+
+        /// Remove every entry for which `isLive` returns false, in O(n).
+        pub fn retain(this: *TimerHeap, context: anytype, comptime isLive: fn (@TypeOf(context), Entry) bool) void {
+            var items = this.items.items;
+            var len: usize = 0;
+            for (items) |entry| {
+                if (isLive(context, entry)) {
+                    items[len] = entry;
+                    len += 1;
+                }
+            }
+            this.items.items.len = len;
+
+            if (len < 2) return;
+            var i = (len - 2) / arity + 1;
+            while (i > 0) {
+                i -= 1;
+                this.siftDown(i);
+            }
+        }
+
+        fn siftUp(this: *TimerHeap, start: usize) void {
+            var items = this.items.items;
+            const entry = items[start];
+            var i = start;
+            while (i > 0) {
+                const parent = (i - 1) / arity;
+                if (!entry.lessThan(items[parent])) break;
+                items[i] = items[parent];
+                i = parent;
+            }
+            items[i] = entry;
+        }
+
+        fn siftDown(this: *TimerHeap, start: usize) void {
+            var items = this.items.items;
+            const entry = items[start];
+            var i = start;
+            while (true) {
+                const first_child = i * arity + 1;
+                if (first_child >= items.len) break;
+                const end = @min(first_child + arity, items.len);
+                var smallest = first_child;
+                var child = first_child + 1;
+                while (child < end) : (child += 1) {
+                    if (items[child].lessThan(items[smallest])) smallest = child;
+                }
+                if (!items[smallest].lessThan(entry)) break;
+                items[i] = items[smallest];
+                i = smallest;
+            }
+            items[i] = entry;
+        }
+    };
+
+    fn now(vm: *VirtualMachine) i64 {
+        return @intCast(i64, vm.origin_timer.read() / std.time.ns_per_ms);
+    }
+
+    fn nextSequence(this: *Timer) u64 {
+        this.next_sequence += 1;
+        return this.next_sequence;
+    }
+
+    fn isLive(this: *Timer, entry: TimerHeap.Entry) bool {
+        const timeout = (this.maps.get(entry.kind).get(entry.id) orelse return false) orelse return false;
+        return timeout.sequence == entry.sequence;
+    }
+
+    /// Add `timeout` to the heap. It must already be in `maps`.
+    fn schedule(this: *Timer, vm: *VirtualMachine, id: Timeout.ID, timeout: *const Timeout) void {
+        this.heap.push(vm.allocator, .{
+            .deadline = now(vm) + timeout.interval,
+            .sequence = timeout.sequence,
+            .id = id.id,
+            .kind = id.kind,
+        });
+        this.arm(vm);
+    }
+
+    fn arm(this: *Timer, vm: *VirtualMachine) void {
+        const next = this.heap.peek() orelse return;
+        if (this.armed_deadline) |armed| {
+            if (armed <= next.deadline) return;
+        }
+
+        const loop_timer = this.loop_timer orelse brk: {
+            // Fallthrough: pending timers keep the process alive through their own PollRef.
+            this.loop_timer = uws.Timer.createFallthrough(vm.uws_event_loop.?, this);
+            break :brk this.loop_timer.?;
+        };
+
+        // uSockets treats 0 as "disarm"
+        const delay = @max(next.deadline - now(vm), 1);
+        loop_timer.set(this, onLoopTimer, @intCast(i32, @min(delay, std.math.maxInt(i32))), 0);
+        this.armed_deadline = next.deadline;
+    }
+
+    fn onLoopTimer(_: *uws.Timer) callconv(.C) void {
+        var vm = JSC.VirtualMachine.get();
+        var this = &vm.timer;
+        this.armed_deadline = null;
+
+        const current = now(vm);
+        while (this.heap.peek()) |entry| {
+            if (entry.deadline > current) break;
+            _ = this.heap.pop();
+            Timeout.run(vm, entry);
+        }
+
+        this.arm(vm);
+    }
+
+    /// Cleared and refreshed timers leave their heap entry behind. Once those
+    /// outnumber the live ones, drop them so the heap doesn't grow without bound.
+    fn collectStaleEntries(this: *Timer) void {
+        const live = this.maps.setTimeout.count() + this.maps.setInterval.count();
+        const total = this.heap.count();
+        if (total < 1024 or total < live * 2) return;
+
+        this.heap.retain(this, isLive);
+    }
+
     // TODO: reference count to avoid multiple Strong references to the same
     // object in setInterval
     const CallbackJob = struct {
@@ -3848,11 +4028,6 @@ pub const Timer = struct {
                     if (vm.timer.maps.get(this.kind).getPtr(this.id)) |val_| {
                         if (val_.*) |*val| {
                             val.poll_ref.ref(vm);
-
-                            if (val.did_unref_timer) {
-                                val.did_unref_timer = false;
-                                vm.uws_event_loop.?.num_polls += 1;
-                            }
                         }
                     }
                 },
@@ -3920,10 +4095,8 @@ pub const Timer = struct {
                 var timeout = Timeout{
                     .callback = JSC.Strong.create(callback, globalThis),
                     .globalThis = globalThis,
-                    .timer = uws.Timer.create(
-                        vm.uws_event_loop.?,
-                        id,
-                    ),
+                    .interval = this.interval,
+                    .sequence = vm.timer.nextSequence(),
                 };
 
                 if (TimerObject.argumentsGetCached(this_value)) |arguments| {
@@ -3942,13 +4115,8 @@ pub const Timer = struct {
                 }
 
                 map.put(vm.allocator, this.id, timeout) catch unreachable;
-
-                timeout.timer.set(
-                    id,
-                    Timeout.run,
-                    this.interval,
-                    @as(i32, @intFromBool(this.kind == .setInterval)) * this.interval,
-                );
+                vm.timer.schedule(vm, id, &timeout);
+                vm.timer.collectStaleEntries();
                 return this_value;
             }
             return JSValue.jsUndefined();
@@ -3964,11 +4132,6 @@ pub const Timer = struct {
                     if (vm.timer.maps.get(this.kind).getPtr(this.id)) |val_| {
                         if (val_.*) |*val| {
                             val.poll_ref.unref(vm);
-
-                            if (!val.did_unref_timer) {
-                                val.did_unref_timer = true;
-                                vm.uws_event_loop.?.num_polls -= 1;
-                            }
                         }
                     }
                 },
@@ -3995,8 +4158,9 @@ pub const Timer = struct {
     pub const Timeout = struct {
         callback: JSC.Strong = .{},
         globalThis: *JSC.JSGlobalObject,
-        timer: *uws.Timer,
-        did_unref_timer: bool = false,
+        interval: i32 = 0,
+        /// Matches the `TimerHeap.Entry` that will run this timeout.
+        sequence: u64 = 0,
         poll_ref: JSC.PollRef = JSC.PollRef.init(),
         arguments: JSC.Strong = .{},
 
@@ -4017,12 +4181,11 @@ pub const Timer = struct {
             }
         };
 
-        pub fn run(timer: *uws.Timer) callconv(.C) void {
-            const timer_id: ID = timer.as(ID);
-
-            // use the threadlocal despite being slow on macOS
-            // to handle the timeout being cancelled after already enqueued
-            var vm = JSC.VirtualMachine.get();
+        pub fn run(vm: *VirtualMachine, entry: TimerHeap.Entry) void {
+            const timer_id: ID = .{
+                .id = entry.id,
+                .kind = entry.kind,
+            };
 
             const repeats = timer_id.repeats();
 
@@ -4034,6 +4197,10 @@ pub const Timer = struct {
             var this = this_ orelse
                 return;
 
+            // cleared and re-created, or refreshed, since this entry was scheduled
+            if (this.sequence != entry.sequence)
+                return;
+
             var globalThis = this.globalThis;
 
             var cb: CallbackJob = .{
@@ -4080,6 +4247,8 @@ pub const Timer = struct {
                 this.arguments = .{};
                 map.put(vm.allocator, timer_id.id, null) catch unreachable;
                 this.deinit();
+            } else {
+                vm.timer.schedule(vm, timer_id, &this);
             }
 
             var job = vm.allocator.create(CallbackJob) catch @panic(
@@ -4100,12 +4269,6 @@ pub const Timer = struct {
 
             this.poll_ref.unref(vm);
 
-            this.timer.deinit();
-            if (this.did_unref_timer) {
-                // balance double-unrefing
-                vm.uws_event_loop.?.num_polls += 1;
-            }
-
             this.callback.deinit();
             this.arguments.deinit();
         }
@@ -4156,13 +4319,8 @@ pub const Timer = struct {
         var timeout = Timeout{
             .callback = JSC.Strong.create(callback, globalThis),
             .globalThis = globalThis,
-            .timer = uws.Timer.create(
-                vm.uws_event_loop.?,
-                Timeout.ID{
-                    .id = id,
-                    .kind = kind,
-                },
-            ),
+            .interval = interval,
+            .sequence = vm.timer.nextSequence(),
         };
 
         if (arguments_array_or_zero != .zero) {
@@ -4172,14 +4330,13 @@ pub const Timer = struct {
         timeout.poll_ref.ref(vm);
         map.put(vm.allocator, id, timeout) catch unreachable;
 
-        timeout.timer.set(
+        vm.timer.schedule(
+            vm,
             Timeout.ID{
                 .id = id,
                 .kind = kind,
             },
-            Timeout.run,
-            interval,
-            @as(i32, @intFromBool(kind == .setInterval)) * interval,
+            &timeout,
         );
     }
 
@@ -4255,7 +4412,9 @@ pub const Timer = struct {
             return;
         }
 
+        // The heap entry stays behind; Timeout.run() skips it once the id is gone from the map.
         timer.value.?.deinit();
+        globalThis.bunVM().timer.collectStaleEntries();
     }
 
     pub fn clearTimeout(
@@ -0,0 +1,841 @@
+const std = @import("std");
+const bun = @import("root").bun;
+const Environment = bun.Environment;
+const strings = bun.strings;
+const Output = bun.Output;
+const JSC = bun.JSC;
+const JSValue = JSC.JSValue;
+const JSGlobalObject = JSC.JSGlobalObject;
+const ZigString = JSC.ZigString;
+const Syscall = JSC.Node.Syscall;
+const Maybe = JSC.Maybe;
+const os = std.os;
+
+const log = Output.scoped(.UDPSocket, false);
+
+/// How many datagrams a single recvmmsg()/sendmmsg() moves on Linux. Other
+/// platforms fall back to one recvfrom()/sendto() per datagram.
+const batch_size = 16;
+
+/// Large enough for any UDP payload over IPv4 or IPv6 (without jumbograms).
+const max_datagram_size = 64 * 1024;
+
+/// After this many reads in one wakeup we go back to the event loop, so a
+/// flood on one socket can't starve timers and other sockets.
+const max_reads_per_tick = 64;
+
+const IP = if (Environment.isLinux) struct {
+    pub const TTL = 2;
+    pub const MULTICAST_IF = 32;
+    pub const MULTICAST_TTL = 33;
+    pub const MULTICAST_LOOP = 34;
+    pub const ADD_MEMBERSHIP = 35;
+    pub const DROP_MEMBERSHIP = 36;
+} else struct {
+    pub const TTL = 4;
+    pub const MULTICAST_IF = 9;
+    pub const MULTICAST_TTL = 10;
+    pub const MULTICAST_LOOP = 11;
+    pub const ADD_MEMBERSHIP = 12;
+    pub const DROP_MEMBERSHIP = 13;
+};
+
+const IPV6 = if (Environment.isLinux) struct {
+    pub const UNICAST_HOPS = 16;
+    pub const MULTICAST_IF = 17;
+    pub const MULTICAST_HOPS = 18;
+    pub const MULTICAST_LOOP = 19;
+    pub const ADD_MEMBERSHIP = 20;
+    pub const DROP_MEMBERSHIP = 21;
+    pub const V6ONLY = 26;
+} else struct {
+    pub const UNICAST_HOPS = 4;
+    pub const MULTICAST_IF = 9;
+    pub const MULTICAST_HOPS = 10;
+    pub const MULTICAST_LOOP = 11;
+    pub const ADD_MEMBERSHIP = 12;
+    pub const DROP_MEMBERSHIP = 13;
+    pub const V6ONLY = 27;
+};
+
+/// Shared by every UDP socket on the VM, since reads never interleave. It is
+/// large, so it's only allocated once the first datagram arrives.
+pub const ReceiveBuffer = struct {
+    bytes: [batch_size][max_datagram_size]u8 = undefined,
+    addresses: [batch_size]std.net.Address = undefined,
+    iovecs: [batch_size]os.iovec = undefined,
+    headers: [batch_size]Syscall.MMsgHdr = undefined,
+};
+
+const Handlers = struct {
+    onData: JSValue = .zero,
+    onDrain: JSValue = .zero,
+    onError: JSValue = .zero,
+
+    binary_type: JSC.BinaryType = .Buffer,
+
+    pub fn fromJS(globalObject: *JSGlobalObject, opts: JSValue, exception: JSC.C.ExceptionRef) ?Handlers {
+        var handlers = Handlers{};
+
+        if (opts.isEmptyOrUndefinedOrNull() or opts.isBoolean() or !opts.isObject()) {
+            exception.* = JSC.toInvalidArguments("Expected \"socket\" to be an object", .{}, globalObject).asObjectRef();
+            return null;
+        }
+
+        const pairs = .{
+            .{ "onData", "data" },
+            .{ "onDrain", "drain" },
+            .{ "onError", "error" },
+        };
+        inline for (pairs) |pair| {
+            if (opts.getTruthy(globalObject, pair.@"1")) |callback_value| {
+                if (!callback_value.isCell() or !callback_value.isCallable(globalObject.vm())) {
+                    exception.* = JSC.toInvalidArguments(comptime std.fmt.comptimePrint("Expected \"{s}\" callback to be a function", .{pair.@"1"}), .{}, globalObject).asObjectRef();
+                    return null;
+                }
+
+                @field(handlers, pair.@"0") = callback_value;
+            }
+        }
+
+        if (opts.getTruthy(globalObject, "binaryType")) |binary_type_value| {
+            if (!binary_type_value.isString()) {
+                exception.* = JSC.toInvalidArguments("Expected \"binaryType\" to be a string", .{}, globalObject).asObjectRef();
+                return null;
+            }
+
+            handlers.binary_type = JSC.BinaryType.fromJSValue(globalObject, binary_type_value) orelse {
+                exception.* = JSC.toInvalidArguments("Expected 'binaryType' to be 'arraybuffer', 'uint8array', 'buffer'", .{}, globalObject).asObjectRef();
+                return null;
+            };
+        }
+
+        return handlers;
+    }
+
+    pub fn protect(this: *Handlers) void {
+        this.onData.protect();
+        this.onDrain.protect();
+        this.onError.protect();
+    }
+
+    pub fn unprotect(this: *Handlers) void {
+        this.onData.unprotect();
+        this.onDrain.unprotect();
+        this.onError.unprotect();
+    }
+};
+
+/// Like `callframe.arguments()`, but missing arguments are `undefined`.
+fn argumentsOrUndefined(callframe: *JSC.CallFrame, comptime max: usize) [max]JSValue {
+    const args = callframe.arguments(max);
+    var result = [_]JSValue{JSValue.jsUndefined()} ** max;
+    for (args.slice(), 0..) |arg, i| {
+        result[i] = arg;
+    }
+    return result;
+}
+
+fn parsePort(globalObject: *JSGlobalObject, value: JSValue) ?u16 {
+    if (!value.isNumber() or value.toInt64() > std.math.maxInt(u16) or value.toInt64() < 0) {
+        globalObject.throwInvalidArguments("Expected \"port\" to be a number between 0 and 65535", .{});
+        return null;
+    }
+
+    return value.toU16();
+}
+
+/// Hostnames must already be resolved: node:dgram does its own dns.lookup().
+fn parseAddress(globalObject: *JSGlobalObject, value: JSValue, port: u16) ?std.net.Address {
+    if (!value.isString()) {
+        globalObject.throwInvalidArguments("Expected \"hostname\" to be a string", .{});
+        return null;
+    }
+
+    var slice = value.getZigString(globalObject).toSlice(bun.default_allocator);
+    defer slice.deinit();
+    const hostname = if (strings.eqlComptime(slice.slice(), "localhost")) "127.0.0.1" else slice.slice();
+
+    return std.net.Address.resolveIp(hostname, port) catch {
+        globalObject.throwInvalidArguments("Expected \"hostname\" to be an IP address, got \"{s}\"", .{hostname});
+        return null;
+    };
+}
+
+fn addressToJS(address: std.net.Address, globalObject: *JSGlobalObject) JSValue {
+    var text_buf: [128]u8 = undefined;
+    const text = bun.fmt.formatIp(address, &text_buf) catch unreachable;
+
+    var object = JSValue.createEmptyObject(globalObject, 3);
+    object.put(globalObject, ZigString.static("address"), ZigString.init(text).toValueGC(globalObject));
+    object.put(globalObject, ZigString.static("family"), if (address.any.family == os.AF.INET6)
+        ZigString.static("IPv6").toValueGC(globalObject)
+    else
+        ZigString.static("IPv4").toValueGC(globalObject));
+    object.put(globalObject, ZigString.static("port"), JSValue.jsNumber(address.getPort()));
+    return object;
+}
+
+pub const UDPSocket = struct {
+    fd: bun.FileDescriptor,
+    poll: *JSC.FilePoll,
+    handlers: Handlers,
+    globalThis: *JSGlobalObject,
+    vm: *JSC.VirtualMachine,
+    this_value: JSValue = .zero,
+
+    local_address: std.net.Address,
+    remote_address: ?std.net.Address = null,
+
+    closed: bool = false,
+
+    /// A send returned EAGAIN. The poll watches for writable instead of
+    /// readable until the socket drains (FilePoll only watches one direction);
+    /// incoming datagrams wait in the kernel's receive buffer meanwhile.
+    blocked: bool = false,
+
+    has_pending_activity: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(true),
+
+    pub usingnamespace JSC.Codegen.JSUDPSocket;
+
+    pub fn udpSocket(
+        globalObject: *JSGlobalObject,
+        opts: JSValue,
+        exception: JSC.C.ExceptionRef,
+    ) JSValue {
+        log("udpSocket", .{});
+        if (opts.isEmptyOrUndefinedOrNull() or opts.isBoolean() or !opts.isObject()) {
+            exception.* = JSC.toInvalidArguments("Expected object", .{}, globalObject).asObjectRef();
+            return .zero;
+        }
+
+        const handlers = Handlers.fromJS(globalObject, opts.get(globalObject, "socket") orelse JSValue.zero, exception) orelse {
+            return .zero;
+        };
+
+        var port: u16 = 0;
+        if (opts.get(globalObject, "port")) |port_value| {
+            if (!port_value.isUndefinedOrNull()) {
+                port = parsePort(globalObject, port_value) orelse return .zero;
+            }
+        }
+
+        const address = if (opts.getTruthy(globalObject, "hostname")) |hostname_value|
+            parseAddress(globalObject, hostname_value, port) orelse return .zero
+        else
+            std.net.Address.initIp4(.{ 0, 0, 0, 0 }, port);
+
+        var buffer_sizes = [2]?c_int{ null, null };
+        const sizes = .{
+            .{ "recvBufferSize", 0 },
+            .{ "sendBufferSize", 1 },
+        };
+        inline for (sizes) |size| {
+            if (opts.getTruthy(globalObject, size.@"0")) |value| {
+                if (!value.isNumber() or value.toInt64() <= 0 or value.toInt64() > std.math.maxInt(c_int)) {
+                    exception.* = JSC.toInvalidArguments("Expected \"" ++ size.@"0" ++ "\" to be a positive integer", .{}, globalObject).asObjectRef();
+                    return .zero;
+                }
+                buffer_sizes[size.@"1"] = value.toInt32();
+            }
+        }
+
+        const fd = switch (Syscall.socket(address.any.family, os.SOCK.DGRAM, 0)) {
+            .err => |err| {
+                exception.* = err.toJSC(globalObject).asObjectRef();
+                return .zero;
+            },
+            .result => |fd| fd,
+        };
+
+        var this = bun.default_allocator.create(UDPSocket) catch @panic("Out of memory");
+        this.* = UDPSocket{
+            .fd = fd,
+            .poll = undefined,
+            .handlers = handlers,
+            .globalThis = globalObject,
+            .vm = globalObject.bunVM(),
+            .local_address = address,
+        };
+
+        const reuse_addr = opts.getTruthy(globalObject, "reuseAddr") != null;
+        const ipv6_only = opts.getTruthy(globalObject, "ipv6Only") != null;
+        if (this.bind(&address, reuse_addr, ipv6_only, buffer_sizes).asErr()) |err| {
+            _ = Syscall.close(fd);
+            bun.default_allocator.destroy(this);
+            exception.* = err.toJSC(globalObject).asObjectRef();
+            return .zero;
+        }
+
+        this.handlers.protect();
+        this.poll = JSC.FilePoll.init(this.vm, fd, .{}, UDPSocket, this);
+        this.vm.eventLoop().ensureWaker();
+        if (this.poll.register(this.vm.uws_event_loop.?, .readable, false).asErr()) |err| {
+            this.closeAndDetach();
+            bun.default_allocator.destroy(this);
+            exception.* = err.toJSC(globalObject).asObjectRef();
+            return .zero;
+        }
+
+        this.this_value = this.toJS(globalObject);
+        return this.this_value;
+    }
+
+    fn bind(this: *UDPSocket, address: *const std.net.Address, reuse_addr: bool, ipv6_only: bool, buffer_sizes: [2]?c_int) Maybe(void) {
+        if (reuse_addr) {
+            // Darwin only lets two sockets share a UDP port with SO_REUSEPORT.
+            const option = if (comptime Environment.isMac) os.SO.REUSEPORT else os.SO.REUSEADDR;
+            if (this.setIntOption(os.SOL.SOCKET, option, 1).asErr()) |err| return .{ .err = err };
+        }
+
+        if (address.any.family == os.AF.INET6) {
+            if (this.setIntOption(os.IPPROTO.IPV6, IPV6.V6ONLY, @intFromBool(ipv6_only)).asErr()) |err| return .{ .err = err };
+        }
+
+        if (buffer_sizes[0]) |size| {
+            if (this.setIntOption(os.SOL.SOCKET, os.SO.RCVBUF, size).asErr()) |err| return .{ .err = err };
+        }
+        if (buffer_sizes[1]) |size| {
+            if (this.setIntOption(os.SOL.SOCKET, os.SO.SNDBUF, size).asErr()) |err| return .{ .err = err };
+        }
+
+        if (Syscall.bind(this.fd, &address.any, address.getOsSockLen()).asErr()) |err| return .{ .err = err };
+
+        // Picks up the port the kernel chose when binding to port 0.
+        var len: os.socklen_t = @sizeOf(std.net.Address);
+        return Syscall.getsockname(this.fd, &this.local_address.any, &len);
+    }
+
+    pub fn constructor(globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) ?*UDPSocket {
+        globalObject.throw("Cannot construct UDPSocket", .{});
+        return null;
+    }
+
+    pub fn hasPendingActivity(this: *UDPSocket) callconv(.C) bool {
+        @fence(.Acquire);
+        return this.has_pending_activity.load(.Acquire);
+    }
+
+    fn setIntOption(this: *UDPSocket, level: anytype, name: anytype, value: c_int) Maybe(void) {
+        return Syscall.setsockopt(this.fd, level, name, std.mem.asBytes(&value));
+    }
+
+    fn isIPv6(this: *const UDPSocket) bool {
+        return this.local_address.any.family == os.AF.INET6;
+    }
+
+    pub fn onPoll(this: *UDPSocket, poll: *JSC.FilePoll) void {
+        if (this.closed) return;
+
+        if (this.blocked) {
+            if (poll.isWritable() or poll.isHUP() or poll.isEOF())
+                this.onWritable();
+            return;
+        }
+
+        this.onReadable();
+    }
+
+    fn onReadable(this: *UDPSocket) void {
+        var buffer = this.vm.rareData().udpReceiveBuffer();
+        var reads: usize = 0;
+
+        while (!this.closed and reads < max_reads_per_tick) : (reads += 1) {
+            if (comptime Environment.isLinux) {
+                var i: usize = 0;
+                while (i < batch_size) : (i += 1) {
+                    buffer.iovecs[i] = .{ .iov_base = &buffer.bytes[i], .iov_len = max_datagram_size };
+                    buffer.headers[i] = .{
+                        .hdr = .{
+                            .name = &buffer.addresses[i].any,
+                            .namelen = @sizeOf(std.net.Address),
+                            .iov = @ptrCast([*]os.iovec, &buffer.iovecs[i]),
+                        },
+                    };
+                }
+
+                const count = switch (Syscall.recvmmsg(this.fd, &buffer.headers, 0)) {
+                    .err => |err| {
+                        if (!err.isRetry()) this.onError(err);
+                        return;
+                    },
+                    .result => |count| count,
+                };
+
+                i = 0;
+                while (i < count and !this.closed) : (i += 1) {
+                    this.onDatagram(buffer.bytes[i][0..buffer.headers[i].len], &buffer.addresses[i]);
+                }
+
+                if (count < batch_size) return;
+            } else {
+                var len: os.socklen_t = @sizeOf(std.net.Address);
+                const read = switch (Syscall.recvfrom(this.fd, &buffer.bytes[0], 0, &buffer.addresses[0].any, &len)) {
+                    .err => |err| {
+                        if (!err.isRetry()) this.onError(err);
+                        return;
+                    },
+                    .result => |read| read,
+                };
+
+                this.onDatagram(buffer.bytes[0][0..read], &buffer.addresses[0]);
+            }
+        }
+    }
+
+    fn onDatagram(this: *UDPSocket, bytes: []const u8, address: *const std.net.Address) void {
+        const callback = this.handlers.onData;
+        if (callback == .zero) return;
+
+        const globalObject = this.globalThis;
+        var text_buf: [128]u8 = undefined;
+        const text = bun.fmt.formatIp(address.*, &text_buf) catch unreachable;
+
+        const this_value = this.this_value;
+        const result = callback.callWithThis(globalObject, this_value, &[_]JSValue{
+            this_value,
+            this.handlers.binary_type.toJS(bytes, globalObject),
+            JSValue.jsNumber(address.getPort()),
+            ZigString.init(text).toValueGC(globalObject),
+        });
+
+        if (result.toError()) |err_value| {
+            this.callErrorHandler(err_value);
+        }
+    }
+
+    fn onWritable(this: *UDPSocket) void {
+        this.watchReadable();
+
+        const callback = this.handlers.onDrain;
+        if (callback == .zero) return;
+
+        const result = callback.callWithThis(this.globalThis, this.this_value, &[_]JSValue{this.this_value});
+        if (result.toError()) |err_value| {
+            this.callErrorHandler(err_value);
+        }
+    }
+
+    fn onError(this: *UDPSocket, err: Syscall.Error) void {
+        this.callErrorHandler(err.toJSC(this.globalThis));
+    }
+
+    fn callErrorHandler(this: *UDPSocket, err_value: JSValue) void {
+        const callback = this.handlers.onError;
+        if (callback == .zero) {
+            this.vm.onUnhandledError(this.globalThis, err_value);
+            return;
+        }
+
+        const result = callback.callWithThis(this.globalThis, this.this_value, &[_]JSValue{ this.this_value, err_value });
+        if (result.isAnyError()) {
+            this.vm.onUnhandledError(this.globalThis, result);
+        }
+    }
+
+    fn watchWritable(this: *UDPSocket) void {
+        if (this.blocked or this.closed) return;
+        this.blocked = true;
+
+        const loop = this.vm.uws_event_loop.?;
+        _ = this.poll.unregister(loop);
+        if (this.poll.register(loop, .writable, false).asErr()) |err| {
+            this.blocked = false;
+            _ = this.poll.register(loop, .readable, false);
+            this.onError(err);
+        }
+    }
+
+    fn watchReadable(this: *UDPSocket) void {
+        if (!this.blocked or this.closed) return;
+        this.blocked = false;
+
+        const loop = this.vm.uws_event_loop.?;
+        _ = this.poll.unregister(loop);
+        if (this.poll.register(loop, .readable, false).asErr()) |err| {
+            this.onError(err);
+        }
+    }
+
+    fn sendTo(this: *UDPSocket, bytes: []const u8, destination: ?*const std.net.Address) Maybe(usize) {
+        if (destination) |address| {
+            return Syscall.sendto(this.fd, bytes, 0, &address.any, address.getOsSockLen());
+        }
+        return Syscall.sendto(this.fd, bytes, 0, null, 0);
+    }
+
+    /// `undefined` ports and hostnames mean "the connected peer".
+    fn destinationFromJS(this: *UDPSocket, globalObject: *JSGlobalObject, port_value: JSValue, hostname_value: JSValue) ??std.net.Address {
+        if (port_value.isUndefinedOrNull() and hostname_value.isUndefinedOrNull()) {
+            if (this.remote_address == null) {
+                globalObject.throwInvalidArguments("Expected a \"port\" and \"hostname\" for an unconnected socket", .{});
+                return null;
+            }
+            return @as(?std.net.Address, null);
+        }
+
+        const port = parsePort(globalObject, port_value) orelse return null;
+        return @as(?std.net.Address, parseAddress(globalObject, hostname_value, port) orelse return null);
+    }
+
+    /// send(data, port?, hostname?): true if the kernel took the datagram,
+    /// false if the socket is full and "drain" will be called later.
+    pub fn send(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const args = argumentsOrUndefined(callframe, 3);
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        const payload = args[0].asArrayBuffer(globalObject) orelse {
+            globalObject.throwInvalidArguments("Expected data to be a TypedArray or ArrayBuffer", .{});
+            return .zero;
+        };
+        const destination = this.destinationFromJS(globalObject, args[1], args[2]) orelse return .zero;
+
+        switch (this.sendTo(payload.slice(), if (destination) |*address| address else null)) {
+            .err => |err| {
+                if (err.isRetry()) {
+                    this.watchWritable();
+                    return JSValue.jsBoolean(false);
+                }
+                globalObject.throwValue(err.toJSC(globalObject));
+                return .zero;
+            },
+            .result => return JSValue.jsBoolean(true),
+        }
+    }
+
+    /// sendMany([data, port, hostname, data, port, hostname, ...]) returns how
+    /// many datagrams were sent, using sendmmsg() on Linux. Sending stops at
+    /// the first datagram that fails; `send()` it on its own to get the error,
+    /// or wait for "drain" if the socket was full.
+    pub fn sendMany(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const args = argumentsOrUndefined(callframe, 1);
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        if (!args[0].isCell() or !args[0].jsTypeLoose().isArray()) {
+            globalObject.throwInvalidArguments("Expected an array", .{});
+            return .zero;
+        }
+
+        const list = args[0];
+        const length = list.getLength(globalObject);
+        if (length % 3 != 0) {
+            globalObject.throwInvalidArguments("Expected an array of [data, port, hostname] triples", .{});
+            return .zero;
+        }
+
+        const count = length / 3;
+        var sent: usize = 0;
+
+        var iovecs: [batch_size]os.iovec = undefined;
+        var addresses: [batch_size]?std.net.Address = undefined;
+        var headers: [batch_size]Syscall.MMsgHdr = undefined;
+
+        while (sent < count) {
+            const batch = @min(count - sent, if (comptime Environment.isLinux) batch_size else 1);
+
+            var i: usize = 0;
+            while (i < batch) : (i += 1) {
+                const index = @truncate(u32, (sent + i) * 3);
+                const payload = list.getIndex(globalObject, index).asArrayBuffer(globalObject) orelse {
+                    globalObject.throwInvalidArguments("Expected data to be a TypedArray or ArrayBuffer", .{});
+                    return .zero;
+                };
+                addresses[i] = this.destinationFromJS(globalObject, list.getIndex(globalObject, index + 1), list.getIndex(globalObject, index + 2)) orelse return .zero;
+
+                const bytes = payload.slice();
+                iovecs[i] = .{ .iov_base = bytes.ptr, .iov_len = bytes.len };
+                headers[i] = .{
+                    .hdr = .{
+                        .name = if (addresses[i]) |*address| &address.any else null,
+                        .namelen = if (addresses[i]) |address| address.getOsSockLen() else 0,
+                        .iov = @ptrCast([*]os.iovec, &iovecs[i]),
+                    },
+                };
+            }
+
+            const result = if (comptime Environment.isLinux)
+                Syscall.sendmmsg(this.fd, headers[0..batch], 0)
+            else
+                this.sendTo(iovecs[0].iov_base[0..iovecs[0].iov_len], if (addresses[0]) |*address| address else null);
+
+            switch (result) {
+                .err => |err| {
+                    if (err.isRetry()) this.watchWritable();
+                    break;
+                },
+                .result => |wrote| {
+                    sent += if (comptime Environment.isLinux) wrote else 1;
+                    if (comptime Environment.isLinux) {
+                        if (wrote < batch) break;
+                    }
+                },
+            }
+        }
+
+        return JSValue.jsNumber(sent);
+    }
+
+    pub fn connect(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const args = argumentsOrUndefined(callframe, 2);
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        const port = parsePort(globalObject, args[0]) orelse return .zero;
+        var address = parseAddress(globalObject, args[1], port) orelse return .zero;
+
+        switch (Syscall.connect(this.fd, &address.any, address.getOsSockLen())) {
+            .err => |err| {
+                globalObject.throwValue(err.toJSC(globalObject));
+                return .zero;
+            },
+            .result => {},
+        }
+
+        this.remote_address = address;
+        return JSValue.jsUndefined();
+    }
+
+    pub fn disconnect(this: *UDPSocket, globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (this.closed or this.remote_address == null) return JSValue.jsUndefined();
+
+        var unspecified = std.mem.zeroes(os.sockaddr);
+        unspecified.family = os.AF.UNSPEC;
+        switch (Syscall.connect(this.fd, &unspecified, @sizeOf(os.sockaddr))) {
+            // Darwin reports EAFNOSUPPORT but still dissolves the association.
+            .err => |err| if (err.getErrno() != .AFNOSUPPORT) {
+                globalObject.throwValue(err.toJSC(globalObject));
+                return .zero;
+            },
+            .result => {},
+        }
+
+        this.remote_address = null;
+        return JSValue.jsUndefined();
+    }
+
+    fn setOptionFromJS(this: *UDPSocket, globalObject: *JSGlobalObject, level: anytype, name: anytype, value: c_int) JSValue {
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        if (this.setIntOption(level, name, value).asErr()) |err| {
+            globalObject.throwValue(err.toJSC(globalObject));
+            return .zero;
+        }
+
+        return JSValue.jsUndefined();
+    }
+
+    fn intArgument(globalObject: *JSGlobalObject, callframe: *JSC.CallFrame, comptime min: c_int, comptime max: c_int) ?c_int {
+        const args = argumentsOrUndefined(callframe, 1);
+        if (!args[0].isNumber() or args[0].toInt64() < min or args[0].toInt64() > max) {
+            globalObject.throwInvalidArguments("Expected a number between {d} and {d}", .{ min, max });
+            return null;
+        }
+        return args[0].toInt32();
+    }
+
+    pub fn setBroadcast(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const enabled = argumentsOrUndefined(callframe, 1)[0].toBoolean();
+        return this.setOptionFromJS(globalObject, os.SOL.SOCKET, os.SO.BROADCAST, @intFromBool(enabled));
+    }
+
+    pub fn setTTL(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const ttl = intArgument(globalObject, callframe, 1, 255) orelse return .zero;
+        if (this.isIPv6())
+            return this.setOptionFromJS(globalObject, os.IPPROTO.IPV6, IPV6.UNICAST_HOPS, ttl);
+        return this.setOptionFromJS(globalObject, os.IPPROTO.IP, IP.TTL, ttl);
+    }
+
+    pub fn setMulticastTTL(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const ttl = intArgument(globalObject, callframe, 0, 255) orelse return .zero;
+        if (this.isIPv6())
+            return this.setOptionFromJS(globalObject, os.IPPROTO.IPV6, IPV6.MULTICAST_HOPS, ttl);
+        return this.setByteOptionFromJS(globalObject, IP.MULTICAST_TTL, @intCast(u8, ttl));
+    }
+
+    pub fn setMulticastLoopback(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const enabled = argumentsOrUndefined(callframe, 1)[0].toBoolean();
+        if (this.isIPv6())
+            return this.setOptionFromJS(globalObject, os.IPPROTO.IPV6, IPV6.MULTICAST_LOOP, @intFromBool(enabled));
+        return this.setByteOptionFromJS(globalObject, IP.MULTICAST_LOOP, @intFromBool(enabled));
+    }
+
+    /// The IPv4 multicast options take an unsigned char on Darwin and
+    /// accept either that or an int on Linux.
+    fn setByteOptionFromJS(this: *UDPSocket, globalObject: *JSGlobalObject, name: anytype, value: u8) JSValue {
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        if (Syscall.setsockopt(this.fd, os.IPPROTO.IP, name, std.mem.asBytes(&value)).asErr()) |err| {
+            globalObject.throwValue(err.toJSC(globalObject));
+            return .zero;
+        }
+
+        return JSValue.jsUndefined();
+    }
+
+    pub fn setMulticastInterface(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const interface = parseAddress(globalObject, argumentsOrUndefined(callframe, 1)[0], 0) orelse return .zero;
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        const result = if (this.isIPv6())
+            Syscall.setsockopt(this.fd, os.IPPROTO.IPV6, IPV6.MULTICAST_IF, std.mem.asBytes(&interface.in6.sa.scope_id))
+        else
+            Syscall.setsockopt(this.fd, os.IPPROTO.IP, IP.MULTICAST_IF, std.mem.asBytes(&interface.in.sa.addr));
+
+        if (result.asErr()) |err| {
+            globalObject.throwValue(err.toJSC(globalObject));
+            return .zero;
+        }
+
+        return JSValue.jsUndefined();
+    }
+
+    pub fn addMembership(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        return this.changeMembership(globalObject, callframe, true);
+    }
+
+    pub fn dropMembership(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        return this.changeMembership(globalObject, callframe, false);
+    }
+
+    fn changeMembership(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame, join: bool) JSValue {
+        const args = argumentsOrUndefined(callframe, 2);
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        const group = parseAddress(globalObject, args[0], 0) orelse return .zero;
+        const interface: ?std.net.Address = if (args[1].isUndefinedOrNull())
+            null
+        else
+            parseAddress(globalObject, args[1], 0) orelse return .zero;
+
+        if ((group.any.family == os.AF.INET6) != this.isIPv6()) {
+            globalObject.throwInvalidArguments("Expected a multicast address of the socket's address family", .{});
+            return .zero;
+        }
+
+        const result = if (this.isIPv6()) brk: {
+            const mreq = extern struct {
+                multiaddr: [16]u8,
+                interface: u32,
+            }{
+                .multiaddr = group.in6.sa.addr,
+                .interface = if (interface) |address| address.in6.sa.scope_id else 0,
+            };
+            break :brk Syscall.setsockopt(this.fd, os.IPPROTO.IPV6, if (join) IPV6.ADD_MEMBERSHIP else IPV6.DROP_MEMBERSHIP, std.mem.asBytes(&mreq));
+        } else brk: {
+            const mreq = extern struct {
+                multiaddr: u32,
+                interface: u32,
+            }{
+                .multiaddr = group.in.sa.addr,
+                // INADDR_ANY lets the kernel pick the interface
+                .interface = if (interface) |address| address.in.sa.addr else 0,
+            };
+            break :brk Syscall.setsockopt(this.fd, os.IPPROTO.IP, if (join) IP.ADD_MEMBERSHIP else IP.DROP_MEMBERSHIP, std.mem.asBytes(&mreq));
+        };
+
+        if (result.asErr()) |err| {
+            globalObject.throwValue(err.toJSC(globalObject));
+            return .zero;
+        }
+
+        return JSValue.jsUndefined();
+    }
+
+    pub fn setRecvBufferSize(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const size = intArgument(globalObject, callframe, 1, std.math.maxInt(c_int)) orelse return .zero;
+        return this.setOptionFromJS(globalObject, os.SOL.SOCKET, os.SO.RCVBUF, size);
+    }
+
+    pub fn setSendBufferSize(this: *UDPSocket, globalObject: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const size = intArgument(globalObject, callframe, 1, std.math.maxInt(c_int)) orelse return .zero;
+        return this.setOptionFromJS(globalObject, os.SOL.SOCKET, os.SO.SNDBUF, size);
+    }
+
+    pub fn getRecvBufferSize(this: *UDPSocket, globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        return this.getIntOptionFromJS(globalObject, os.SO.RCVBUF);
+    }
+
+    pub fn getSendBufferSize(this: *UDPSocket, globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        return this.getIntOptionFromJS(globalObject, os.SO.SNDBUF);
+    }
+
+    fn getIntOptionFromJS(this: *UDPSocket, globalObject: *JSGlobalObject, name: anytype) JSValue {
+        if (this.closed) {
+            globalObject.throw("Socket is closed", .{});
+            return .zero;
+        }
+
+        var value: c_int = 0;
+        switch (Syscall.getsockopt(this.fd, os.SOL.SOCKET, name, std.mem.asBytes(&value))) {
+            .err => |err| {
+                globalObject.throwValue(err.toJSC(globalObject));
+                return .zero;
+            },
+            .result => return JSValue.jsNumber(value),
+        }
+    }
+
+    pub fn ref(this: *UDPSocket, globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (!this.closed) this.poll.enableKeepingProcessAlive(globalObject.bunVM());
+        return JSValue.jsUndefined();
+    }
+
+    pub fn unref(this: *UDPSocket, globalObject: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (!this.closed) this.poll.disableKeepingProcessAlive(globalObject.bunVM());
+        return JSValue.jsUndefined();
+    }
+
+    pub fn close(this: *UDPSocket, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        this.closeAndDetach();
+        return JSValue.jsUndefined();
+    }
+
+    fn closeAndDetach(this: *UDPSocket) void {
+        if (this.closed) return;
+        log("close({d})", .{this.fd});
+        this.closed = true;
+        this.poll.deinitWithVM(this.vm);
+        _ = Syscall.close(this.fd);
+        this.handlers.unprotect();
+        this.has_pending_activity.store(false, .Release);
+    }
+
+    pub fn getAddress(this: *UDPSocket, globalObject: *JSGlobalObject) callconv(.C) JSValue {
+        return addressToJS(this.local_address, globalObject);
+    }
+
+    pub fn getRemoteAddress(this: *UDPSocket, globalObject: *JSGlobalObject) callconv(.C) JSValue {
+        const address = this.remote_address orelse return JSValue.jsUndefined();
+        return addressToJS(address, globalObject);
+    }
+
+    pub fn getClosed(this: *UDPSocket, _: *JSGlobalObject) callconv(.C) JSValue {
+        return JSValue.jsBoolean(this.closed);
+    }
+
+    pub fn finalize(this: *UDPSocket) callconv(.C) void {
+        log("finalize()", .{});
+        this.closeAndDetach();
+        bun.default_allocator.destroy(this);
+    }
+};
@@ -76,6 +76,7 @@ const IOTask = JSC.IOTask;
 const ComptimeStringMap = @import("../../comptime_string_map.zig").ComptimeStringMap;
 
 const TCC = @import("../../tcc.zig");
+const UnboundedQueue = @import("../unbounded_queue.zig").UnboundedQueue;
 
 pub const FFI = struct {
     dylib: ?std.DynLib = null,
@@ -113,6 +114,11 @@ pub const FFI = struct {
             return val;
         }
 
+        if (func.structs.returns != null) {
+            func.deinit(globalThis, allocator);
+            return ZigString.static("JSCallback can't return a struct by value").toErrorInstance(globalThis);
+        }
+
         // TODO: WeakRefHandle that automatically frees it?
         func.base_name = "";
         js_callback.ensureStillAlive();
@@ -380,13 +386,7 @@ pub const FFI = struct {
                 },
                 .compiled => |*compiled| {
                     const str = ZigString.init(bun.asByteSlice(function_name));
-                    const cb = JSC.NewRuntimeFunction(
-                        global,
-                        &str,
-                        @intCast(u32, function.arg_types.items.len),
-                        bun.cast(JSC.JSHostFunctionPtr, compiled.ptr),
-                        false,
-                    );
+                    const cb = function.createJSFunction(global, &str, obj);
                     compiled.js_function = cb;
                     obj.put(global, &str, cb);
                 },
@@ -476,13 +476,7 @@ pub const FFI = struct {
                 .compiled => |*compiled| {
                     const name = &ZigString.init(bun.asByteSlice(function_name));
 
-                    const cb = JSC.NewRuntimeFunction(
-                        global,
-                        name,
-                        @intCast(u32, function.arg_types.items.len),
-                        bun.cast(JSC.JSHostFunctionPtr, compiled.ptr),
-                        false,
-                    );
+                    const cb = function.createJSFunction(global, name, obj);
                     compiled.js_function = cb;
 
                     obj.put(global, name, cb);
@@ -504,6 +498,9 @@ pub const FFI = struct {
         JSC.markBinding(@src());
 
         var abi_types = std.ArrayListUnmanaged(ABIType){};
+        var structs = StructSignature{};
+        // Moved into `function` on success.
+        defer structs.deinit(allocator);
 
         if (value.get(global, "args")) |args| {
             if (args.isEmptyOrUndefinedOrNull() or !args.jsType().isArray()) {
@@ -533,6 +530,18 @@ pub const FFI = struct {
                     }
                 }
 
+                // A struct passed by value arrives from JS as a pointer to its bytes.
+                if (val.isObject()) {
+                    var index: u32 = 0;
+                    if (try generateStructType(global, allocator, val, &structs.types, 0, &index)) |err| {
+                        abi_types.clearAndFree(allocator);
+                        return err;
+                    }
+                    try structs.args.append(allocator, .{ .arg = @intCast(u32, abi_types.items.len), .type = index });
+                    abi_types.appendAssumeCapacity(.ptr);
+                    continue;
+                }
+
                 if (!val.jsType().isStringLike()) {
                     abi_types.clearAndFree(allocator);
                     return ZigString.static("param must be a string (type name) or number").toErrorInstance(global);
@@ -555,6 +564,17 @@ pub const FFI = struct {
             threadsafe = threadsafe_value.toBoolean();
         }
 
+        var blocking = false;
+
+        if (value.get(global, "blocking")) |blocking_value| {
+            blocking = blocking_value.toBoolean();
+        }
+
+        if (blocking and !threadsafe) {
+            abi_types.clearAndFree(allocator);
+            return ZigString.static("\"blocking\" is only supported on threadsafe callbacks").toErrorInstance(global);
+        }
+
         if (value.get(global, "returns")) |ret_value| brk: {
             if (ret_value.isAnyInt()) {
                 const int = ret_value.toInt32();
@@ -570,6 +590,19 @@ pub const FFI = struct {
                 }
             }
 
+            // A struct returned by value is copied into memory the caller
+            // passes as a trailing pointer argument.
+            if (ret_value.isObject()) {
+                var index: u32 = 0;
+                if (try generateStructType(global, allocator, ret_value, &structs.types, 0, &index)) |err| {
+                    abi_types.clearAndFree(allocator);
+                    return err;
+                }
+                structs.returns = index;
+                try abi_types.append(allocator, .ptr);
+                break :brk;
+            }
+
             var ret_slice = ret_value.toSlice(global, allocator);
             defer ret_slice.deinit();
             return_type = ABIType.label.get(ret_slice.slice()) orelse {
@@ -578,9 +611,19 @@ pub const FFI = struct {
             };
         }
 
-        if (function.threadsafe and return_type != ABIType.void) {
+        if (threadsafe and !blocking and return_type != ABIType.void) {
             abi_types.clearAndFree(allocator);
-            return ZigString.static("Threadsafe functions must return void").toErrorInstance(global);
+            return ZigString.static("Threadsafe functions must return void unless \"blocking\" is set").toErrorInstance(global);
+        }
+
+        if (threadsafe and abi_types.items.len > ThreadsafeCallback.max_arguments) {
+            abi_types.clearAndFree(allocator);
+            return ZigString.static("Threadsafe callbacks take at most 32 arguments").toErrorInstance(global);
+        }
+
+        if (threadsafe and structs.args.items.len > 0) {
+            abi_types.clearAndFree(allocator);
+            return ZigString.static("Threadsafe callbacks can't take structs by value").toErrorInstance(global);
         }
 
         function.* = Function{
@@ -588,7 +631,10 @@ pub const FFI = struct {
             .arg_types = abi_types,
             .return_type = return_type,
             .threadsafe = threadsafe,
+            .blocking = blocking,
+            .structs = structs,
         };
+        structs = .{};
 
         if (value.get(global, "ptr")) |ptr| {
             if (ptr.isNumber()) {
@@ -605,6 +651,67 @@ pub const FFI = struct {
 
         return null;
     }
+    /// Deepest nesting of struct fields accepted in a signature.
+    const max_struct_depth = 16;
+
+    /// Declares the struct type `value` (a `bun:ffi` struct type) and the
+    /// structs nested in it, appending them to `types` in dependency order.
+    fn generateStructType(
+        global: *JSGlobalObject,
+        allocator: std.mem.Allocator,
+        value: JSC.JSValue,
+        types: *std.ArrayListUnmanaged(StructType),
+        depth: u32,
+        index: *u32,
+    ) !?JSValue {
+        if (depth > max_struct_depth) {
+            return ZigString.static("Structs are nested too deeply").toErrorInstance(global);
+        }
+
+        const fields_value = value.get(global, "fields") orelse JSValue.jsUndefined();
+        const byte_length = value.get(global, "byteLength") orelse JSValue.jsUndefined();
+        if (!fields_value.jsType().isArray() or !byte_length.isAnyInt()) {
+            return ZigString.static("Expected a type name, a number, or a struct type from struct()").toErrorInstance(global);
+        }
+
+        var iter = fields_value.arrayIterator(global);
+        if (iter.len == 0) {
+            return ZigString.static("Structs must have at least one field").toErrorInstance(global);
+        }
+
+        var fields = try allocator.alloc(StructType.Field, iter.len);
+        var i: usize = 0;
+        while (iter.next()) |field| : (i += 1) {
+            const field_type = (if (field.isObject()) field.get(global, "type") else null) orelse JSValue.jsUndefined();
+
+            if (field_type.isAnyInt()) {
+                const int = field_type.to(i32);
+                if (int >= 0 and int <= ABIType.max and int != @intFromEnum(ABIType.void)) {
+                    fields[i] = .{ .scalar = @enumFromInt(ABIType, int) };
+                    continue;
+                }
+            } else if (field_type.isObject()) {
+                var nested: u32 = 0;
+                if (try generateStructType(global, allocator, field_type, types, depth + 1, &nested)) |err| {
+                    allocator.free(fields);
+                    return err;
+                }
+                fields[i] = .{ .nested = nested };
+                continue;
+            }
+
+            allocator.free(fields);
+            return ZigString.static("Invalid struct field type").toErrorInstance(global);
+        }
+
+        index.* = @intCast(u32, types.items.len);
+        try types.append(allocator, .{
+            .fields = fields,
+            .byte_length = @intCast(u32, @max(byte_length.to(i32), 0)),
+        });
+        return null;
+    }
+
     pub fn generateSymbols(global: *JSGlobalObject, symbols: *bun.StringArrayHashMapUnmanaged(Function), object: JSC.JSValue) !?JSValue {
         JSC.markBinding(@src());
         const allocator = VirtualMachine.get().allocator;
@@ -637,6 +744,294 @@ pub const FFI = struct {
         return null;
     }
 
+    /// A C struct passed or returned by value. TinyCC lays it out from a
+    /// generated `typedef`, the same way the library's compiler did; the
+    /// `byte_length` computed by `struct()` in JS is asserted against it.
+    pub const StructType = struct {
+        fields: []Field,
+        byte_length: u32,
+
+        pub const Field = union(enum) {
+            scalar: ABIType,
+            /// Index of a struct declared before this one.
+            nested: u32,
+        };
+    };
+
+    /// The structs in a signature. Empty for most symbols.
+    pub const StructSignature = struct {
+        types: std.ArrayListUnmanaged(StructType) = .{},
+        /// Arguments passed by value. In `arg_types` these are `.ptr`: JS
+        /// passes a pointer to the struct's bytes and the wrapper copies it.
+        args: std.ArrayListUnmanaged(Arg) = .{},
+        /// When set, `return_type` is `.void` and the last entry in
+        /// `arg_types` is the pointer the result is copied into.
+        returns: ?u32 = null,
+
+        pub const Arg = struct {
+            arg: u32,
+            type: u32,
+        };
+
+        pub fn argument(this: *const StructSignature, i: usize) ?u32 {
+            for (this.args.items) |arg| {
+                if (arg.arg == i) return arg.type;
+            }
+            return null;
+        }
+
+        pub fn deinit(this: *StructSignature, allocator: std.mem.Allocator) void {
+            for (this.types.items) |struct_type| {
+                allocator.free(struct_type.fields);
+            }
+            this.types.clearAndFree(allocator);
+            this.args.clearAndFree(allocator);
+            this.returns = null;
+        }
+    };
+
+    /// The queue behind a `threadsafe` JSCallback.
+    ///
+    /// The generated C function may be called from any thread. It copies its
+    /// arguments into a frame and passes it to `call`, which pushes it onto a
+    /// lock-free queue. The owning event loop drains the queue in batches,
+    /// converting each frame to JS values with a function TinyCC generated
+    /// alongside the callback, so nothing is allocated on the JS heap off
+    /// the JS thread.
+    ///
+    /// In `blocking` mode the caller's thread waits until the JS function has
+    /// returned and its result has been converted back to the C return type.
+    /// A blocking call made on the JS thread itself runs immediately.
+    pub const ThreadsafeCallback = struct {
+        global: *JSGlobalObject,
+        event_loop: *JSC.EventLoop,
+        /// Kept alive by the callback's `FFICallbackFunctionWrapper`.
+        js_function: JSValue,
+        owner: std.Thread.Id,
+        arg_count: u32,
+        blocking: bool = false,
+        read_arguments: ?ReadArguments = null,
+        write_result: ?WriteResult = null,
+
+        queue: Queue = .{},
+        /// Set while `concurrent_task` is queued on the event loop, so a burst
+        /// of calls costs one wakeup instead of one task per call.
+        dispatch_pending: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
+        /// One reference held by JS until `close`, one by a queued drain task,
+        /// and one by each `call` still running on any thread. Whoever drops
+        /// the last one frees the callback on the JS thread.
+        refs: std.atomic.Atomic(u32) = std.atomic.Atomic(u32).init(1),
+        closed: bool = false,
+        /// The compiled trampoline's TinyCC state, handed over by
+        /// `Function.deinit` and deleted along with the last reference, after
+        /// every thread has left the generated code.
+        state: ?*TCC.TCCState = null,
+        task: JSC.AnyTask = undefined,
+        concurrent_task: JSC.ConcurrentTask = .{},
+
+        pub const max_arguments = 32;
+
+        pub const ReadArguments = *const fn (frame: ?*const anyopaque, arguments: [*]JSValue) callconv(.C) void;
+        pub const WriteResult = *const fn (value: JSValue, result: *anyopaque) callconv(.C) void;
+
+        const Queue = UnboundedQueue(Call, .next);
+
+        /// A queued call. Non-blocking calls are heap allocated with a copy of
+        /// the frame right after them; blocking calls live on the caller's
+        /// stack and point at its frame.
+        pub const Call = struct {
+            next: ?*Call = null,
+            frame: ?*const anyopaque = null,
+            allocation: ?[]align(frame_alignment) u8 = null,
+            result: ?*anyopaque = null,
+            done: ?*std.Thread.ResetEvent = null,
+        };
+
+        const frame_alignment = 16;
+        const frame_offset = std.mem.alignForward(usize, @sizeOf(Call), frame_alignment);
+
+        /// How long one wakeup may spend draining the queue before yielding back
+        /// to the event loop, so a producer that never stops cannot starve
+        /// timers and I/O.
+        const drain_budget_ns = 4 * std.time.ns_per_ms;
+        /// Checking the clock on every call would cost more than most callbacks.
+        const drain_clock_interval = 64;
+
+        const DrainTask = JSC.AnyTask.New(ThreadsafeCallback, drain);
+
+        pub fn create(global: *JSGlobalObject, js_function: JSValue, arg_count: u32) *ThreadsafeCallback {
+            var this = bun.default_allocator.create(ThreadsafeCallback) catch unreachable;
+            this.* = .{
+                .global = global,
+                .event_loop = global.bunVM().eventLoop(),
+                .js_function = js_function,
+                .owner = std.Thread.getCurrentId(),
+                .arg_count = arg_count,
+            };
+            this.task = DrainTask.init(this);
+            return this;
+        }
+
+        /// Called by the generated C function, on any thread.
+        pub fn call(this: *ThreadsafeCallback, frame: ?*const anyopaque, frame_size: usize, result: ?*anyopaque) callconv(.C) void {
+            this.ref();
+            defer this.deref();
+
+            if (this.blocking) {
+                if (std.Thread.getCurrentId() == this.owner) {
+                    this.run(frame, result);
+                    return;
+                }
+
+                var done = std.Thread.ResetEvent{};
+                var pending = Call{ .frame = frame, .result = result, .done = &done };
+                this.enqueue(&pending);
+                done.wait();
+                return;
+            }
+
+            var allocation = bun.default_allocator.alignedAlloc(u8, frame_alignment, frame_offset + frame_size) catch unreachable;
+            var pending = @ptrCast(*Call, allocation.ptr);
+            if (frame) |bytes| {
+                @memcpy(allocation[frame_offset..], @ptrCast([*]const u8, bytes)[0..frame_size]);
+            }
+            pending.* = .{ .frame = allocation[frame_offset..].ptr, .allocation = allocation };
+            this.enqueue(pending);
+        }
+
+        fn enqueue(this: *ThreadsafeCallback, pending: *Call) void {
+            this.queue.push(pending);
+            if (this.dispatch_pending.swap(true, .AcqRel)) return;
+            this.dispatch();
+        }
+
+        fn dispatch(this: *ThreadsafeCallback) void {
+            this.ref();
+            this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(&this.task));
+        }
+
+        fn ref(this: *ThreadsafeCallback) void {
+            _ = this.refs.fetchAdd(1, .Monotonic);
+        }
+
+        fn deref(this: *ThreadsafeCallback) void {
+            if (this.refs.fetchSub(1, .AcqRel) != 1) return;
+
+            if (std.Thread.getCurrentId() == this.owner) {
+                this.destroy();
+                return;
+            }
+
+            // The last call to return after `close`. Nothing else can be using
+            // the task now, so reuse it to free the callback on the JS thread.
+            this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(&this.task));
+        }
+
+        /// Drains every queued call, up to the time budget.
+        fn drain(this: *ThreadsafeCallback) void {
+            // A queued drain holds a reference, so none left means `deref`
+            // posted this task to free us.
+            if (this.refs.load(.Acquire) == 0) {
+                this.destroy();
+                return;
+            }
+
+            // Clear before reading: a call queued after this point either gets
+            // drained below or posts a fresh task.
+            this.dispatch_pending.store(false, .Release);
+
+            if (!this.closed) {
+                this.drainQueue();
+            }
+
+            // Closed before this task ran, by the JS function itself, or a call
+            // that was already in flight when `close` ran queued more work.
+            if (this.closed) {
+                while (this.queue.pop()) |pending| {
+                    finish(pending);
+                }
+            }
+
+            this.deref();
+        }
+
+        fn drainQueue(this: *ThreadsafeCallback) void {
+            var timer = std.time.Timer.start() catch null;
+            var count: usize = 0;
+            while (this.queue.pop()) |pending| {
+                this.run(pending.frame, pending.result);
+                finish(pending);
+                count += 1;
+
+                if (this.closed) return;
+
+                if (count % drain_clock_interval != 0) continue;
+                if (timer) |*t| {
+                    if (t.read() >= drain_budget_ns) {
+                        // Out of time. Leave the rest for the next tick.
+                        if (!this.dispatch_pending.swap(true, .AcqRel)) {
+                            this.dispatch();
+                        }
+                        return;
+                    }
+                }
+            }
+        }
+
+        fn run(this: *ThreadsafeCallback, frame: ?*const anyopaque, result: ?*anyopaque) void {
+            // On the stack, so the GC sees values converted before the call.
+            var arguments: [max_arguments]JSValue = undefined;
+            this.read_arguments.?(frame, &arguments);
+
+            // The JS function may close the callback. The caller's reference
+            // keeps `this` alive, but nothing past this point should need it.
+            const global = this.global;
+            const write_result = this.write_result;
+
+            const value = this.js_function.call(global, arguments[0..this.arg_count]);
+            if (value.isAnyError()) {
+                global.bunVM().onUnhandledError(global, value);
+                return;
+            }
+
+            if (write_result) |write| {
+                if (result) |out| write(value, out);
+            }
+        }
+
+        fn finish(pending: *Call) void {
+            if (pending.done) |done| {
+                done.set();
+            } else if (pending.allocation) |allocation| {
+                bun.default_allocator.free(allocation);
+            }
+        }
+
+        /// Drops queued calls. Blocking callers are released with the zeroed
+        /// result their C function started with.
+        ///
+        /// Calls already inside `call` on other threads keep the callback alive
+        /// until they return, but C code must not start new calls once this
+        /// has returned.
+        pub fn close(this: *ThreadsafeCallback) void {
+            this.closed = true;
+            while (this.queue.pop()) |pending| {
+                finish(pending);
+            }
+
+            this.deref();
+        }
+
+        pub fn destroy(this: *ThreadsafeCallback) void {
+            if (this.state) |state| {
+                TCC.tcc_delete(state);
+                this.state = null;
+            }
+
+            bun.default_allocator.destroy(this);
+        }
+    };
+
     pub const Function = struct {
         symbol_from_dynamic_library: ?*anyopaque = null,
         base_name: ?[:0]const u8 = null,
@@ -646,6 +1041,8 @@ pub const FFI = struct {
         arg_types: std.ArrayListUnmanaged(ABIType) = .{},
         step: Step = Step{ .pending = {} },
         threadsafe: bool = false,
+        blocking: bool = false,
+        structs: StructSignature = .{},
 
         pub var lib_dirZ: [*:0]const u8 = "";
 
@@ -661,11 +1058,7 @@ pub const FFI = struct {
             }
 
             val.arg_types.clearAndFree(allocator);
-
-            if (val.state) |state| {
-                TCC.tcc_delete(state);
-                val.state = null;
-            }
+            val.structs.deinit(allocator);
 
             if (val.step == .compiled) {
                 // allocator.free(val.step.compiled.buf);
@@ -675,12 +1068,26 @@ pub const FFI = struct {
                     val.step.compiled.js_function = .zero;
                 }
 
+                // Before the wrapper: it's what keeps the JS function alive.
+                if (val.step.compiled.threadsafe_callback) |threadsafe_callback| {
+                    // Other threads may still be inside the generated code.
+                    threadsafe_callback.state = val.state;
+                    val.state = null;
+                    threadsafe_callback.close();
+                    val.step.compiled.threadsafe_callback = null;
+                }
+
                 if (val.step.compiled.ffi_callback_function_wrapper) |wrapper| {
                     FFICallbackFunctionWrapper_destroy(wrapper);
                     val.step.compiled.ffi_callback_function_wrapper = null;
                 }
             }
 
+            if (val.state) |state| {
+                TCC.tcc_delete(state);
+                val.state = null;
+            }
+
             if (val.step == .failed and val.step.failed.allocated) {
                 allocator.free(val.step.failed.msg);
             }
@@ -690,10 +1097,13 @@ pub const FFI = struct {
             pending: void,
             compiled: struct {
                 ptr: *anyopaque,
+                /// `JSFunctionCallFast`, when the signature allows it. See `canUseDOMJIT`.
+                fast_ptr: ?*anyopaque = null,
                 buf: []u8,
                 js_function: JSValue = JSValue.zero,
                 js_context: ?*anyopaque = null,
                 ffi_callback_function_wrapper: ?*anyopaque = null,
+                threadsafe_callback: ?*ThreadsafeCallback = null,
             },
             failed: struct {
                 msg: []const u8,
@@ -815,6 +1225,9 @@ pub const FFI = struct {
             }
             CompilerRT.inject(state);
             _ = TCC.tcc_add_symbol(state, this.base_name.?, this.symbol_from_dynamic_library.?);
+            if (this.canUseDOMJIT()) {
+                _ = TCC.tcc_add_symbol(state, "Bun__FFI__fastCallPrologue", &Bun__FFI__fastCallPrologue);
+            }
 
             if (this.step == .failed) {
                 return;
@@ -855,11 +1268,72 @@ pub const FFI = struct {
             this.step = .{
                 .compiled = .{
                     .ptr = symbol,
+                    .fast_ptr = if (this.canUseDOMJIT()) TCC.tcc_get_symbol(state, "JSFunctionCallFast") else null,
                     .buf = bytes,
                 },
             };
             return;
         }
+
+        /// Sets up the call frame for a `JSFunctionCallFast` stub, like the
+        /// prologue of any other JIT operation.
+        extern fn Bun__FFI__fastCallPrologue(globalObject: *JSGlobalObject, callFrame: *anyopaque) void;
+
+        extern fn Bun__CreateFFIFunctionWithDOMJITValue(
+            globalObject: *JSGlobalObject,
+            symbolName: *const ZigString,
+            argCount: u32,
+            functionPointer: *const anyopaque,
+            fastFunction: *const anyopaque,
+            thisObject: JSValue,
+            resultType: DOMJITType,
+            argumentTypes: [*]const DOMJITType,
+        ) JSValue;
+
+        /// Whether the DFG/FTL can call this symbol with unboxed arguments,
+        /// skipping the call frame. DOMJIT takes at most 3 arguments.
+        pub fn canUseDOMJIT(this: *const Function) bool {
+            if (this.arg_types.items.len > 3) return false;
+            if (this.structs.types.items.len > 0) return false;
+            if (this.return_type.domjitResult() == null) return false;
+            for (this.arg_types.items) |arg| {
+                if (arg.domjitArgument() == null) return false;
+            }
+            return true;
+        }
+
+        /// Creates the JS function for a compiled symbol that will be a
+        /// method of `this_object`.
+        pub fn createJSFunction(this: *Function, global: *JSGlobalObject, name: *const ZigString, this_object: JSValue) JSValue {
+            const compiled = &this.step.compiled;
+            const arg_count = @intCast(u32, this.arg_types.items.len);
+
+            if (compiled.fast_ptr) |fast_ptr| {
+                var argument_types: [3]DOMJITType = undefined;
+                for (this.arg_types.items, 0..) |arg, i| {
+                    argument_types[i] = arg.domjitArgument().?;
+                }
+
+                return Bun__CreateFFIFunctionWithDOMJITValue(
+                    global,
+                    name,
+                    arg_count,
+                    compiled.ptr,
+                    fast_ptr,
+                    this_object,
+                    this.return_type.domjitResult().?,
+                    &argument_types,
+                );
+            }
+
+            return JSC.NewRuntimeFunction(
+                global,
+                name,
+                arg_count,
+                bun.cast(JSC.JSHostFunctionPtr, compiled.ptr),
+                false,
+            );
+        }
         const CompilerRT = struct {
             noinline fn memset(
                 dest: [*]u8,
@@ -877,6 +1351,19 @@ pub const FFI = struct {
                 @memcpy(dest[0..byte_count], source[0..byte_count]);
             }
 
+            // TinyCC copies structs by value with memmove.
+            noinline fn memmove(
+                dest: [*]u8,
+                source: [*]const u8,
+                byte_count: usize,
+            ) callconv(.C) void {
+                if (@intFromPtr(dest) <= @intFromPtr(source)) {
+                    std.mem.copyForwards(u8, dest[0..byte_count], source[0..byte_count]);
+                } else {
+                    std.mem.copyBackwards(u8, dest[0..byte_count], source[0..byte_count]);
+                }
+            }
+
             pub fn define(state: *TCC.TCCState) void {
                 if (comptime Environment.isX64) {
                     _ = TCC.tcc_define_symbol(state, "NEEDS_COMPILER_RT_FUNCTIONS", "1");
@@ -889,6 +1376,7 @@ pub const FFI = struct {
                 JSC.markBinding(@src());
                 _ = TCC.tcc_add_symbol(state, "memset", &memset);
                 _ = TCC.tcc_add_symbol(state, "memcpy", &memcpy);
+                _ = TCC.tcc_add_symbol(state, "memmove", &memmove);
 
                 _ = TCC.tcc_add_symbol(
                     state,
@@ -930,7 +1418,22 @@ pub const FFI = struct {
             var source_code = std.ArrayList(u8).init(allocator);
             var source_code_writer = source_code.writer();
             var ffi_wrapper = Bun__createFFICallbackFunction(js_context, js_function);
-            try this.printCallbackSourceCode(js_context, ffi_wrapper, &source_code_writer);
+            // A threadsafe callback's C function hands its arguments to the
+            // queue instead of calling into JS.
+            var threadsafe_callback: ?*ThreadsafeCallback = if (is_threadsafe)
+                ThreadsafeCallback.create(js_context, js_function, @intCast(u32, this.arg_types.items.len))
+            else
+                null;
+            defer {
+                if (this.step == .failed) {
+                    if (threadsafe_callback) |callback_| callback_.destroy();
+                }
+            }
+            try this.printCallbackSourceCode(
+                js_context,
+                if (threadsafe_callback) |callback_| @ptrCast(*anyopaque, callback_) else ffi_wrapper,
+                &source_code_writer,
+            );
 
             if (comptime Environment.allow_assert) {
                 debug_write: {
@@ -975,13 +1478,14 @@ pub const FFI = struct {
             }
 
             CompilerRT.inject(state);
+            if (is_threadsafe) {
+                _ = TCC.tcc_add_symbol(state, "FFI_Callback_threadsafe_call", &ThreadsafeCallback.call);
+            }
             _ = TCC.tcc_add_symbol(
                 state,
                 "FFI_Callback_call",
                 // TODO: stage2 - make these ptrs
-                if (is_threadsafe)
-                    FFI_Callback_threadsafe_call
-                else switch (this.arg_types.items.len) {
+                switch (this.arg_types.items.len) {
                     0 => FFI_Callback_call_0,
                     1 => FFI_Callback_call_1,
                     2 => FFI_Callback_call_2,
@@ -1022,6 +1526,22 @@ pub const FFI = struct {
                 return;
             };
 
+            if (threadsafe_callback) |callback_| {
+                const read_arguments = TCC.tcc_get_symbol(state, "my_callback_arguments") orelse {
+                    this.step = .{ .failed = .{ .msg = "missing generated symbol in source code" } };
+                    return;
+                };
+                callback_.read_arguments = bun.cast(ThreadsafeCallback.ReadArguments, read_arguments);
+                if (this.blocking and this.return_type != .void) {
+                    const write_result = TCC.tcc_get_symbol(state, "my_callback_result") orelse {
+                        this.step = .{ .failed = .{ .msg = "missing generated symbol in source code" } };
+                        return;
+                    };
+                    callback_.write_result = bun.cast(ThreadsafeCallback.WriteResult, write_result);
+                }
+                callback_.blocking = this.blocking;
+            }
+
             this.step = .{
                 .compiled = .{
                     .ptr = symbol,
@@ -1029,10 +1549,51 @@ pub const FFI = struct {
                     .js_function = js_function,
                     .js_context = js_context,
                     .ffi_callback_function_wrapper = ffi_wrapper,
+                    .threadsafe_callback = threadsafe_callback,
                 },
             };
         }
 
+        /// Arguments the C function itself takes, not counting the pointer a
+        /// struct result is copied into.
+        fn cArgumentCount(this: *const Function) usize {
+            return this.arg_types.items.len - @intFromBool(this.structs.returns != null);
+        }
+
+        fn printArgumentTypename(this: *const Function, i: usize, writer: anytype) !void {
+            if (this.structs.argument(i)) |index| {
+                try writer.print("BunFFIStruct{d}", .{index});
+            } else {
+                try this.arg_types.items[i].typename(writer);
+            }
+        }
+
+        fn printReturnTypename(this: *const Function, writer: anytype) !void {
+            if (this.structs.returns) |index| {
+                try writer.print("BunFFIStruct{d}", .{index});
+            } else {
+                try this.return_type.typename(writer);
+            }
+        }
+
+        fn printStructDeclarations(this: *const Function, writer: anytype) !void {
+            for (this.structs.types.items, 0..) |struct_type, i| {
+                try writer.writeAll("typedef struct {\n");
+                for (struct_type.fields, 0..) |field, j| {
+                    switch (field) {
+                        .scalar => |abi| try writer.print("  {s} f{d};\n", .{ abi.typenameLabel(), j }),
+                        .nested => |nested| try writer.print("  BunFFIStruct{d} f{d};\n", .{ nested, j }),
+                    }
+                }
+                try writer.print(
+                    \\}} BunFFIStruct{d};
+                    \\_Static_assert(sizeof(BunFFIStruct{d}) == {d}, "struct layout does not match bun:ffi");
+                    \\
+                    \\
+                , .{ i, i, struct_type.byte_length });
+            }
+        }
+
         pub fn printSourceCode(
             this: *Function,
             writer: anytype,
@@ -1062,19 +1623,21 @@ pub const FFI = struct {
                 try writer.writeAll(ffiHeader());
             }
 
+            try this.printStructDeclarations(writer);
+
             // -- Generate the FFI function symbol
             try writer.writeAll("/* --- The Function To Call */\n");
-            try this.return_type.typename(writer);
+            try this.printReturnTypename(writer);
             try writer.writeAll(" ");
             try writer.writeAll(bun.asByteSlice(this.base_name.?));
             try writer.writeAll("(");
             var first = true;
-            for (this.arg_types.items, 0..) |arg, i| {
+            for (0..this.cArgumentCount()) |i| {
                 if (!first) {
                     try writer.writeAll(", ");
                 }
                 first = false;
-                try arg.typename(writer);
+                try this.printArgumentTypename(i, writer);
                 try writer.print(" arg{d}", .{i});
             }
             try writer.writeAll(
@@ -1147,14 +1710,16 @@ pub const FFI = struct {
             var arg_buf: [512]u8 = undefined;
 
             try writer.writeAll("    ");
-            if (!(this.return_type == .void)) {
+            if (this.structs.returns) |index| {
+                try writer.print("*(BunFFIStruct{d}*)JSVALUE_TO_PTR(arg{d}) = ", .{ index, this.arg_types.items.len - 1 });
+            } else if (!(this.return_type == .void)) {
                 try this.return_type.typename(writer);
                 try writer.writeAll(" return_value = ");
             }
             try writer.print("{s}(", .{bun.asByteSlice(this.base_name.?)});
             first = true;
             arg_buf[0..3].* = "arg".*;
-            for (this.arg_types.items, 0..) |arg, i| {
+            for (this.arg_types.items[0..this.cArgumentCount()], 0..) |arg, i| {
                 if (!first) {
                     try writer.writeAll(", ");
                 }
@@ -1163,7 +1728,9 @@ pub const FFI = struct {
 
                 const lengthBuf = std.fmt.bufPrintIntToSlice(arg_buf["arg".len..], i, 10, .lower, .{});
                 const argName = arg_buf[0 .. 3 + lengthBuf.len];
-                if (arg.needsACastInC()) {
+                if (this.structs.argument(i)) |index| {
+                    try writer.print("*(BunFFIStruct{d}*){any}", .{ index, arg.toC(argName) });
+                } else if (arg.needsACastInC()) {
                     try writer.print("{any}", .{arg.toC(argName)});
                 } else {
                     try writer.writeAll(argName);
@@ -1184,6 +1751,48 @@ pub const FFI = struct {
             }
 
             try writer.writeAll(";\n}\n\n");
+
+            if (this.canUseDOMJIT()) {
+                try this.printDOMJITSourceCode(writer);
+            }
+        }
+
+        /// The same call as `JSFunctionCall`, but with the arguments already
+        /// unboxed by the DFG/FTL according to the DOMJIT signature.
+        fn printDOMJITSourceCode(
+            this: *Function,
+            writer: anytype,
+        ) !void {
+            try writer.writeAll(
+                \\/* ---- Unboxed Entry Point For The JIT ---- */
+                \\void Bun__FFI__fastCallPrologue(void* globalObject, void* callFrame);
+                \\ZIG_REPR_TYPE JSFunctionCallFast(void* JS_GLOBAL_OBJECT, void* thisValue
+            );
+            for (this.arg_types.items, 0..) |arg, i| {
+                try writer.print(", {s} arg{d}", .{ arg.domjitArgument().?.typenameLabel(), i });
+            }
+            try writer.writeAll(") {\n    Bun__FFI__fastCallPrologue(JS_GLOBAL_OBJECT, __builtin_frame_address(1));\n    ");
+
+            if (!(this.return_type == .void)) {
+                try this.return_type.typename(writer);
+                try writer.writeAll(" return_value = ");
+            }
+            try writer.print("{s}(", .{bun.asByteSlice(this.base_name.?)});
+            for (this.arg_types.items, 0..) |arg, i| {
+                if (i > 0) {
+                    try writer.writeAll(", ");
+                }
+                try writer.print("({s})arg{d}", .{ arg.typenameLabel(), i });
+            }
+            try writer.writeAll(");\n    return ");
+
+            if (!(this.return_type == .void)) {
+                try writer.print("{any}.asZigRepr", .{this.return_type.toJS("return_value")});
+            } else {
+                try writer.writeAll("ValueUndefined.asZigRepr");
+            }
+
+            try writer.writeAll(";\n}\n\n");
         }
 
         extern fn FFI_Callback_call(*anyopaque, usize, [*]JSValue) JSValue;
@@ -1193,7 +1802,6 @@ pub const FFI = struct {
         extern fn FFI_Callback_call_3(*anyopaque, usize, [*]JSValue) JSValue;
         extern fn FFI_Callback_call_4(*anyopaque, usize, [*]JSValue) JSValue;
         extern fn FFI_Callback_call_5(*anyopaque, usize, [*]JSValue) JSValue;
-        extern fn FFI_Callback_threadsafe_call(*anyopaque, usize, [*]JSValue) JSValue;
         extern fn FFI_Callback_call_6(*anyopaque, usize, [*]JSValue) JSValue;
         extern fn FFI_Callback_call_7(*anyopaque, usize, [*]JSValue) JSValue;
         extern fn Bun__createFFICallbackFunction(*JSC.JSGlobalObject, JSValue) *anyopaque;
@@ -1233,6 +1841,8 @@ pub const FFI = struct {
                 try writer.writeAll(ffiHeader());
             }
 
+            try this.printStructDeclarations(writer);
+
             // -- Generate the FFI function symbol
             try writer.writeAll("\n \n/* --- The Callback Function */\n");
             try writer.writeAll("/* --- The Callback Function */\n");
@@ -1240,27 +1850,31 @@ pub const FFI = struct {
             try writer.writeAll(" my_callback_function");
             try writer.writeAll("(");
             var first = true;
-            for (this.arg_types.items, 0..) |arg, i| {
+            for (0..this.arg_types.items.len) |i| {
                 if (!first) {
                     try writer.writeAll(", ");
                 }
                 first = false;
-                try arg.typename(writer);
+                try this.printArgumentTypename(i, writer);
                 try writer.print(" arg{d}", .{i});
             }
             try writer.writeAll(");\n\n");
 
+            if (this.threadsafe) {
+                try this.printThreadsafeCallbackHelpers(writer);
+            }
+
             first = true;
             try this.return_type.typename(writer);
 
             try writer.writeAll(" my_callback_function");
             try writer.writeAll("(");
-            for (this.arg_types.items, 0..) |arg, i| {
+            for (0..this.arg_types.items.len) |i| {
                 if (!first) {
                     try writer.writeAll(", ");
                 }
                 first = false;
-                try arg.typename(writer);
+                try this.printArgumentTypename(i, writer);
                 try writer.print(" arg{d}", .{i});
             }
             try writer.writeAll(") {\n");
@@ -1271,16 +1885,23 @@ pub const FFI = struct {
                 try writer.writeAll("#endif\n");
             }
 
+            if (this.threadsafe) {
+                return this.printThreadsafeCallbackBody(context_ptr, writer);
+            }
+
             first = true;
 
             if (this.arg_types.items.len > 0) {
                 var arg_buf: [512]u8 = undefined;
                 try writer.print(" ZIG_REPR_TYPE arguments[{d}];\n", .{this.arg_types.items.len});
 
-                arg_buf[0.."arg".len].* = "arg".*;
+                // Structs are handed to JS as a pointer to this frame's copy,
+                // which is only valid for the duration of the call.
+                arg_buf[0.."&arg".len].* = "&arg".*;
                 for (this.arg_types.items, 0..) |arg, i| {
-                    const printed = std.fmt.bufPrintIntToSlice(arg_buf["arg".len..], i, 10, .lower, .{});
-                    const arg_name = arg_buf[0 .. "arg".len + printed.len];
+                    const printed = std.fmt.bufPrintIntToSlice(arg_buf["&arg".len..], i, 10, .lower, .{});
+                    const address_of = arg_buf[0 .. "&arg".len + printed.len];
+                    const arg_name = if (this.structs.argument(i) != null) address_of else address_of[1..];
                     try writer.print("arguments[{d}] = {any}.asZigRepr;\n", .{ i, arg.toJS(arg_name) });
                 }
             }
@@ -1321,6 +1942,93 @@ pub const FFI = struct {
 
             try writer.writeAll(";\n}\n\n");
         }
+
+        /// For threadsafe callbacks: the frame the arguments are copied into,
+        /// and the functions the JS thread uses to convert the frame to JS
+        /// values and, when blocking, the JS result back to C.
+        fn printThreadsafeCallbackHelpers(this: *Function, writer: anytype) !void {
+            if (this.arg_types.items.len > 0) {
+                try writer.writeAll("typedef struct {\n");
+                for (this.arg_types.items, 0..) |arg, i| {
+                    try writer.print("  {s} arg{d};\n", .{ arg.typenameLabel(), i });
+                }
+                try writer.writeAll("} CallbackFrame;\n\n");
+            }
+
+            try writer.writeAll("void my_callback_arguments(const void* frame_ptr, ZIG_REPR_TYPE* arguments) {\n");
+            if (this.arg_types.items.len > 0) {
+                try writer.writeAll("  const CallbackFrame* frame = (const CallbackFrame*)frame_ptr;\n");
+                var arg_buf: [32]u8 = undefined;
+                for (this.arg_types.items, 0..) |arg, i| {
+                    const arg_name = try std.fmt.bufPrint(&arg_buf, "frame->arg{d}", .{i});
+                    try writer.print("  arguments[{d}] = {any}.asZigRepr;\n", .{ i, arg.toJS(arg_name) });
+                }
+            }
+            try writer.writeAll("}\n\n");
+
+            if (this.blocking and this.return_type != .void) {
+                try writer.writeAll(
+                    \\void my_callback_result(ZIG_REPR_TYPE value, void* result) {
+                    \\  EncodedJSValue encoded;
+                    \\  encoded.asZigRepr = value;
+                    \\
+                );
+                try writer.print("  *({s}*)result = {any};\n}}\n\n", .{ this.return_type.typenameLabel(), this.return_type.toCExact("encoded") });
+            }
+        }
+
+        fn printThreadsafeCallbackBody(this: *Function, context_ptr: ?*anyopaque, writer: anytype) !void {
+            const has_frame = this.arg_types.items.len > 0;
+            const has_result = this.blocking and this.return_type != .void;
+
+            if (has_frame) {
+                try writer.writeAll("  CallbackFrame frame = { ");
+                for (0..this.arg_types.items.len) |i| {
+                    if (i > 0) try writer.writeAll(", ");
+                    try writer.print("arg{d}", .{i});
+                }
+                try writer.writeAll(" };\n");
+            }
+
+            if (has_result) {
+                // Returned as-is if the JS function throws or the callback is closed.
+                try writer.print("  {s} result = ({s})0;\n", .{ this.return_type.typenameLabel(), this.return_type.typenameLabel() });
+            }
+
+            try writer.print("  FFI_Callback_threadsafe_call((void*)0x{any}ULL, {s}, {s}, {s});\n", .{
+                bun.fmt.hexIntUpper(@intFromPtr(context_ptr)),
+                if (has_frame) "&frame" else "(void*)0",
+                if (has_frame) "sizeof(frame)" else "0",
+                if (has_result) "&result" else "(void*)0",
+            });
+
+            if (has_result) {
+                try writer.writeAll("  return result;\n");
+            }
+
+            try writer.writeAll("}\n\n");
+        }
+    };
+
+    /// How a value crosses the DOMJIT boundary: the type the DFG/FTL
+    /// speculates and unboxes an argument to, or what a result may be.
+    // Must be kept in sync with FFIDOMJITType in JSFFIFunction.h
+    pub const DOMJITType = enum(u8) {
+        undefined = 0,
+        int32 = 1,
+        int52 = 2,
+        boolean = 3,
+        number = 4,
+        pointer = 5,
+
+        pub fn typenameLabel(this: DOMJITType) []const u8 {
+            return switch (this) {
+                .int32 => "int32_t",
+                .int52 => "int64_t",
+                .boolean => "bool",
+                .undefined, .number, .pointer => unreachable,
+            };
+        }
     };
 
     // Must be kept in sync with JSFFIFunction.h version
@@ -1445,6 +2153,30 @@ pub const FFI = struct {
             break :brk buf;
         };
 
+        /// Floating point arguments have no unboxed DOMJIT representation,
+        /// and 64-bit integers don't always fit in an Int52.
+        pub fn domjitArgument(this: ABIType) ?DOMJITType {
+            return switch (this) {
+                .char, .int8_t, .uint8_t, .int16_t, .uint16_t, .int32_t => .int32,
+                .uint32_t, .ptr => .int52,
+                .bool => .boolean,
+                else => null,
+            };
+        }
+
+        /// 64-bit integer results may need a BigInt, which the unboxed entry
+        /// point can't allocate.
+        pub fn domjitResult(this: ABIType) ?DOMJITType {
+            return switch (this) {
+                .void => .undefined,
+                .char, .int8_t, .uint8_t, .int16_t, .uint16_t, .int32_t => .int32,
+                .bool => .boolean,
+                .uint32_t, .double, .float => .number,
+                .ptr, .cstring => .pointer,
+                else => null,
+            };
+        }
+
         pub fn isFloatingPoint(this: ABIType) bool {
             return switch (this) {
                 .double, .float => true,
@@ -91,6 +91,9 @@ const SendfileContext = struct {
 const DateTime = bun.DateTime;
 const linux = std.os.linux;
 
+/// How much of a request body's Content-Length is allocated up front.
+pub const max_request_body_preallocate_length = 1024 * 256;
+
 const BlobFileContentResult = struct {
     data: [:0]const u8,
     fn init(comptime fieldname: []const u8, js_obj: JSC.JSValue, global: *JSC.JSGlobalObject, exception: JSC.C.ExceptionRef) ?BlobFileContentResult {
@@ -138,6 +141,17 @@ pub const ServerConfig = struct {
 
     inspector: bool = false,
 
+    /// Set SO_REUSEPORT on the listen socket so several processes can accept
+    /// connections on the same port and let the kernel balance between them.
+    reuse_port: bool = true,
+
+    /// Number of threads listening on the port: this one, plus `workers - 1`
+    /// workers that each run the entry point in their own VM. Only the main
+    /// thread starts them.
+    workers: u16 = 1,
+
+    static_routes: std.ArrayListUnmanaged(*StaticRoute) = .{},
+
     pub const SSLConfig = struct {
         server_name: [*c]const u8 = null,
 
@@ -661,6 +675,9 @@ pub const ServerConfig = struct {
             .hostname = "0.0.0.0",
             .development = true,
         };
+        // Static routes own copies of their bodies; every error below must
+        // give them back.
+        defer if (exception.* != null) args.deinitStaticRoutes();
         var has_hostname = false;
         if (strings.eqlComptime(env.get("NODE_ENV") orelse "", "production")) {
             args.development = false;
@@ -747,6 +764,37 @@ pub const ServerConfig = struct {
                 args.development = dev.coerce(bool, global);
             }
 
+            if (arg.get(global, "reusePort")) |reuse_port| {
+                args.reuse_port = reuse_port.coerce(bool, global);
+            }
+
+            if (arg.getTruthy(global, "workers")) |workers| {
+                if (!workers.isNumber()) {
+                    JSC.throwInvalidArguments("Expected workers to be a number", .{}, global, exception);
+                    return args;
+                }
+                args.workers = @intCast(
+                    u16,
+                    @min(
+                        @max(1, workers.coerce(i32, global)),
+                        std.math.maxInt(u16),
+                    ),
+                );
+
+                if (args.workers > 1 and !args.reuse_port) {
+                    JSC.throwInvalidArguments("workers requires reusePort", .{}, global, exception);
+                    return args;
+                }
+
+                // A worker started by this same call on the main thread
+                // listens wherever the main thread ended up, even for port 0.
+                if (arguments.vm.worker) |worker| {
+                    if (worker.serve_port != 0) {
+                        args.port = worker.serve_port;
+                    }
+                }
+            }
+
             if (arg.get(global, "inspector")) |inspector| {
                 args.inspector = inspector.coerce(bool, global);
 
@@ -787,6 +835,34 @@ pub const ServerConfig = struct {
                 }
             }
 
+            if (arg.getTruthy(global, "static")) |static| {
+                if (!static.isObject()) {
+                    JSC.throwInvalidArguments("Expected static to be an object", .{}, global, exception);
+                    if (args.ssl_config) |*conf| {
+                        conf.deinit();
+                    }
+                    return args;
+                }
+
+                var iter = JSC.JSPropertyIterator(.{
+                    .skip_empty_name = true,
+                    .include_value = true,
+                }).init(global, static.asObjectRef());
+                defer iter.deinit();
+
+                args.static_routes.ensureTotalCapacityPrecise(bun.default_allocator, iter.len) catch unreachable;
+
+                while (iter.next()) |path| {
+                    const route = StaticRoute.fromJS(global, path, iter.value, exception) orelse {
+                        if (args.ssl_config) |*conf| {
+                            conf.deinit();
+                        }
+                        return args;
+                    };
+                    args.static_routes.appendAssumeCapacity(route);
+                }
+            }
+
             if (arg.getTruthy(global, "error")) |onError| {
                 if (!onError.isCallable(global.vm())) {
                     JSC.throwInvalidArguments("Expected error to be a function", .{}, global, exception);
@@ -923,6 +999,168 @@ pub const ServerConfig = struct {
 
         return args;
     }
+
+    pub fn deinitStaticRoutes(this: *ServerConfig) void {
+        for (this.static_routes.items) |route| {
+            route.deinit();
+        }
+        this.static_routes.clearAndFree(bun.default_allocator);
+    }
+};
+
+/// A `Response` passed in `Bun.serve({ static })`.
+///
+/// The status line, headers and body are copied out of the `Response` once,
+/// when the server starts. Requests for the route are answered from the uWS
+/// handler and never call into JavaScript.
+pub const StaticRoute = struct {
+    path: [:0]const u8,
+    status_text: []const u8,
+    headers: Headers,
+    content_type: []const u8 = "",
+    etag: []const u8 = "",
+    body: []const u8,
+
+    const log = Output.scoped(.StaticRoute, false);
+
+    pub fn fromJS(global: *JSC.JSGlobalObject, path_str: ZigString, value: JSValue, exception: JSC.C.ExceptionRef) ?*StaticRoute {
+        const allocator = bun.default_allocator;
+        var path_slice = path_str.toSlice(allocator);
+        defer path_slice.deinit();
+        const path = path_slice.slice();
+
+        if (path.len == 0 or path[0] != '/') {
+            JSC.throwInvalidArguments("Static route \"{s}\" must start with \"/\"", .{path}, global, exception);
+            return null;
+        }
+
+        var response = value.as(Response) orelse {
+            JSC.throwInvalidArguments("Static route \"{s}\" must be a Response", .{path}, global, exception);
+            return null;
+        };
+
+        const status_code = response.statusCode();
+        const status_text = HTTPStatusText.get(status_code) orelse {
+            JSC.throwInvalidArguments("Static route \"{s}\" has an unsupported status code {d}", .{ path, status_code }, global, exception);
+            return null;
+        };
+
+        var content_type: []const u8 = "";
+        const body: []const u8 = switch (response.body.value) {
+            .Empty, .Null => "",
+            .InternalBlob => |*blob| brk: {
+                if (blob.was_string) content_type = MimeType.text.value;
+                break :brk allocator.dupe(u8, blob.sliceConst()) catch unreachable;
+            },
+            .WTFStringImpl => |str| brk: {
+                content_type = MimeType.text.value;
+                var utf8 = str.toUTF8(allocator);
+                defer utf8.deinit();
+                break :brk allocator.dupe(u8, utf8.slice()) catch unreachable;
+            },
+            .Blob => |*blob| brk: {
+                content_type = blob.contentType();
+                if (!blob.needsToReadFile()) {
+                    break :brk allocator.dupe(u8, blob.sharedView()) catch unreachable;
+                }
+
+                // Bun.file(): read it once, up front, so that serving it never touches the filesystem.
+                const file_path = blob.getFileName() orelse {
+                    JSC.throwInvalidArguments("Static route \"{s}\" must be a file path, not a file descriptor", .{path}, global, exception);
+                    return null;
+                };
+                const contents = std.fs.cwd().readFileAlloc(allocator, file_path, std.math.maxInt(u32)) catch |err| {
+                    JSC.throwInvalidArguments("Static route \"{s}\" failed to read \"{s}\": {s}", .{ path, file_path, @errorName(err) }, global, exception);
+                    return null;
+                };
+                const offset = @min(@as(usize, blob.offset), contents.len);
+                const size = @min(@as(usize, blob.size), contents.len - offset);
+                if (offset == 0 and size == contents.len) break :brk contents;
+                defer allocator.free(contents);
+                break :brk allocator.dupe(u8, contents[offset..][0..size]) catch unreachable;
+            },
+            else => {
+                JSC.throwInvalidArguments("Static route \"{s}\" must have a buffered body, not a stream", .{path}, global, exception);
+                return null;
+            },
+        };
+
+        var has_etag = false;
+        const headers = brk: {
+            const headers_ref = response.body.init.headers orelse break :brk Headers{ .allocator = allocator };
+            // uWS writes Content-Length itself, so drop anything that would conflict with it.
+            var cloned = headers_ref.cloneThis(global) orelse break :brk Headers{ .allocator = allocator };
+            defer cloned.deref();
+            cloned.fastRemove(.ContentLength);
+            cloned.fastRemove(.TransferEncoding);
+            if (cloned.fastHas(.ContentType)) content_type = "";
+            has_etag = cloned.fastHas(.ETag);
+            break :brk Headers.from(cloned, allocator, .{}) catch unreachable;
+        };
+
+        var route = allocator.create(StaticRoute) catch unreachable;
+        route.* = .{
+            .path = allocator.dupeZ(u8, path) catch unreachable,
+            .status_text = status_text,
+            .headers = headers,
+            .content_type = if (content_type.len > 0) allocator.dupe(u8, content_type) catch unreachable else "",
+            .etag = if (!has_etag and status_code == 200)
+                std.fmt.allocPrint(allocator, "\"{x}\"", .{std.hash.Wyhash.hash(0, body)}) catch unreachable
+            else
+                "",
+            .body = body,
+        };
+        return route;
+    }
+
+    pub fn deinit(this: *StaticRoute) void {
+        const allocator = bun.default_allocator;
+        allocator.free(this.path);
+        this.headers.entries.deinit(allocator);
+        this.headers.buf.deinit(allocator);
+        if (this.content_type.len > 0) allocator.free(this.content_type);
+        if (this.etag.len > 0) allocator.free(this.etag);
+        if (this.body.len > 0) allocator.free(this.body);
+        allocator.destroy(this);
+    }
+
+    fn writeHeaders(this: *const StaticRoute, comptime Resp: type, resp: *Resp) void {
+        const entries = this.headers.entries.slice();
+        const names = entries.items(.name);
+        const values = entries.items(.value);
+        for (names, values) |name, value| {
+            resp.writeHeader(this.headers.asStr(name), this.headers.asStr(value));
+        }
+
+        if (this.content_type.len > 0) resp.writeHeader("content-type", this.content_type);
+        if (this.etag.len > 0) resp.writeHeader("etag", this.etag);
+    }
+
+    pub fn onRequest(this: *const StaticRoute, comptime Resp: type, req: *uws.Request, resp: *Resp) void {
+        log("{s} {s}", .{ req.method(), this.path });
+
+        if (this.etag.len > 0) {
+            if (req.header("if-none-match")) |if_none_match| {
+                if (strings.eql(if_none_match, this.etag)) {
+                    resp.writeStatus("304 Not Modified");
+                    resp.writeHeader("etag", this.etag);
+                    resp.end("", false);
+                    return;
+                }
+            }
+        }
+
+        resp.writeStatus(this.status_text);
+        this.writeHeaders(Resp, resp);
+        resp.end(this.body, false);
+    }
+
+    pub fn onHEADRequest(this: *const StaticRoute, comptime Resp: type, _: *uws.Request, resp: *Resp) void {
+        resp.writeStatus(this.status_text);
+        this.writeHeaders(Resp, resp);
+        resp.writeHeaderInt("content-length", this.body.len);
+        resp.end("", false);
+    }
 };
 
 const HTTPStatusText = struct {
@@ -2917,7 +3155,6 @@ fn NewRequestContext(comptime ssl_enabled: bool, comptime debug_mode: bool, comp
                 .estimated_size = this.request_body_content_len,
             };
         }
-        const max_request_body_preallocate_length = 1024 * 256;
         pub fn onStartBuffering(this: *RequestContext) void {
             ctxLog("onStartBuffering", .{});
             // TODO: check if is someone calling onStartBuffering other than onStartBufferingCallback
@@ -4303,6 +4540,10 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
         poll_ref: JSC.PollRef = .{},
         temporary_url_buffer: std.ArrayListUnmanaged(u8) = .{},
 
+        /// Running workers started for `config.workers`; each one removes
+        /// itself when it exits.
+        workers: std.ArrayListUnmanaged(*JSC.WebWorker) = .{},
+
         flags: packed struct(u3) {
             deinit_scheduled: bool = false,
             terminated: bool = false,
@@ -4332,6 +4573,9 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
                 .publish = .{
                     .rfn = JSC.wrapSync(ThisServer, "publish"),
                 },
+                .publishMany = .{
+                    .rfn = JSC.wrapSync(ThisServer, "publishMany"),
+                },
             },
             .{
                 .port = .{
@@ -4399,6 +4643,55 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
             return .zero;
         }
 
+        /// Publish a batch of `[topic, data]` pairs in one call.
+        ///
+        /// uWS queues each message in its TopicTree and writes everything a
+        /// subscriber received this tick in one go, so the win here is crossing
+        /// from JS into native code once per batch instead of once per message.
+        pub fn publishMany(this: *ThisServer, globalThis: *JSC.JSGlobalObject, messages: JSValue, compress_value: ?JSValue, exception: JSC.C.ExceptionRef) JSValue {
+            if (this.config.websocket == null)
+                return JSValue.jsNumber(0);
+
+            if (!messages.jsType().isArray()) {
+                JSC.throwInvalidArguments("publishMany expects an array of [topic, data] pairs", .{}, globalThis, exception);
+                return .zero;
+            }
+
+            var app = this.app;
+            const compress = (compress_value orelse JSValue.jsBoolean(true)).toBoolean();
+            var published: i32 = 0;
+
+            var iter = messages.arrayIterator(globalThis);
+            while (iter.next()) |entry| {
+                if (!entry.jsType().isArray() or entry.getLength(globalThis) < 2) {
+                    JSC.throwInvalidArguments("publishMany expects an array of [topic, data] pairs", .{}, globalThis, exception);
+                    return .zero;
+                }
+
+                const topic_value = entry.getIndex(globalThis, 0);
+                const message_value = entry.getIndex(globalThis, 1);
+
+                var topic_slice = topic_value.toSlice(globalThis, bun.default_allocator);
+                defer topic_slice.deinit();
+                if (topic_slice.len == 0) {
+                    JSC.JSError(this.vm.allocator, "publishMany requires non-empty topics", .{}, globalThis, exception);
+                    return .zero;
+                }
+
+                const sent = if (message_value.asArrayBuffer(globalThis)) |buffer|
+                    uws.AnyWebSocket.publishWithOptions(ssl_enabled, app, topic_slice.slice(), buffer.slice(), .binary, compress)
+                else brk: {
+                    var string_slice = message_value.toSlice(globalThis, bun.default_allocator);
+                    defer string_slice.deinit();
+                    break :brk uws.AnyWebSocket.publishWithOptions(ssl_enabled, app, topic_slice.slice(), string_slice.slice(), .text, compress);
+                };
+
+                published += @intFromBool(sent);
+            }
+
+            return JSValue.jsNumber(published);
+        }
+
         pub fn onUpgrade(
             this: *ThisServer,
             globalThis: *JSC.JSGlobalObject,
@@ -4569,6 +4862,9 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
             var new_config = ServerConfig.fromJS(ctx, &args_slice, exception);
             if (exception.* != null) return js.JSValueMakeUndefined(ctx);
 
+            // static routes are registered with uWS once, on listen()
+            new_config.deinitStaticRoutes();
+
             // only reload those two
             if (this.config.onRequest != new_config.onRequest) {
                 this.config.onRequest.unprotect();
@@ -4817,6 +5113,9 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
         }
 
         pub fn stop(this: *ThisServer, abrupt: bool) void {
+            for (this.workers.items) |worker| {
+                worker.requestTerminate();
+            }
             this.stopListening(abrupt);
             this.deinitIfWeCan();
         }
@@ -4839,7 +5138,17 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
 
         pub fn deinit(this: *ThisServer) void {
             httplog("deinit", .{});
+            for (this.workers.items) |worker| {
+                worker.serve_workers = null;
+            }
+            this.workers.deinit(bun.default_allocator);
+            if (this.vm.worker) |worker| {
+                if (worker.serve_server) |server| {
+                    if (std.meta.eql(server, this.toAny())) worker.serve_server = null;
+                }
+            }
             this.app.destroy();
+            this.config.deinitStaticRoutes();
             const allocator = this.allocator;
             allocator.destroy(this);
         }
@@ -4948,6 +5257,30 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
 
             this.listener = socket;
             this.vm.uws_event_loop = uws.Loop.get();
+
+            if (this.config.workers > 1) {
+                if (this.vm.worker) |worker| {
+                    if (worker.serve_port != 0 and worker.serve_server == null) {
+                        worker.serve_server = this.toAny();
+                    }
+                } else {
+                    this.startWorkers(@intCast(u16, socket.?.getLocalPort()));
+                }
+            }
+        }
+
+        fn startWorkers(this: *ThisServer, port: u16) void {
+            httplog("startWorkers({d})", .{this.config.workers - 1});
+            this.workers.ensureTotalCapacityPrecise(bun.default_allocator, this.config.workers - 1) catch unreachable;
+            for (1..this.config.workers) |_| {
+                const worker = JSC.WebWorker.spawn(this.globalThis, this.vm.main, port, &this.workers) orelse break;
+                this.workers.appendAssumeCapacity(worker);
+            }
+        }
+
+        fn toAny(this: *ThisServer) AnyServer {
+            const tag = comptime (if (debug_mode) "Debug" else "") ++ (if (ssl_enabled) "SSLServer" else "Server");
+            return @unionInit(AnyServer, tag, this);
         }
 
         pub fn ref(this: *ThisServer) void {
@@ -5176,6 +5509,14 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
             request_object.uws_request = null;
         }
 
+        fn onStaticRequest(route: *StaticRoute, req: *uws.Request, resp: *App.Response) void {
+            route.onRequest(App.Response, req, resp);
+        }
+
+        fn onStaticHEADRequest(route: *StaticRoute, req: *uws.Request, resp: *App.Response) void {
+            route.onHEADRequest(App.Response, req, resp);
+        }
+
         pub fn listen(this: *ThisServer) void {
             httplog("listen", .{});
             if (ssl_enabled) {
@@ -5202,6 +5543,11 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
                 );
             }
 
+            for (this.config.static_routes.items) |route| {
+                this.app.get(route.path, *StaticRoute, route, onStaticRequest);
+                this.app.head(route.path, *StaticRoute, route, onStaticHEADRequest);
+            }
+
             this.app.any("/*", *ThisServer, this, onRequest);
 
             if (comptime debug_mode) {
@@ -5243,7 +5589,10 @@ pub fn NewServer(comptime ssl_enabled_: bool, comptime debug_mode_: bool) type {
             this.app.listenWithConfig(*ThisServer, this, onListen, .{
                 .port = this.config.port,
                 .host = host,
-                .options = 0,
+                .options = if (this.config.reuse_port)
+                    uws.LIBUS_LISTEN_DEFAULT
+                else
+                    uws.LIBUS_LISTEN_EXCLUSIVE_PORT,
             });
         }
     };
@@ -150,4 +150,100 @@ export default [
     construct: true,
     klass: {},
   }),
+  define({
+    name: "UDPSocket",
+    noConstructor: true,
+    JSType: "0b11101110",
+    hasPendingActivity: true,
+    proto: {
+      send: {
+        fn: "send",
+        length: 3,
+      },
+      sendMany: {
+        fn: "sendMany",
+        length: 1,
+      },
+      connect: {
+        fn: "connect",
+        length: 2,
+      },
+      disconnect: {
+        fn: "disconnect",
+        length: 0,
+      },
+      close: {
+        fn: "close",
+        length: 0,
+      },
+
+      ref: {
+        fn: "ref",
+        length: 0,
+      },
+      unref: {
+        fn: "unref",
+        length: 0,
+      },
+
+      setBroadcast: {
+        fn: "setBroadcast",
+        length: 1,
+      },
+      setTTL: {
+        fn: "setTTL",
+        length: 1,
+      },
+      setMulticastTTL: {
+        fn: "setMulticastTTL",
+        length: 1,
+      },
+      setMulticastLoopback: {
+        fn: "setMulticastLoopback",
+        length: 1,
+      },
+      setMulticastInterface: {
+        fn: "setMulticastInterface",
+        length: 1,
+      },
+      addMembership: {
+        fn: "addMembership",
+        length: 2,
+      },
+      dropMembership: {
+        fn: "dropMembership",
+        length: 2,
+      },
+
+      setRecvBufferSize: {
+        fn: "setRecvBufferSize",
+        length: 1,
+      },
+      setSendBufferSize: {
+        fn: "setSendBufferSize",
+        length: 1,
+      },
+      getRecvBufferSize: {
+        fn: "getRecvBufferSize",
+        length: 0,
+      },
+      getSendBufferSize: {
+        fn: "getSendBufferSize",
+        length: 0,
+      },
+
+      address: {
+        getter: "getAddress",
+      },
+      remoteAddress: {
+        getter: "getRemoteAddress",
+      },
+      closed: {
+        getter: "getClosed",
+      },
+    },
+    finalize: true,
+    construct: true,
+    klass: {},
+  }),
 ];
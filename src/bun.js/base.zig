@@ -3358,6 +3358,7 @@ pub const FilePoll = struct {
     const BufferedOutput = Subprocess.BufferedOutput;
     const DNSResolver = JSC.DNS.DNSResolver;
     const GetAddrInfoRequest = JSC.DNS.GetAddrInfoRequest;
+    const UDPSocket = JSC.API.UDPSocket;
     const Deactivated = opaque {
         pub var owner: Owner = Owner.init(@ptrFromInt(*Deactivated, @as(usize, 0xDEADBEEF)));
     };
@@ -3371,6 +3372,7 @@ pub const FilePoll = struct {
         Deactivated,
         DNSResolver,
         GetAddrInfoRequest,
+        UDPSocket,
     });
 
     fn updateFlags(poll: *FilePoll, updated: Flags.Set) void {
@@ -3489,6 +3491,12 @@ pub const FilePoll = struct {
                 loader.onMachportChange();
             },
 
+            @field(Owner.Tag, "UDPSocket") => {
+                log("onUpdate " ++ kqueue_or_epoll ++ " (fd: {d}) UDPSocket", .{poll.fd});
+                var loader: *UDPSocket = ptr.as(UDPSocket);
+                loader.onPoll(poll);
+            },
+
             else => {
                 log("onUpdate " ++ kqueue_or_epoll ++ " (fd: {d}) disconnected?", .{poll.fd});
             },
@@ -19,6 +19,7 @@
 #include "BunClientData.h"
 
 #include "JavaScriptCore/RegularExpression.h"
+#include "wtf/text/StringBuilder.h"
 
 namespace Zig {
 
@@ -334,10 +335,144 @@ extern "C" EncodedJSValue jsFunctionBunPlugin(JSC::JSGlobalObject* globalObject,
     return setupBunPlugin(globalObject, callframe, target);
 }
 
+static bool isRegExpSyntaxCharacter(UChar c)
+{
+    switch (c) {
+    case '^':
+    case '$':
+    case '\\':
+    case '.':
+    case '*':
+    case '+':
+    case '?':
+    case '(':
+    case ')':
+    case '[':
+    case ']':
+    case '{':
+    case '}':
+    case '|':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// If `filter` matches exactly the strings ending in one of a set of literal
+// suffixes, returns those suffixes. That covers a sequence of literals and
+// (a|b) groups anchored with $, optionally preceded by .* - anything else
+// returns an empty Vector and is left to the RegExp.
+static Vector<String> literalSuffixesForFilter(JSC::RegExp* filter)
+{
+    if (filter->ignoreCase() || filter->multiline() || filter->sticky())
+        return {};
+
+    StringView pattern = filter->pattern();
+    if (pattern.startsWith(".*"_s))
+        pattern = pattern.substring(2);
+    if (!pattern.endsWith('$'))
+        return {};
+    pattern = pattern.left(pattern.length() - 1);
+
+    auto readLiteral = [&](size_t& i, StringBuilder& out) -> bool {
+        UChar c = pattern[i];
+        if (c != '\\') {
+            if (isRegExpSyntaxCharacter(c))
+                return false;
+            out.append(c);
+            i++;
+            return true;
+        }
+
+        // \d, \w, \b and friends are classes or assertions, not literals.
+        if (i + 1 >= pattern.length())
+            return false;
+        UChar escaped = pattern[i + 1];
+        if (!isRegExpSyntaxCharacter(escaped) && escaped != '/' && escaped != '-')
+            return false;
+        out.append(escaped);
+        i += 2;
+        return true;
+    };
+
+    Vector<Vector<String>> parts;
+    size_t i = 0;
+    while (i < pattern.length()) {
+        if (pattern[i] != '(') {
+            StringBuilder literal;
+            while (i < pattern.length() && pattern[i] != '(') {
+                if (!readLiteral(i, literal))
+                    return {};
+            }
+            parts.append(Vector<String> { literal.toString() });
+            continue;
+        }
+
+        i++;
+        if (pattern.substring(i).startsWith("?:"_s))
+            i += 2;
+
+        Vector<String> alternatives;
+        StringBuilder alternative;
+        while (true) {
+            if (i >= pattern.length())
+                return {};
+            if (pattern[i] == ')' || pattern[i] == '|') {
+                alternatives.append(alternative.toString());
+                alternative.clear();
+                if (pattern[i++] == ')')
+                    break;
+                continue;
+            }
+            if (!readLiteral(i, alternative))
+                return {};
+        }
+        parts.append(WTFMove(alternatives));
+    }
+
+    static constexpr size_t maxSuffixes = 64;
+    Vector<String> suffixes = { emptyString() };
+    for (auto& alternatives : parts) {
+        if (suffixes.size() * alternatives.size() > maxSuffixes)
+            return {};
+
+        Vector<String> combined;
+        for (auto& prefix : suffixes) {
+            for (auto& alternative : alternatives)
+                combined.append(makeString(prefix, alternative));
+        }
+        suffixes = WTFMove(combined);
+    }
+
+    // Suffixes are indexed by their extension, so each one needs a dot.
+    for (auto& suffix : suffixes) {
+        if (suffix.reverseFind('.') == notFound)
+            return {};
+    }
+
+    return suffixes;
+}
+
 void BunPlugin::Group::append(JSC::VM& vm, JSC::RegExp* filter, JSC::JSFunction* func)
 {
+    unsigned index = filters.size();
     filters.append(JSC::Strong<JSC::RegExp> { vm, filter });
     callbacks.append(JSC::Strong<JSC::JSFunction> { vm, func });
+
+    auto suffixes = literalSuffixesForFilter(filter);
+    if (suffixes.isEmpty()) {
+        regexFilters.append(index);
+        return;
+    }
+
+    for (auto& suffix : suffixes) {
+        auto extension = suffix.substring(suffix.reverseFind('.'));
+        auto& candidates = suffixFilters.add(extension, Vector<SuffixFilter, 1> {}).iterator->value;
+        if (!candidates.isEmpty() && candidates.last().index == index)
+            candidates.last().suffixes.append(WTFMove(suffix));
+        else
+            candidates.append({ index, { WTFMove(suffix) } });
+    }
 }
 
 void BunPlugin::Base::append(JSC::VM& vm, JSC::RegExp* filter, JSC::JSFunction* func, String& namespaceString)
@@ -354,16 +489,73 @@ void BunPlugin::Base::append(JSC::VM& vm, JSC::RegExp* filter, JSC::JSFunction*
     }
 }
 
-JSFunction* BunPlugin::Group::find(JSC::JSGlobalObject* globalObject, String& path)
+template<typename Callback>
+void BunPlugin::Group::forEachMatch(JSC::JSGlobalObject* globalObject, const String& path, const Callback& callback)
 {
-    size_t count = filters.size();
-    for (size_t i = 0; i < count; i++) {
-        if (filters[i].get()->match(globalObject, path, 0)) {
-            return callbacks[i].get();
+    size_t filterCount = filters.size();
+    if (!filterCount)
+        return;
+
+    size_t dot = path.reverseFind('.');
+    auto findCandidates = [&]() -> const Vector<SuffixFilter, 1>* {
+        if (dot == notFound)
+            return nullptr;
+        auto it = suffixFilters.find<StringViewHashTranslator>(StringView(path).substring(dot));
+        return it != suffixFilters.end() ? &it->value : nullptr;
+    };
+    auto* candidates = findCandidates();
+
+    // Both lists are in registration order. Merge them so the filter that
+    // was added first still runs first.
+    size_t candidateIndex = 0;
+    size_t regexIndex = 0;
+    while (true) {
+        bool hasCandidate = candidates && candidateIndex < candidates->size();
+        bool hasRegex = regexIndex < regexFilters.size();
+        if (!hasCandidate && !hasRegex)
+            return;
+
+        unsigned index;
+        bool matched = false;
+        if (hasCandidate && (!hasRegex || candidates->at(candidateIndex).index < regexFilters[regexIndex])) {
+            auto& candidate = candidates->at(candidateIndex++);
+            index = candidate.index;
+            for (auto& suffix : candidate.suffixes) {
+                if (path.endsWith(suffix)) {
+                    matched = true;
+                    break;
+                }
+            }
+        } else {
+            index = regexFilters[regexIndex++];
+            matched = filters[index].get()->match(globalObject, path, 0);
+        }
+
+        if (!matched)
+            continue;
+
+        if (callback(callbacks[index].get()) == IterationStatus::Done)
+            return;
+
+        // The callback may have registered or cleared plugins.
+        if (filters.size() != filterCount) {
+            if (filters.size() < filterCount)
+                return;
+            filterCount = filters.size();
+            candidates = findCandidates();
         }
     }
+}
+
+JSFunction* BunPlugin::Group::find(JSC::JSGlobalObject* globalObject, String& path)
+{
+    JSFunction* found = nullptr;
+    forEachMatch(globalObject, path, [&](JSFunction* function) {
+        found = function;
+        return IterationStatus::Done;
+    });
 
-    return nullptr;
+    return found;
 }
 
 EncodedJSValue BunPlugin::OnLoad::run(JSC::JSGlobalObject* globalObject, BunString* namespaceString, BunString* path)
@@ -435,22 +627,17 @@ EncodedJSValue BunPlugin::OnResolve::run(JSC::JSGlobalObject* globalObject, BunS
         return JSValue::encode(jsUndefined());
     }
     Group& group = *groupPtr;
-    auto& filters = group.filters;
 
-    if (filters.size() == 0) {
+    if (group.filters.size() == 0) {
         return JSValue::encode(jsUndefined());
     }
 
-    auto& callbacks = group.callbacks;
+    EncodedJSValue encodedResult = JSValue::encode(JSC::jsUndefined());
 
     WTF::String pathString = Bun::toWTFString(*path);
-    for (size_t i = 0; i < filters.size(); i++) {
-        if (!filters[i].get()->match(globalObject, pathString, 0)) {
-            continue;
-        }
-        JSC::JSFunction* function = callbacks[i].get();
+    group.forEachMatch(globalObject, pathString, [&](JSC::JSFunction* function) -> IterationStatus {
         if (UNLIKELY(!function)) {
-            continue;
+            return IterationStatus::Continue;
         }
 
         JSC::MarkedArgumentBuffer arguments;
@@ -477,23 +664,26 @@ EncodedJSValue BunPlugin::OnResolve::run(JSC::JSGlobalObject* globalObject, BunS
         if (UNLIKELY(scope.exception())) {
             JSC::Exception* exception = scope.exception();
             scope.clearException();
-            return JSValue::encode(exception);
+            encodedResult = JSValue::encode(exception);
+            return IterationStatus::Done;
         }
 
         if (result.isUndefinedOrNull()) {
-            continue;
+            return IterationStatus::Continue;
         }
 
         if (auto* promise = JSC::jsDynamicCast<JSPromise*>(result)) {
             switch (promise->status(vm)) {
             case JSPromise::Status::Pending: {
                 JSC::throwTypeError(globalObject, throwScope, "onResolve() doesn't support pending promises yet"_s);
-                return JSValue::encode({});
+                encodedResult = JSValue::encode({});
+                return IterationStatus::Done;
             }
             case JSPromise::Status::Rejected: {
                 promise->internalField(JSC::JSPromise::Field::Flags).set(vm, promise, jsNumber(static_cast<unsigned>(JSC::JSPromise::Status::Fulfilled)));
                 result = promise->result(vm);
-                return JSValue::encode(result);
+                encodedResult = JSValue::encode(result);
+                return IterationStatus::Done;
             }
             case JSPromise::Status::Fulfilled: {
                 result = promise->result(vm);
@@ -504,13 +694,16 @@ EncodedJSValue BunPlugin::OnResolve::run(JSC::JSGlobalObject* globalObject, BunS
 
         if (!result.isObject()) {
             JSC::throwTypeError(globalObject, throwScope, "onResolve() expects an object returned"_s);
-            return JSValue::encode({});
+            encodedResult = JSValue::encode({});
+            return IterationStatus::Done;
         }
 
-        RELEASE_AND_RETURN(throwScope, JSValue::encode(result));
-    }
+        throwScope.release();
+        encodedResult = JSValue::encode(result);
+        return IterationStatus::Done;
+    });
 
-    return JSValue::encode(JSC::jsUndefined());
+    return encodedResult;
 }
 
 } // namespace Zig
@@ -28,11 +28,32 @@ public:
 
         void append(JSC::VM& vm, JSC::RegExp* filter, JSC::JSFunction* func);
         JSFunction* find(JSC::JSGlobalObject* globalObj, String& path);
+
+        // Calls `callback` with each filter matching `path`, in the order they
+        // were registered, until it returns IterationStatus::Done.
+        template<typename Callback>
+        void forEachMatch(JSC::JSGlobalObject* globalObject, const String& path, const Callback& callback);
+
         void clear()
         {
             filters.clear();
             callbacks.clear();
+            suffixFilters.clear();
+            regexFilters.clear();
         }
+
+    private:
+        struct SuffixFilter {
+            unsigned index;
+            Vector<String, 1> suffixes;
+        };
+
+        // Most filters are of the form /\.ext$/ or /\.(a|b)$/. Those are
+        // indexed by the extension their suffix ends in, so finding the
+        // candidates for a path is one hash lookup and an endsWith() each.
+        // Every other filter is matched with its RegExp.
+        HashMap<String, Vector<SuffixFilter, 1>> suffixFilters;
+        Vector<unsigned> regexFilters;
     };
 
     class Base {
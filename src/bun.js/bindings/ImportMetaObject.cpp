@@ -46,6 +46,37 @@ namespace Zig {
 using namespace JSC;
 using namespace WebCore;
 
+// require() and require.resolve() tend to resolve the same specifiers from the
+// same file over and over, so CommonJS resolutions are cached on the global.
+// `resolve` is only called on a miss; successful results are remembered.
+template<typename Resolve>
+static JSC::EncodedJSValue resolveRequireCached(JSC::JSGlobalObject* globalObject, JSC::JSValue moduleName, const WTF::String& from, const Resolve& resolve)
+{
+    auto* zigGlobalObject = jsDynamicCast<Zig::GlobalObject*>(globalObject);
+    if (!zigGlobalObject || from.isEmpty() || !moduleName.isString())
+        return resolve();
+
+    JSC::VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    WTF::String specifier = moduleName.toWTFString(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    WTF::String cached = zigGlobalObject->cachedRequireResolution(from, specifier);
+    if (!cached.isNull())
+        return JSC::JSValue::encode(JSC::jsString(vm, cached));
+
+    auto result = resolve();
+    JSC::JSValue resultValue = JSC::JSValue::decode(result);
+    if (resultValue.isString()) {
+        WTF::String resolved = resultValue.toWTFString(globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        zigGlobalObject->cacheRequireResolution(from, specifier, resolved);
+    }
+
+    return result;
+}
+
 static EncodedJSValue functionRequireResolve(JSC::JSGlobalObject* globalObject, JSC::CallFrame* callFrame, const WTF::String& fromStr)
 {
     JSC::VM& vm = globalObject->vm();
@@ -63,8 +94,11 @@ static EncodedJSValue functionRequireResolve(JSC::JSGlobalObject* globalObject,
         JSC::JSValue moduleName = callFrame->argument(0);
 
         auto doIt = [&](const WTF::String& fromStr) -> JSC::EncodedJSValue {
-            BunString from = Bun::toString(fromStr);
-            auto result = Bun__resolveSyncWithSource(globalObject, JSC::JSValue::encode(moduleName), &from, false);
+            auto result = resolveRequireCached(globalObject, moduleName, fromStr, [&] {
+                BunString from = Bun::toString(fromStr);
+                return Bun__resolveSyncWithSource(globalObject, JSC::JSValue::encode(moduleName), &from, false);
+            });
+            RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSValue {}));
 
             if (!JSC::JSValue::decode(result).isString()) {
                 JSC::throwException(globalObject, scope, JSC::JSValue::decode(result));
@@ -379,7 +413,19 @@ extern "C" EncodedJSValue functionImportMeta__resolveSyncPrivate(JSC::JSGlobalOb
 
     RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSC::JSValue {}));
 
-    auto result = Bun__resolveSync(globalObject, JSC::JSValue::encode(moduleName), JSValue::encode(from), isESM);
+    auto resolve = [&] {
+        return Bun__resolveSync(globalObject, JSC::JSValue::encode(moduleName), JSValue::encode(from), isESM);
+    };
+
+    JSC::EncodedJSValue result;
+    if (!isESM && from.isString()) {
+        WTF::String fromStr = from.toWTFString(globalObject);
+        RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSC::JSValue {}));
+        result = resolveRequireCached(globalObject, moduleName, fromStr, resolve);
+        RETURN_IF_EXCEPTION(scope, JSC::JSValue::encode(JSC::JSValue {}));
+    } else {
+        result = resolve();
+    }
 
     if (!JSC::JSValue::decode(result).isString()) {
         JSC::throwException(globalObject, scope, JSC::JSValue::decode(result));
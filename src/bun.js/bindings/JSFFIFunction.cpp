@@ -90,6 +90,74 @@ extern "C" Zig::JSFFIFunction* Bun__CreateFFIFunction(Zig::GlobalObject* globalO
     return Bun__CreateFFIFunctionWithData(globalObject, symbolName, argCount, functionPointer, strong, nullptr);
 }
 
+static JSC::SpeculatedType speculationFor(Zig::FFIDOMJITType type)
+{
+    switch (type) {
+    case Zig::FFIDOMJITType::Undefined:
+        return JSC::SpecOther;
+    case Zig::FFIDOMJITType::Int32:
+        return JSC::SpecInt32Only;
+    case Zig::FFIDOMJITType::Int52:
+        return JSC::SpecInt52Any;
+    case Zig::FFIDOMJITType::Boolean:
+        return JSC::SpecBoolean;
+    case Zig::FFIDOMJITType::Number:
+        return JSC::SpecBytecodeNumber;
+    case Zig::FFIDOMJITType::Pointer:
+        // PTR_TO_JSVALUE() returns null for NULL.
+        return JSC::SpecBytecodeDouble | JSC::SpecOther;
+    }
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+// TinyCC can't construct a JITOperationPrologueCallFrameTracer, so every
+// JSFunctionCallFast stub starts by calling this with its caller's frame,
+// which is what the DOMJIT wrappers in ZigGeneratedCode.cpp do inline.
+extern "C" void Bun__FFI__fastCallPrologue(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame)
+{
+    JSC::VM& vm = JSC::getVM(lexicalGlobalObject);
+    JSC::JITOperationPrologueCallFrameTracer tracer(vm, callFrame);
+}
+
+// Like Bun__CreateFFIFunctionValue(), but also gives the DFG/FTL an unboxed
+// entry point so hot call sites skip the call frame and argument boxing.
+// `thisObject` is the object the function will be a method of; DOMJIT
+// checks `this` against its class.
+extern "C" JSC::EncodedJSValue Bun__CreateFFIFunctionWithDOMJITValue(Zig::GlobalObject* globalObject, const ZigString* symbolName, unsigned argCount, Zig::FFIFunction functionPointer, Zig::FFIDOMJITFunction fastFunction, JSC::EncodedJSValue thisObject, Zig::FFIDOMJITType resultType, const Zig::FFIDOMJITType* argumentTypes)
+{
+    JSC::VM& vm = globalObject->vm();
+    const JSC::ClassInfo* classInfo = JSC::JSValue::decode(thisObject).getObject()->classInfo();
+    auto effect = JSC::DOMJIT::Effect::forReadWrite(JSC::DOMJIT::HeapRange::top(), JSC::DOMJIT::HeapRange::top());
+    auto result = speculationFor(resultType);
+
+    // The executable, and any code compiled against it, keep pointing at the
+    // signature, so it is never freed.
+    const JSC::DOMJIT::Signature* signature = nullptr;
+    switch (argCount) {
+    case 0:
+        signature = new JSC::DOMJIT::Signature(fastFunction, classInfo, effect, result);
+        break;
+    case 1:
+        signature = new JSC::DOMJIT::Signature(fastFunction, classInfo, effect, result,
+            speculationFor(argumentTypes[0]));
+        break;
+    case 2:
+        signature = new JSC::DOMJIT::Signature(fastFunction, classInfo, effect, result,
+            speculationFor(argumentTypes[0]), speculationFor(argumentTypes[1]));
+        break;
+    case 3:
+        signature = new JSC::DOMJIT::Signature(fastFunction, classInfo, effect, result,
+            speculationFor(argumentTypes[0]), speculationFor(argumentTypes[1]), speculationFor(argumentTypes[2]));
+        break;
+    default:
+        // DOMJIT::Signature::maxArguments
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+
+    auto* function = Zig::JSFFIFunction::create(vm, globalObject, argCount, symbolName != nullptr ? Zig::toStringCopy(*symbolName) : String(), functionPointer, JSC::NoIntrinsic, JSC::callHostFunctionAsConstructor, signature);
+    return JSC::JSValue::encode(function);
+}
+
 extern "C" void* Bun__FFIFunction_getDataPtr(JSC::EncodedJSValue jsValue)
 {
 
@@ -149,10 +217,10 @@ void JSFFIFunction::finishCreation(VM& vm, NativeExecutable* executable, unsigne
     ASSERT(inherits(info()));
 }
 
-JSFFIFunction* JSFFIFunction::create(VM& vm, Zig::GlobalObject* globalObject, unsigned length, const String& name, FFIFunction FFIFunction, Intrinsic intrinsic, NativeFunction nativeConstructor)
+JSFFIFunction* JSFFIFunction::create(VM& vm, Zig::GlobalObject* globalObject, unsigned length, const String& name, FFIFunction FFIFunction, Intrinsic intrinsic, NativeFunction nativeConstructor, const JSC::DOMJIT::Signature* signature)
 {
 
-    NativeExecutable* executable = vm.getHostFunction(FFIFunction, ImplementationVisibility::Public, intrinsic, FFIFunction, nullptr, name);
+    NativeExecutable* executable = vm.getHostFunction(FFIFunction, ImplementationVisibility::Public, intrinsic, FFIFunction, signature, name);
 
     Structure* structure = globalObject->FFIFunctionStructure();
     JSFFIFunction* function = new (NotNull, allocateCell<JSFFIFunction>(vm)) JSFFIFunction(vm, executable, globalObject, structure, WTFMove(FFIFunction));
@@ -182,32 +250,6 @@ FFI_Callback_call(FFICallbackFunctionWrapper& wrapper, size_t argCount, JSC::Enc
     return JSC::JSValue::encode(result);
 }
 
-extern "C" void
-FFI_Callback_threadsafe_call(FFICallbackFunctionWrapper& wrapper, size_t argCount, JSC::EncodedJSValue* args)
-{
-
-    auto* globalObject = wrapper.globalObject.get();
-    WTF::Vector<JSC::EncodedJSValue, 8> argsVec;
-    for (size_t i = 0; i < argCount; ++i)
-        argsVec.append(args[i]);
-
-    WebCore::ScriptExecutionContext::postTaskTo(globalObject->scriptExecutionContext()->identifier(), [argsVec = WTFMove(argsVec), wrapper](WebCore::ScriptExecutionContext& ctx) mutable {
-        auto* globalObject = JSC::jsCast<Zig::GlobalObject*>(ctx.jsGlobalObject());
-        auto& vm = globalObject->vm();
-        JSC::MarkedArgumentBuffer arguments;
-        auto* function = wrapper.m_function.get();
-        for (size_t i = 0; i < argsVec.size(); ++i)
-            arguments.appendWithCrashOnOverflow(JSC::JSValue::decode(argsVec[i]));
-        WTF::NakedPtr<JSC::Exception> exception;
-        JSC::call(globalObject, function, JSC::getCallData(function), JSC::jsUndefined(), arguments, exception);
-        if (UNLIKELY(exception)) {
-            auto scope = DECLARE_THROW_SCOPE(vm);
-            scope.throwException(globalObject, exception);
-            return;
-        }
-    });
-}
-
 extern "C" JSC::EncodedJSValue
 FFI_Callback_call_0(FFICallbackFunctionWrapper& wrapper, size_t argCount, JSC::EncodedJSValue* args)
 {
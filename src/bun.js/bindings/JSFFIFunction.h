@@ -14,6 +14,9 @@ class GlobalObject;
 
 namespace JSC {
 class JSGlobalObject;
+namespace DOMJIT {
+class Signature;
+}
 }
 
 namespace Zig {
@@ -22,6 +25,20 @@ using namespace JSC;
 
 using FFIFunction = JSC::EncodedJSValue (*)(JSC::JSGlobalObject* globalObject, JSC::CallFrame* callFrame);
 
+// The unboxed entry point the DFG/FTL calls through a DOMJIT::Signature. The
+// real stub takes the arguments after `thisValue`, already unboxed.
+using FFIDOMJITFunction = JSC::EncodedJSValue (*)(JSC::JSGlobalObject* globalObject, void* thisValue);
+
+// Must be kept in sync with FFI.DOMJITType in ffi.zig
+enum class FFIDOMJITType : uint8_t {
+    Undefined = 0,
+    Int32 = 1,
+    Int52 = 2,
+    Boolean = 3,
+    Number = 4,
+    Pointer = 5,
+};
+
 /**
  * Call a C function with low overhead, modeled after JSC::JSNativeStdFunction
  *
@@ -63,7 +80,7 @@ public:
 
     DECLARE_EXPORT_INFO;
 
-    JS_EXPORT_PRIVATE static JSFFIFunction* create(VM&, Zig::GlobalObject*, unsigned length, const String& name, FFIFunction, Intrinsic = NoIntrinsic, NativeFunction nativeConstructor = callHostFunctionAsConstructor);
+    JS_EXPORT_PRIVATE static JSFFIFunction* create(VM&, Zig::GlobalObject*, unsigned length, const String& name, FFIFunction, Intrinsic = NoIntrinsic, NativeFunction nativeConstructor = callHostFunctionAsConstructor, const JSC::DOMJIT::Signature* = nullptr);
 
     static Structure* createStructure(VM& vm, JSGlobalObject* globalObject, JSValue prototype)
     {
@@ -351,6 +351,18 @@ extern "C" void Bun__onFulfillAsyncModule(
         return promise->reject(promise->globalObject(), exception);
     }
 
+    // Modules transpiled off the JS thread can turn out to be CommonJS
+    if (res->result.value.commonJSExportsLen) {
+        auto created = Bun::createCommonJSModule(jsCast<Zig::GlobalObject*>(globalObject), res->result.value);
+        if (created.has_value()) {
+            return promise->resolve(promise->globalObject(), JSC::JSSourceCode::create(vm, WTFMove(created.value())));
+        }
+
+        auto* exception = scope.exception();
+        scope.clearException();
+        return promise->reject(promise->globalObject(), exception);
+    }
+
     auto provider = Zig::SourceProvider::create(jsDynamicCast<Zig::GlobalObject*>(globalObject), res->result.value);
     promise->resolve(promise->globalObject(), JSC::JSSourceCode::create(vm, JSC::SourceCode(provider)));
 }
@@ -30,6 +30,11 @@
 #include "DOMJITHelpers.h"
 #include <JavaScriptCore/DFGAbstractHeap.h>
 #include <JavaScriptCore/Completion.h>
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/CodeCache.h>
+#include <JavaScriptCore/JSArrayBufferViewInlines.h>
 
 namespace WebCore {
 using namespace JSC;
@@ -39,8 +44,8 @@ public:
     String filename;
     OrdinalNumber lineOffset;
     OrdinalNumber columnOffset;
-    String cachedData;
-    bool produceCachedData;
+    RefPtr<JSC::CachedBytecode> cachedData;
+    bool produceCachedData = false;
     bool importModuleDynamically;
 
     static std::optional<ScriptOptions> fromJS(JSC::JSGlobalObject* globalObject, JSC::JSValue optionsArg, bool& failed)
@@ -77,7 +82,33 @@ public:
                 }
             }
 
-            // TODO: cachedData
+            if (JSValue cachedDataOpt = options->getIfPropertyExists(globalObject, Identifier::fromString(vm, "cachedData"_s))) {
+                if (!cachedDataOpt.isUndefined()) {
+                    auto* view = jsDynamicCast<JSArrayBufferView*>(cachedDataOpt);
+                    if (UNLIKELY(!view)) {
+                        auto scope = DECLARE_THROW_SCOPE(vm);
+                        throwVMTypeError(globalObject, scope, "options.cachedData must be a Buffer, TypedArray, or DataView"_s);
+                        failed = true;
+                        return std::nullopt;
+                    }
+
+                    // Copy it: the view can be detached or modified while the
+                    // script is alive, and JSC decodes lazily.
+                    size_t size = view->byteLength();
+                    auto data = MallocPtr<uint8_t, VMMalloc>::malloc(size);
+                    memcpy(data.get(), view->vector(), size);
+                    opts.cachedData = JSC::CachedBytecode::create(WTFMove(data), size);
+                    any = true;
+                }
+            }
+
+            if (JSValue produceCachedDataOpt = options->getIfPropertyExists(globalObject, Identifier::fromString(vm, "produceCachedData"_s))) {
+                if (produceCachedDataOpt.isBoolean()) {
+                    opts.produceCachedData = produceCachedDataOpt.asBoolean();
+                    any = true;
+                }
+            }
+
             // TODO: importModuleDynamically
         }
 
@@ -87,6 +118,25 @@ public:
     }
 };
 
+static JSUint8Array* createCachedDataBuffer(JSGlobalObject* globalObject, const SourceCode& source)
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::generateProgramBytecode(vm, source, FileSystem::invalidPlatformFileHandle, error);
+    if (UNLIKELY(!cachedBytecode || error.isValid())) {
+        throwVMError(globalObject, scope, error.isValid() ? error.message() : "Failed to create cached data"_s);
+        return nullptr;
+    }
+
+    auto* zigGlobalObject = reinterpret_cast<Zig::GlobalObject*>(globalObject);
+    auto* buffer = JSUint8Array::createUninitialized(globalObject, zigGlobalObject->JSBufferSubclassStructure(), cachedBytecode->size());
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    memcpy(buffer->vector(), cachedBytecode->data(), cachedBytecode->size());
+    return buffer;
+}
+
 static EncodedJSValue
 constructScript(JSGlobalObject* globalObject, CallFrame* callFrame, JSValue newTarget = JSValue())
 {
@@ -122,8 +172,29 @@ constructScript(JSGlobalObject* globalObject, CallFrame* callFrame, JSValue newT
     SourceCode source(
         JSC::StringSourceProvider::create(sourceString, JSC::SourceOrigin(WTF::URL::fileURLWithFileSystemPath(options.filename)), options.filename, TextPosition(options.lineOffset, options.columnOffset)),
         options.lineOffset.zeroBasedInt(), options.columnOffset.zeroBasedInt());
+
+    // Bytecode from another build, another source or a corrupted buffer is
+    // rejected. JSC never consults cached bytecode for eval code, so accepted
+    // data is only reported: the script runs on the same eval path either way.
+    auto cachedDataState = NodeVMScript::CachedDataState::None;
+    if (options.cachedData) {
+        auto key = JSC::sourceCodeKeyForSerializedProgram(vm, source);
+        cachedDataState = JSC::isCachedBytecodeStillValid(vm, *options.cachedData, key, JSC::SourceCodeType::ProgramType)
+            ? NodeVMScript::CachedDataState::Accepted
+            : NodeVMScript::CachedDataState::Rejected;
+    }
+
     RETURN_IF_EXCEPTION(scope, {});
     NodeVMScript* script = NodeVMScript::create(vm, globalObject, structure, source);
+    script->setCachedDataState(cachedDataState);
+
+    if (options.produceCachedData) {
+        auto* cachedData = createCachedDataBuffer(globalObject, script->source());
+        RETURN_IF_EXCEPTION(scope, {});
+        script->putDirect(vm, Identifier::fromString(vm, "cachedData"_s), cachedData);
+        script->putDirect(vm, Identifier::fromString(vm, "cachedDataProduced"_s), jsBoolean(true));
+    }
+
     return JSValue::encode(JSValue(script));
 }
 
@@ -132,6 +203,7 @@ static EncodedJSValue runInContext(JSGlobalObject* globalObject, NodeVMScript* s
     auto& vm = globalObject->vm();
 
     auto throwScope = DECLARE_THROW_SCOPE(vm);
+
     JSC::DirectEvalExecutable* executable = nullptr;
 
     if (JSC::DirectEvalExecutable* existingEval = script->m_cachedDirectExecutable.get()) {
@@ -172,13 +244,32 @@ JSC_DEFINE_HOST_FUNCTION(scriptConstructorConstruct, (JSGlobalObject * globalObj
 JSC_DEFINE_CUSTOM_GETTER(scriptGetCachedDataRejected, (JSGlobalObject * globalObject, EncodedJSValue thisValue, PropertyName))
 {
     auto& vm = globalObject->vm();
-    return JSValue::encode(jsBoolean(true)); // TODO
+    auto* script = jsDynamicCast<NodeVMScript*>(JSValue::decode(thisValue));
+    if (UNLIKELY(!script)) {
+        auto scope = DECLARE_THROW_SCOPE(vm);
+        return throwVMTypeError(globalObject, scope, "Script.prototype.cachedDataRejected getter can only be called on a Script object"_s);
+    }
+
+    switch (script->cachedDataState()) {
+    case NodeVMScript::CachedDataState::Accepted:
+        return JSValue::encode(jsBoolean(false));
+    case NodeVMScript::CachedDataState::Rejected:
+        return JSValue::encode(jsBoolean(true));
+    default:
+        return JSValue::encode(jsUndefined());
+    }
 }
 JSC_DEFINE_HOST_FUNCTION(scriptCreateCachedData, (JSGlobalObject * globalObject, CallFrame* callFrame))
 {
     auto& vm = globalObject->vm();
     auto scope = DECLARE_THROW_SCOPE(vm);
-    return throwVMError(globalObject, scope, "TODO: Script.createCachedData"_s);
+
+    auto* script = jsDynamicCast<NodeVMScript*>(callFrame->thisValue());
+    if (UNLIKELY(!script)) {
+        return throwVMTypeError(globalObject, scope, "Script.prototype.createCachedData can only be called on a Script object"_s);
+    }
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(createCachedDataBuffer(globalObject, script->source())));
 }
 
 JSC_DEFINE_HOST_FUNCTION(scriptRunInContext, (JSGlobalObject * globalObject, CallFrame* callFrame))
@@ -61,11 +61,22 @@ public:
 
     const JSC::SourceCode& source() const { return m_source; }
 
+    // Whether `cachedData` was passed to the constructor and, if so, whether
+    // JSC accepted it for this source.
+    enum class CachedDataState : uint8_t {
+        None,
+        Accepted,
+        Rejected,
+    };
+    CachedDataState cachedDataState() const { return m_cachedDataState; }
+    void setCachedDataState(CachedDataState state) { m_cachedDataState = state; }
+
     DECLARE_VISIT_CHILDREN;
     mutable WriteBarrier<JSC::DirectEvalExecutable> m_cachedDirectExecutable;
 
 private:
     JSC::SourceCode m_source;
+    CachedDataState m_cachedDataState { CachedDataState::None };
 
     NodeVMScript(JSC::VM& vm, JSC::Structure* structure, JSC::SourceCode source)
         : Base(vm, structure)
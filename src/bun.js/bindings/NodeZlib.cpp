@@ -0,0 +1,788 @@
+#include "root.h"
+
+#include "NodeZlib.h"
+
+#include "JavaScriptCore/JSArrayBufferViewInlines.h"
+#include "JavaScriptCore/JSDestructibleObjectHeapCellType.h"
+#include "JavaScriptCore/ObjectConstructor.h"
+#include "JavaScriptCore/SubspaceInlines.h"
+#include "JSDOMExceptionHandling.h"
+#include "ScriptExecutionContext.h"
+
+#include <wtf/NumberOfCores.h>
+#include <wtf/Scope.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/WorkQueue.h>
+
+#include <zlib.h>
+
+extern "C" void Bun__refActiveTask(JSC::JSGlobalObject*);
+extern "C" void Bun__unrefActiveTask(JSC::JSGlobalObject*);
+
+namespace WebCore {
+using namespace JSC;
+
+static constexpr uint8_t gzipHeaderID1 = 0x1f;
+static constexpr uint8_t gzipHeaderID2 = 0x8b;
+
+// Port of the zlib half of Node's src/node_zlib.cc. The stream is only touched
+// by one thread at a time: process() runs on a work queue while a write is in
+// progress, and everything else runs on the JS thread in between.
+class NodeZlibContext : public ThreadSafeRefCounted<NodeZlibContext> {
+public:
+    // Values match the mode constants exported by node:zlib's binding.
+    enum class Mode : uint8_t {
+        None,
+        Deflate,
+        Inflate,
+        Gzip,
+        Gunzip,
+        DeflateRaw,
+        InflateRaw,
+        Unzip,
+    };
+
+    static Ref<NodeZlibContext> create(Mode mode) { return adoptRef(*new NodeZlibContext(mode)); }
+
+    ~NodeZlibContext()
+    {
+        m_writeInProgress = false;
+        close();
+    }
+
+    Mode mode() const { return m_mode; }
+    bool initDone() const { return m_initDone; }
+    bool writeInProgress() const { return m_writeInProgress; }
+    bool pendingClose() const { return m_pendingClose; }
+    int error() const { return m_err; }
+    uint32_t availIn() const { return m_strm.avail_in; }
+    uint32_t availOut() const { return m_strm.avail_out; }
+
+    // Each of these returns a null message on success.
+    ASCIILiteral init(int windowBits, int level, int memLevel, int strategy, Vector<uint8_t>&& dictionary)
+    {
+        m_initDone = true;
+        m_level = level;
+        m_windowBits = windowBits;
+        m_memLevel = memLevel;
+        m_strategy = strategy;
+        m_flush = Z_NO_FLUSH;
+        m_err = Z_OK;
+        m_dictionary = WTFMove(dictionary);
+
+        if (m_mode == Mode::Gzip || m_mode == Mode::Gunzip)
+            m_windowBits += 16;
+        if (m_mode == Mode::Unzip)
+            m_windowBits += 32;
+        if (m_mode == Mode::DeflateRaw || m_mode == Mode::InflateRaw)
+            m_windowBits *= -1;
+
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::Gzip:
+        case Mode::DeflateRaw:
+            m_err = deflateInit2(&m_strm, m_level, Z_DEFLATED, m_windowBits, m_memLevel, m_strategy);
+            break;
+        case Mode::Inflate:
+        case Mode::Gunzip:
+        case Mode::InflateRaw:
+        case Mode::Unzip:
+            m_err = inflateInit2(&m_strm, m_windowBits);
+            break;
+        case Mode::None:
+            RELEASE_ASSERT_NOT_REACHED();
+        }
+
+        if (m_err != Z_OK) {
+            m_dictionary.clear();
+            m_mode = Mode::None;
+            return "Init error"_s;
+        }
+
+        return setDictionary();
+    }
+
+    ASCIILiteral params(int level, int strategy)
+    {
+        m_err = Z_OK;
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::DeflateRaw:
+            m_err = deflateParams(&m_strm, level, strategy);
+            break;
+        default:
+            break;
+        }
+
+        if (m_err != Z_OK && m_err != Z_BUF_ERROR)
+            return "Failed to set parameters"_s;
+        return {};
+    }
+
+    ASCIILiteral reset()
+    {
+        m_err = Z_OK;
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::DeflateRaw:
+        case Mode::Gzip:
+            m_err = deflateReset(&m_strm);
+            break;
+        case Mode::Inflate:
+        case Mode::InflateRaw:
+        case Mode::Gunzip:
+            m_err = inflateReset(&m_strm);
+            break;
+        default:
+            break;
+        }
+
+        if (m_err != Z_OK)
+            return "Failed to reset stream"_s;
+        return setDictionary();
+    }
+
+    void close()
+    {
+        if (m_writeInProgress) {
+            m_pendingClose = true;
+            return;
+        }
+
+        m_pendingClose = false;
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::Gzip:
+        case Mode::DeflateRaw:
+            deflateEnd(&m_strm);
+            break;
+        case Mode::Inflate:
+        case Mode::Gunzip:
+        case Mode::InflateRaw:
+        case Mode::Unzip:
+            inflateEnd(&m_strm);
+            break;
+        case Mode::None:
+            break;
+        }
+        m_mode = Mode::None;
+        m_dictionary.clear();
+    }
+
+    void beginWrite(int flush, const uint8_t* input, uint32_t inputLength, uint8_t* output, uint32_t outputLength)
+    {
+        m_writeInProgress = true;
+        m_flush = flush;
+        m_strm.next_in = const_cast<Bytef*>(input);
+        m_strm.avail_in = inputLength;
+        m_strm.next_out = output;
+        m_strm.avail_out = outputLength;
+    }
+
+    void endWrite() { m_writeInProgress = false; }
+
+    // Runs deflate()/inflate() over the buffers from beginWrite(). Safe to call
+    // off the JS thread.
+    void process()
+    {
+        const Bytef* nextExpectedHeaderByte = nullptr;
+
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::Gzip:
+        case Mode::DeflateRaw:
+            m_err = deflate(&m_strm, m_flush);
+            break;
+        case Mode::Unzip:
+            if (m_strm.avail_in > 0)
+                nextExpectedHeaderByte = m_strm.next_in;
+
+            switch (m_gzipIDBytesRead) {
+            case 0:
+                if (!nextExpectedHeaderByte)
+                    break;
+
+                if (*nextExpectedHeaderByte == gzipHeaderID1) {
+                    m_gzipIDBytesRead = 1;
+                    nextExpectedHeaderByte++;
+
+                    // The only available byte was already read.
+                    if (m_strm.avail_in == 1)
+                        break;
+                } else {
+                    m_mode = Mode::Inflate;
+                    break;
+                }
+                [[fallthrough]];
+            case 1:
+                if (!nextExpectedHeaderByte)
+                    break;
+
+                if (*nextExpectedHeaderByte == gzipHeaderID2) {
+                    m_gzipIDBytesRead = 2;
+                    m_mode = Mode::Gunzip;
+                } else {
+                    m_mode = Mode::Inflate;
+                }
+                break;
+            default:
+                RELEASE_ASSERT_NOT_REACHED();
+            }
+            [[fallthrough]];
+        case Mode::Inflate:
+        case Mode::Gunzip:
+        case Mode::InflateRaw:
+            m_err = inflate(&m_strm, m_flush);
+
+            // Raw streams get their dictionary up front in setDictionary().
+            if (m_mode != Mode::InflateRaw && m_err == Z_NEED_DICT && !m_dictionary.isEmpty()) {
+                m_err = inflateSetDictionary(&m_strm, m_dictionary.data(), m_dictionary.size());
+                if (m_err == Z_OK)
+                    m_err = inflate(&m_strm, m_flush);
+                else if (m_err == Z_DATA_ERROR)
+                    m_err = Z_NEED_DICT;
+            }
+
+            // Bytes left over after the end of a gzip member are either another
+            // member of the same file or trailing garbage; keep going if it
+            // doesn't look like padding.
+            while (m_strm.avail_in > 0 && m_mode == Mode::Gunzip && m_err == Z_STREAM_END && m_strm.next_in[0] != 0x00) {
+                reset();
+                m_err = inflate(&m_strm, m_flush);
+            }
+            break;
+        case Mode::None:
+            RELEASE_ASSERT_NOT_REACHED();
+        }
+    }
+
+    // Returns the message to pass to onerror() if the last process() failed.
+    String checkError() const
+    {
+        switch (m_err) {
+        case Z_OK:
+        case Z_BUF_ERROR:
+            if (m_strm.avail_out != 0 && m_flush == Z_FINISH)
+                return errorMessage("unexpected end of file"_s);
+            return {};
+        case Z_STREAM_END:
+            return {};
+        case Z_NEED_DICT:
+            return errorMessage(m_dictionary.isEmpty() ? "Missing dictionary"_s : "Bad dictionary"_s);
+        default:
+            return errorMessage("Zlib error"_s);
+        }
+    }
+
+    String errorMessage(ASCIILiteral fallback) const
+    {
+        if (m_strm.msg)
+            return String::fromLatin1(m_strm.msg);
+        return fallback;
+    }
+
+private:
+    NodeZlibContext(Mode mode)
+        : m_mode(mode)
+    {
+        memset(&m_strm, 0, sizeof(m_strm));
+    }
+
+    ASCIILiteral setDictionary()
+    {
+        if (m_dictionary.isEmpty())
+            return {};
+
+        m_err = Z_OK;
+        switch (m_mode) {
+        case Mode::Deflate:
+        case Mode::DeflateRaw:
+            m_err = deflateSetDictionary(&m_strm, m_dictionary.data(), m_dictionary.size());
+            break;
+        case Mode::InflateRaw:
+            m_err = inflateSetDictionary(&m_strm, m_dictionary.data(), m_dictionary.size());
+            break;
+        default:
+            break;
+        }
+
+        if (m_err != Z_OK)
+            return "Failed to set dictionary"_s;
+        return {};
+    }
+
+    z_stream m_strm;
+    Vector<uint8_t> m_dictionary;
+    Mode m_mode;
+    int m_err { Z_OK };
+    int m_flush { Z_NO_FLUSH };
+    int m_level { 0 };
+    int m_windowBits { 0 };
+    int m_memLevel { 0 };
+    int m_strategy { 0 };
+    unsigned m_gzipIDBytesRead { 0 };
+    bool m_initDone { false };
+    bool m_writeInProgress { false };
+    bool m_pendingClose { false };
+};
+
+// Async writes are spread over a few shared queues, started on demand. A
+// handle never has more than one write in flight, so it doesn't matter which
+// queue picks it up.
+static constexpr unsigned maxZlibWorkQueueCount = 8;
+
+static WorkQueue& zlibWorkQueue()
+{
+    static Lock lock;
+    static NeverDestroyed<Vector<Ref<WorkQueue>>> workQueues;
+    static unsigned nextWorkQueue = 0;
+    static unsigned workQueueCount = std::clamp(static_cast<unsigned>(WTF::numberOfProcessorCores()), 1u, maxZlibWorkQueueCount);
+
+    Locker locker { lock };
+    unsigned index = nextWorkQueue++ % workQueueCount;
+    if (index == workQueues->size())
+        workQueues->append(WorkQueue::create("bun.zlib"));
+    return workQueues.get()[index].get();
+}
+
+static void emitError(JSGlobalObject* globalObject, NodeZlib* handle, const String& message)
+{
+    auto& vm = globalObject->vm();
+    auto& context = handle->context();
+
+    JSValue onerror = handle->get(globalObject, Identifier::fromString(vm, "onerror"_s));
+    if (auto callData = JSC::getCallData(onerror); callData.type != CallData::Type::None) {
+        MarkedArgumentBuffer args;
+        args.append(jsString(vm, message));
+        args.append(jsNumber(context.error()));
+        JSC::call(globalObject, onerror, callData, handle, args);
+    }
+
+    context.endWrite();
+    if (context.pendingClose())
+        context.close();
+}
+
+struct WriteArguments {
+    int flush;
+    const uint8_t* input;
+    uint32_t inputLength;
+    uint8_t* output;
+    uint32_t outputLength;
+    RefPtr<ArrayBuffer> inputBuffer;
+    RefPtr<ArrayBuffer> outputBuffer;
+};
+
+static JSArrayBufferView* validateBufferRange(JSGlobalObject* globalObject, ThrowScope& scope, JSValue value, JSValue offsetValue, JSValue lengthValue, ASCIILiteral name, size_t& offset, size_t& length)
+{
+    auto* view = jsDynamicCast<JSArrayBufferView*>(value);
+    if (UNLIKELY(!view || view->isDetached())) {
+        throwTypeError(globalObject, scope, makeString(name, " must be a TypedArray"_s));
+        return nullptr;
+    }
+
+    offset = offsetValue.toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    length = lengthValue.toUInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+
+    if (UNLIKELY(offset > view->byteLength() || length > view->byteLength() - offset)) {
+        throwRangeError(globalObject, scope, makeString(name, " offset and length are out of bounds"_s));
+        return nullptr;
+    }
+    return view;
+}
+
+// write(flush, in, in_off, in_len, out, out_off, out_len)
+static std::optional<WriteArguments> writeArguments(JSGlobalObject* globalObject, CallFrame* callFrame, NodeZlib* handle, bool async)
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    auto& context = handle->context();
+
+    if (UNLIKELY(!context.initDone())) {
+        throwVMError(globalObject, scope, "write before init"_s);
+        return std::nullopt;
+    }
+    // The thread pool owns the stream state while an async write runs, so
+    // nothing else on the context may be read until it has finished.
+    if (UNLIKELY(context.writeInProgress())) {
+        throwVMError(globalObject, scope, "write already in progress"_s);
+        return std::nullopt;
+    }
+    if (UNLIKELY(context.mode() == NodeZlibContext::Mode::None)) {
+        throwVMError(globalObject, scope, "already finalized"_s);
+        return std::nullopt;
+    }
+    if (UNLIKELY(context.pendingClose())) {
+        throwVMError(globalObject, scope, "close is pending"_s);
+        return std::nullopt;
+    }
+
+    int flush = callFrame->argument(0).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, std::nullopt);
+    if (UNLIKELY(flush != Z_NO_FLUSH && flush != Z_PARTIAL_FLUSH && flush != Z_SYNC_FLUSH && flush != Z_FULL_FLUSH && flush != Z_FINISH && flush != Z_BLOCK)) {
+        throwVMError(globalObject, scope, "Invalid flush value"_s);
+        return std::nullopt;
+    }
+
+    WriteArguments arguments;
+    arguments.flush = flush;
+
+    size_t offset = 0;
+    size_t length = 0;
+    JSValue inputValue = callFrame->argument(1);
+    if (inputValue.isUndefinedOrNull()) {
+        arguments.input = nullptr;
+        arguments.inputLength = 0;
+    } else {
+        auto* input = validateBufferRange(globalObject, scope, inputValue, callFrame->argument(2), callFrame->argument(3), "input"_s, offset, length);
+        RETURN_IF_EXCEPTION(scope, std::nullopt);
+        if (async) {
+            // The work queue reads straight out of the buffer, so keep it
+            // from being freed or transferred until the write finishes.
+            arguments.inputBuffer = input->possiblySharedBuffer();
+            arguments.inputBuffer->pin();
+        }
+        arguments.input = static_cast<const uint8_t*>(input->vector()) + offset;
+        arguments.inputLength = length;
+    }
+
+    auto* output = validateBufferRange(globalObject, scope, callFrame->argument(4), callFrame->argument(5), callFrame->argument(6), "output"_s, offset, length);
+    RETURN_IF_EXCEPTION(scope, std::nullopt);
+    if (async) {
+        arguments.outputBuffer = output->possiblySharedBuffer();
+        arguments.outputBuffer->pin();
+    }
+    arguments.output = static_cast<uint8_t*>(output->vector()) + offset;
+    arguments.outputLength = length;
+
+    return arguments;
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibWriteSync, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.writeSync can only be called on a Zlib handle"_s);
+
+    auto arguments = writeArguments(globalObject, callFrame, handle, false);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    auto& context = handle->context();
+    context.beginWrite(arguments->flush, arguments->input, arguments->inputLength, arguments->output, arguments->outputLength);
+    context.process();
+
+    if (auto message = context.checkError(); !message.isNull()) {
+        emitError(globalObject, handle, message);
+        RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+    }
+
+    context.endWrite();
+
+    MarkedArgumentBuffer result;
+    result.append(jsNumber(context.availIn()));
+    result.append(jsNumber(context.availOut()));
+    RELEASE_AND_RETURN(scope, JSValue::encode(constructArray(globalObject, static_cast<ArrayAllocationProfile*>(nullptr), result)));
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibWrite, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.write can only be called on a Zlib handle"_s);
+
+    auto arguments = writeArguments(globalObject, callFrame, handle, true);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    Ref<NodeZlibContext> context = handle->context();
+    context->beginWrite(arguments->flush, arguments->input, arguments->inputLength, arguments->output, arguments->outputLength);
+
+    // The handle is kept alive, and the process with it, until the result
+    // has been delivered back on this thread.
+    gcProtect(handle);
+    Bun__refActiveTask(globalObject);
+
+    auto contextIdentifier = jsCast<Zig::GlobalObject*>(globalObject)->scriptExecutionContext()->identifier();
+    zlibWorkQueue().dispatch([context = WTFMove(context), handle, inputBuffer = WTFMove(arguments->inputBuffer), outputBuffer = WTFMove(arguments->outputBuffer), contextIdentifier]() mutable {
+        context->process();
+
+        ScriptExecutionContext::postTaskTo(contextIdentifier, [context = WTFMove(context), handle, inputBuffer = WTFMove(inputBuffer), outputBuffer = WTFMove(outputBuffer)](ScriptExecutionContext& scriptContext) mutable {
+            auto* globalObject = scriptContext.jsGlobalObject();
+            auto& vm = globalObject->vm();
+            auto catchScope = DECLARE_CATCH_SCOPE(vm);
+
+            if (inputBuffer)
+                inputBuffer->unpin();
+            outputBuffer->unpin();
+            Bun__unrefActiveTask(globalObject);
+            auto unprotect = makeScopeExit([handle] { gcUnprotect(handle); });
+
+            if (auto message = context->checkError(); !message.isNull()) {
+                emitError(globalObject, handle, message);
+            } else {
+                context->endWrite();
+
+                JSValue callback = handle->get(globalObject, Identifier::fromString(vm, "callback"_s));
+                if (!catchScope.exception()) {
+                    if (auto callData = JSC::getCallData(callback); callData.type != CallData::Type::None) {
+                        MarkedArgumentBuffer args;
+                        args.append(jsNumber(context->availIn()));
+                        args.append(jsNumber(context->availOut()));
+                        JSC::call(globalObject, callback, callData, handle, args);
+                    }
+                }
+
+                // The callback may have started the next write already.
+                if (context->pendingClose() && !context->writeInProgress())
+                    context->close();
+            }
+
+            if (auto* exception = catchScope.exception()) {
+                catchScope.clearException();
+                reportException(globalObject, exception);
+            }
+        });
+    });
+
+    return JSValue::encode(handle);
+}
+
+// init(windowBits, level, memLevel, strategy, [dictionary])
+JSC_DEFINE_HOST_FUNCTION(zlibInit, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.init can only be called on a Zlib handle"_s);
+
+    int windowBits = callFrame->argument(0).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    int level = callFrame->argument(1).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    int memLevel = callFrame->argument(2).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    int strategy = callFrame->argument(3).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    if (UNLIKELY(windowBits < 8 || windowBits > 15))
+        return throwVMRangeError(globalObject, scope, "invalid windowBits"_s);
+    if (UNLIKELY(level < -1 || level > 9))
+        return throwVMRangeError(globalObject, scope, "invalid compression level"_s);
+    if (UNLIKELY(memLevel < 1 || memLevel > 9))
+        return throwVMRangeError(globalObject, scope, "invalid memlevel"_s);
+    if (UNLIKELY(strategy != Z_FILTERED && strategy != Z_HUFFMAN_ONLY && strategy != Z_RLE && strategy != Z_FIXED && strategy != Z_DEFAULT_STRATEGY))
+        return throwVMRangeError(globalObject, scope, "invalid strategy"_s);
+
+    Vector<uint8_t> dictionary;
+    JSValue dictionaryValue = callFrame->argument(4);
+    if (!dictionaryValue.isUndefinedOrNull()) {
+        auto* view = jsDynamicCast<JSArrayBufferView*>(dictionaryValue);
+        if (UNLIKELY(!view || view->isDetached()))
+            return throwVMTypeError(globalObject, scope, "dictionary must be a TypedArray"_s);
+        dictionary.append(static_cast<const uint8_t*>(view->vector()), view->byteLength());
+    }
+
+    if (auto message = handle->context().init(windowBits, level, memLevel, strategy, WTFMove(dictionary)); !message.isNull())
+        emitError(globalObject, handle, handle->context().errorMessage(message));
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+}
+
+// params(level, strategy)
+JSC_DEFINE_HOST_FUNCTION(zlibParams, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.params can only be called on a Zlib handle"_s);
+    if (UNLIKELY(handle->context().writeInProgress()))
+        return throwVMError(globalObject, scope, "write already in progress"_s);
+
+    int level = callFrame->argument(0).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+    int strategy = callFrame->argument(1).toInt32(globalObject);
+    RETURN_IF_EXCEPTION(scope, {});
+
+    if (auto message = handle->context().params(level, strategy); !message.isNull())
+        emitError(globalObject, handle, handle->context().errorMessage(message));
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibReset, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.reset can only be called on a Zlib handle"_s);
+    if (UNLIKELY(handle->context().writeInProgress()))
+        return throwVMError(globalObject, scope, "write already in progress"_s);
+
+    if (auto message = handle->context().reset(); !message.isNull())
+        emitError(globalObject, handle, handle->context().errorMessage(message));
+
+    RELEASE_AND_RETURN(scope, JSValue::encode(jsUndefined()));
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibClose, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* handle = jsDynamicCast<NodeZlib*>(callFrame->thisValue());
+    if (UNLIKELY(!handle))
+        return throwVMTypeError(globalObject, scope, "Zlib.prototype.close can only be called on a Zlib handle"_s);
+
+    handle->context().close();
+    return JSValue::encode(jsUndefined());
+}
+
+static EncodedJSValue constructZlib(JSGlobalObject* globalObject, CallFrame* callFrame, JSValue newTarget = JSValue())
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    JSValue modeValue = callFrame->argument(0);
+    if (UNLIKELY(!modeValue.isInt32() || modeValue.asInt32() < static_cast<int>(NodeZlibContext::Mode::Deflate) || modeValue.asInt32() > static_cast<int>(NodeZlibContext::Mode::Unzip)))
+        return throwVMTypeError(globalObject, scope, "Bad argument"_s);
+
+    auto* zigGlobalObject = reinterpret_cast<Zig::GlobalObject*>(globalObject);
+    Structure* structure = zigGlobalObject->NodeZlibStructure();
+    if (UNLIKELY(newTarget && zigGlobalObject->NodeZlib() != newTarget)) {
+        JSObject* targetObj = asObject(newTarget);
+        auto* functionGlobalObject = reinterpret_cast<Zig::GlobalObject*>(getFunctionRealm(globalObject, targetObj));
+        RETURN_IF_EXCEPTION(scope, {});
+        structure = InternalFunction::createSubclassStructure(
+            globalObject, targetObj, functionGlobalObject->NodeZlibStructure());
+        RETURN_IF_EXCEPTION(scope, {});
+    }
+
+    auto mode = static_cast<NodeZlibContext::Mode>(modeValue.asInt32());
+    RELEASE_AND_RETURN(scope, JSValue::encode(NodeZlib::create(vm, structure, NodeZlibContext::create(mode))));
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibConstructorCall, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    auto& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    return throwVMTypeError(globalObject, scope, "Class constructor Zlib cannot be invoked without 'new'"_s);
+}
+
+JSC_DEFINE_HOST_FUNCTION(zlibConstructorConstruct, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    return constructZlib(globalObject, callFrame, callFrame->newTarget());
+}
+
+class NodeZlibPrototype final : public JSNonFinalObject {
+public:
+    using Base = JSNonFinalObject;
+
+    static NodeZlibPrototype* create(VM& vm, JSGlobalObject* globalObject, Structure* structure)
+    {
+        NodeZlibPrototype* ptr = new (NotNull, allocateCell<NodeZlibPrototype>(vm)) NodeZlibPrototype(vm, structure);
+        ptr->finishCreation(vm);
+        return ptr;
+    }
+
+    DECLARE_INFO;
+    template<typename CellType, SubspaceAccess>
+    static GCClient::IsoSubspace* subspaceFor(VM& vm)
+    {
+        return &vm.plainObjectSpace();
+    }
+    static Structure* createStructure(VM& vm, JSGlobalObject* globalObject, JSValue prototype)
+    {
+        return Structure::create(vm, globalObject, prototype, TypeInfo(ObjectType, StructureFlags), info());
+    }
+
+private:
+    NodeZlibPrototype(VM& vm, Structure* structure)
+        : Base(vm, structure)
+    {
+    }
+
+    void finishCreation(VM&);
+};
+STATIC_ASSERT_ISO_SUBSPACE_SHARABLE(NodeZlibPrototype, NodeZlibPrototype::Base);
+
+static const struct HashTableValue zlibPrototypeTableValues[] = {
+    { "close"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibClose, 0 } },
+    { "init"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibInit, 5 } },
+    { "params"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibParams, 2 } },
+    { "reset"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibReset, 0 } },
+    { "write"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibWrite, 7 } },
+    { "writeSync"_s, static_cast<unsigned>(PropertyAttribute::ReadOnly | PropertyAttribute::Function), NoIntrinsic, { HashTableValue::NativeFunctionType, zlibWriteSync, 7 } },
+};
+
+const ClassInfo NodeZlibPrototype::s_info = { "Zlib"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(NodeZlibPrototype) };
+const ClassInfo NodeZlib::s_info = { "Zlib"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(NodeZlib) };
+const ClassInfo NodeZlibConstructor::s_info = { "Zlib"_s, &Base::s_info, nullptr, nullptr, CREATE_METHOD_TABLE(NodeZlibConstructor) };
+
+NodeZlibConstructor::NodeZlibConstructor(VM& vm, Structure* structure)
+    : NodeZlibConstructor::Base(vm, structure, zlibConstructorCall, zlibConstructorConstruct)
+{
+}
+
+NodeZlibConstructor* NodeZlibConstructor::create(VM& vm, JSGlobalObject* globalObject, Structure* structure, JSObject* prototype)
+{
+    NodeZlibConstructor* ptr = new (NotNull, allocateCell<NodeZlibConstructor>(vm)) NodeZlibConstructor(vm, structure);
+    ptr->finishCreation(vm, prototype);
+    return ptr;
+}
+
+void NodeZlibConstructor::finishCreation(VM& vm, JSObject* prototype)
+{
+    Base::finishCreation(vm, 1, "Zlib"_s, PropertyAdditionMode::WithStructureTransition);
+    putDirectWithoutTransition(vm, vm.propertyNames->prototype, prototype, PropertyAttribute::DontEnum | PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly);
+    ASSERT(inherits(info()));
+}
+
+void NodeZlibPrototype::finishCreation(VM& vm)
+{
+    Base::finishCreation(vm);
+    reifyStaticProperties(vm, NodeZlib::info(), zlibPrototypeTableValues, *this);
+    JSC_TO_STRING_TAG_WITHOUT_TRANSITION();
+}
+
+JSObject* NodeZlib::createPrototype(VM& vm, JSGlobalObject* globalObject)
+{
+    return NodeZlibPrototype::create(vm, globalObject, NodeZlibPrototype::createStructure(vm, globalObject, globalObject->objectPrototype()));
+}
+
+NodeZlib::NodeZlib(VM& vm, Structure* structure, Ref<NodeZlibContext>&& context)
+    : Base(vm, structure)
+    , m_context(WTFMove(context))
+{
+}
+
+NodeZlib* NodeZlib::create(VM& vm, Structure* structure, Ref<NodeZlibContext>&& context)
+{
+    NodeZlib* ptr = new (NotNull, allocateCell<NodeZlib>(vm)) NodeZlib(vm, structure, WTFMove(context));
+    ptr->finishCreation(vm);
+    return ptr;
+}
+
+void NodeZlib::finishCreation(VM& vm)
+{
+    Base::finishCreation(vm);
+    ASSERT(inherits(info()));
+}
+
+void NodeZlib::destroy(JSCell* cell)
+{
+    static_cast<NodeZlib*>(cell)->NodeZlib::~NodeZlib();
+}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "root.h"
+#include "ZigGlobalObject.h"
+
+#include "JavaScriptCore/JSFunction.h"
+#include "JavaScriptCore/VM.h"
+
+#include "headers-handwritten.h"
+#include "BunClientData.h"
+#include "JavaScriptCore/CallFrame.h"
+
+namespace WebCore {
+
+class NodeZlibContext;
+
+class NodeZlibConstructor final : public JSC::InternalFunction {
+public:
+    using Base = JSC::InternalFunction;
+
+    static NodeZlibConstructor* create(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::Structure* structure, JSC::JSObject* prototype);
+
+    DECLARE_EXPORT_INFO;
+
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::InternalFunctionType, Base::StructureFlags), info());
+    }
+
+private:
+    NodeZlibConstructor(JSC::VM& vm, JSC::Structure* structure);
+
+    void finishCreation(JSC::VM&, JSC::JSObject* prototype);
+};
+STATIC_ASSERT_ISO_SUBSPACE_SHARABLE(NodeZlibConstructor, InternalFunction);
+
+// The handle behind node:zlib's Deflate, Inflate, Gzip, etc. It owns one
+// z_stream and exposes the same init/write/writeSync/params/reset/close
+// interface as Node's zlib binding. write() runs on a background thread and
+// calls this.callback(availIn, availOut) when it is done; errors go to
+// this.onerror(message, errno).
+class NodeZlib final : public JSC::JSDestructibleObject {
+public:
+    using Base = JSC::JSDestructibleObject;
+
+    static NodeZlib* create(JSC::VM& vm, JSC::Structure* structure, Ref<NodeZlibContext>&& context);
+
+    DECLARE_EXPORT_INFO;
+    template<typename, JSC::SubspaceAccess mode> static JSC::GCClient::IsoSubspace* subspaceFor(JSC::VM& vm)
+    {
+        if constexpr (mode == JSC::SubspaceAccess::Concurrently)
+            return nullptr;
+        return WebCore::subspaceForImpl<NodeZlib, WebCore::UseCustomHeapCellType::No>(
+            vm,
+            [](auto& spaces) { return spaces.m_clientSubspaceForNodeZlib.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_clientSubspaceForNodeZlib = std::forward<decltype(space)>(space); },
+            [](auto& spaces) { return spaces.m_subspaceForNodeZlib.get(); },
+            [](auto& spaces, auto&& space) { spaces.m_subspaceForNodeZlib = std::forward<decltype(space)>(space); });
+    }
+
+    static void destroy(JSC::JSCell*);
+    static JSC::Structure* createStructure(JSC::VM& vm, JSC::JSGlobalObject* globalObject, JSC::JSValue prototype)
+    {
+        return JSC::Structure::create(vm, globalObject, prototype, JSC::TypeInfo(JSC::ObjectType, StructureFlags), info());
+    }
+
+    static JSObject* createPrototype(JSC::VM& vm, JSC::JSGlobalObject* globalObject);
+
+    NodeZlibContext& context() { return m_context.get(); }
+
+private:
+    NodeZlib(JSC::VM& vm, JSC::Structure* structure, Ref<NodeZlibContext>&& context);
+
+    void finishCreation(JSC::VM&);
+
+    Ref<NodeZlibContext> m_context;
+};
+
+}
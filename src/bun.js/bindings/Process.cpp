@@ -190,7 +190,6 @@ JSC_DECLARE_HOST_FUNCTION(Process_functionNextTick);
 JSC_DEFINE_HOST_FUNCTION(Process_functionNextTick,
     (JSC::JSGlobalObject * globalObject, JSC::CallFrame* callFrame))
 {
-    JSC::VM& vm = globalObject->vm();
     auto argCount = callFrame->argumentCount();
     if (argCount == 0) {
         auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
@@ -207,42 +206,7 @@ JSC_DEFINE_HOST_FUNCTION(Process_functionNextTick,
     }
 
     Zig::GlobalObject* global = JSC::jsCast<Zig::GlobalObject*>(globalObject);
-
-    switch (callFrame->argumentCount()) {
-    case 1: {
-        global->queueMicrotask(global->performMicrotaskFunction(), job, JSC::JSValue {}, JSC::JSValue {}, JSC::JSValue {});
-        break;
-    }
-    case 2: {
-        global->queueMicrotask(global->performMicrotaskFunction(), job, callFrame->uncheckedArgument(1), JSC::JSValue {}, JSC::JSValue {});
-        break;
-    }
-    case 3: {
-        global->queueMicrotask(global->performMicrotaskFunction(), job, callFrame->uncheckedArgument(1), callFrame->uncheckedArgument(2), JSC::JSValue {});
-        break;
-    }
-    case 4: {
-        global->queueMicrotask(global->performMicrotaskFunction(), job, callFrame->uncheckedArgument(1), callFrame->uncheckedArgument(2), callFrame->uncheckedArgument(3));
-        break;
-    }
-    default: {
-        JSC::JSArray* args = JSC::constructEmptyArray(globalObject, nullptr, argCount - 1);
-        if (UNLIKELY(!args)) {
-            auto scope = DECLARE_THROW_SCOPE(vm);
-            throwVMError(globalObject, scope, createOutOfMemoryError(globalObject));
-            return JSC::JSValue::encode(JSC::JSValue {});
-        }
-
-        for (unsigned i = 1; i < argCount; i++) {
-            args->putDirectIndex(globalObject, i - 1, callFrame->uncheckedArgument(i));
-        }
-
-        global->queueMicrotask(
-            global->performMicrotaskVariadicFunction(), job, args, JSValue {}, JSC::JSValue {});
-
-        break;
-    }
-    }
+    global->queueNextTick(JSC::ArgList(callFrame));
 
     return JSC::JSValue::encode(jsUndefined());
 }
@@ -420,6 +384,9 @@ JSC_DEFINE_HOST_FUNCTION(Process_functionExit,
 
     Process__dispatchOnExit(zigGlobal, exitCode);
     Bun__Process__exit(zigGlobal, exitCode);
+
+    // Only returns inside a worker, with a termination exception pending.
+    return JSC::JSValue::encode(JSC::jsUndefined());
 }
 
 extern "C" uint64_t Bun__readOriginTimer(void*);
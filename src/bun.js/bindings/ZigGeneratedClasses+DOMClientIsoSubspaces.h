@@ -14,7 +14,8 @@ std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForFileSystemRouterConstr
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMD4;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMD4Constructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMD5;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMD5Constructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMatchedRoute;
-std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForNodeJSFS;
+std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMessagePort;
+std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForMessagePortConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForNodeJSFS;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForNodeJSFSConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForRequest;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForRequestConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForResolveMessage;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForResolveMessageConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForResponse;
@@ -32,4 +33,5 @@ std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTLSSocket;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTextDecoder;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTextDecoderConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTimeout;
 std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTranspiler;
-std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTranspilerConstructor;
\ No newline at end of file
+std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForTranspilerConstructor;std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForUDPSocket;
+std::unique_ptr<GCClient::IsoSubspace> m_clientSubspaceForWorker;
@@ -14,7 +14,8 @@ std::unique_ptr<IsoSubspace> m_subspaceForFileSystemRouterConstructor;std::uniqu
 std::unique_ptr<IsoSubspace> m_subspaceForMD4;
 std::unique_ptr<IsoSubspace> m_subspaceForMD4Constructor;std::unique_ptr<IsoSubspace> m_subspaceForMD5;
 std::unique_ptr<IsoSubspace> m_subspaceForMD5Constructor;std::unique_ptr<IsoSubspace> m_subspaceForMatchedRoute;
-std::unique_ptr<IsoSubspace> m_subspaceForNodeJSFS;
+std::unique_ptr<IsoSubspace> m_subspaceForMessagePort;
+std::unique_ptr<IsoSubspace> m_subspaceForMessagePortConstructor;std::unique_ptr<IsoSubspace> m_subspaceForNodeJSFS;
 std::unique_ptr<IsoSubspace> m_subspaceForNodeJSFSConstructor;std::unique_ptr<IsoSubspace> m_subspaceForRequest;
 std::unique_ptr<IsoSubspace> m_subspaceForRequestConstructor;std::unique_ptr<IsoSubspace> m_subspaceForResolveMessage;
 std::unique_ptr<IsoSubspace> m_subspaceForResolveMessageConstructor;std::unique_ptr<IsoSubspace> m_subspaceForResponse;
@@ -32,4 +33,5 @@ std::unique_ptr<IsoSubspace> m_subspaceForTLSSocket;
 std::unique_ptr<IsoSubspace> m_subspaceForTextDecoder;
 std::unique_ptr<IsoSubspace> m_subspaceForTextDecoderConstructor;std::unique_ptr<IsoSubspace> m_subspaceForTimeout;
 std::unique_ptr<IsoSubspace> m_subspaceForTranspiler;
-std::unique_ptr<IsoSubspace> m_subspaceForTranspilerConstructor;
\ No newline at end of file
+std::unique_ptr<IsoSubspace> m_subspaceForTranspilerConstructor;std::unique_ptr<IsoSubspace> m_subspaceForUDPSocket;
+std::unique_ptr<IsoSubspace> m_subspaceForWorker;
@@ -94,6 +94,12 @@ JSC::Structure* JSMatchedRouteStructure() { return m_JSMatchedRoute.getInitializ
   JSC::LazyClassStructure m_JSMatchedRoute;
   bool hasJSMatchedRouteSetterValue { false };
   mutable JSC::WriteBarrier<JSC::Unknown> m_JSMatchedRouteSetterValue;
+JSC::Structure* JSMessagePortStructure() { return m_JSMessagePort.getInitializedOnMainThread(this); }
+        JSC::JSObject* JSMessagePortConstructor() { return m_JSMessagePort.constructorInitializedOnMainThread(this); }
+        JSC::JSValue JSMessagePortPrototype() { return m_JSMessagePort.prototypeInitializedOnMainThread(this); }
+  JSC::LazyClassStructure m_JSMessagePort;
+  bool hasJSMessagePortSetterValue { false };
+  mutable JSC::WriteBarrier<JSC::Unknown> m_JSMessagePortSetterValue;
 JSC::Structure* JSNodeJSFSStructure() { return m_JSNodeJSFS.getInitializedOnMainThread(this); }
         JSC::JSObject* JSNodeJSFSConstructor() { return m_JSNodeJSFS.constructorInitializedOnMainThread(this); }
         JSC::JSValue JSNodeJSFSPrototype() { return m_JSNodeJSFS.prototypeInitializedOnMainThread(this); }
@@ -201,4 +207,16 @@ JSC::Structure* JSTranspilerStructure() { return m_JSTranspiler.getInitializedOn
         JSC::JSValue JSTranspilerPrototype() { return m_JSTranspiler.prototypeInitializedOnMainThread(this); }
   JSC::LazyClassStructure m_JSTranspiler;
   bool hasJSTranspilerSetterValue { false };
-  mutable JSC::WriteBarrier<JSC::Unknown> m_JSTranspilerSetterValue;
\ No newline at end of file
+  mutable JSC::WriteBarrier<JSC::Unknown> m_JSTranspilerSetterValue;
+JSC::Structure* JSUDPSocketStructure() { return m_JSUDPSocket.getInitializedOnMainThread(this); }
+        JSC::JSObject* JSUDPSocketConstructor() { return m_JSUDPSocket.constructorInitializedOnMainThread(this); }
+        JSC::JSValue JSUDPSocketPrototype() { return m_JSUDPSocket.prototypeInitializedOnMainThread(this); }
+  JSC::LazyClassStructure m_JSUDPSocket;
+  bool hasJSUDPSocketSetterValue { false };
+  mutable JSC::WriteBarrier<JSC::Unknown> m_JSUDPSocketSetterValue;
+JSC::Structure* JSWorkerStructure() { return m_JSWorker.getInitializedOnMainThread(this); }
+        JSC::JSObject* JSWorkerConstructor() { return m_JSWorker.constructorInitializedOnMainThread(this); }
+        JSC::JSValue JSWorkerPrototype() { return m_JSWorker.prototypeInitializedOnMainThread(this); }
+  JSC::LazyClassStructure m_JSWorker;
+  bool hasJSWorkerSetterValue { false };
+  mutable JSC::WriteBarrier<JSC::Unknown> m_JSWorkerSetterValue;
\ No newline at end of file
@@ -95,6 +95,12 @@ void GlobalObject::initGeneratedLazyClasses() {
                  init.setStructure(WebCore::JSMatchedRoute::createStructure(init.vm, init.global, init.prototype));
                  
               });
+    m_JSMessagePort.initLater(
+              [](LazyClassStructure::Initializer& init) {
+                 init.setPrototype(WebCore::JSMessagePort::createPrototype(init.vm, reinterpret_cast<Zig::GlobalObject*>(init.global)));
+                 init.setStructure(WebCore::JSMessagePort::createStructure(init.vm, init.global, init.prototype));
+                 init.setConstructor(WebCore::JSMessagePort::createConstructor(init.vm, init.global, init.prototype));
+              });
     m_JSNodeJSFS.initLater(
               [](LazyClassStructure::Initializer& init) {
                  init.setPrototype(WebCore::JSNodeJSFS::createPrototype(init.vm, reinterpret_cast<Zig::GlobalObject*>(init.global)));
@@ -203,6 +209,18 @@ void GlobalObject::initGeneratedLazyClasses() {
                  init.setStructure(WebCore::JSTranspiler::createStructure(init.vm, init.global, init.prototype));
                  init.setConstructor(WebCore::JSTranspiler::createConstructor(init.vm, init.global, init.prototype));
               });
+    m_JSUDPSocket.initLater(
+              [](LazyClassStructure::Initializer& init) {
+                 init.setPrototype(WebCore::JSUDPSocket::createPrototype(init.vm, reinterpret_cast<Zig::GlobalObject*>(init.global)));
+                 init.setStructure(WebCore::JSUDPSocket::createStructure(init.vm, init.global, init.prototype));
+                 
+              });
+    m_JSWorker.initLater(
+              [](LazyClassStructure::Initializer& init) {
+                 init.setPrototype(WebCore::JSWorker::createPrototype(init.vm, reinterpret_cast<Zig::GlobalObject*>(init.global)));
+                 init.setStructure(WebCore::JSWorker::createStructure(init.vm, init.global, init.prototype));
+                 
+              });
 }
 template<typename Visitor>
 void GlobalObject::visitGeneratedLazyClasses(GlobalObject *thisObject, Visitor& visitor)
@@ -223,6 +241,7 @@ void GlobalObject::visitGeneratedLazyClasses(GlobalObject *thisObject, Visitor&
       thisObject->m_JSMD4.visit(visitor);  visitor.append(thisObject->m_JSMD4SetterValue);
       thisObject->m_JSMD5.visit(visitor);  visitor.append(thisObject->m_JSMD5SetterValue);
       thisObject->m_JSMatchedRoute.visit(visitor);  visitor.append(thisObject->m_JSMatchedRouteSetterValue);
+      thisObject->m_JSMessagePort.visit(visitor);  visitor.append(thisObject->m_JSMessagePortSetterValue);
       thisObject->m_JSNodeJSFS.visit(visitor);  visitor.append(thisObject->m_JSNodeJSFSSetterValue);
       thisObject->m_JSRequest.visit(visitor);  visitor.append(thisObject->m_JSRequestSetterValue);
       thisObject->m_JSResolveMessage.visit(visitor);  visitor.append(thisObject->m_JSResolveMessageSetterValue);
@@ -241,4 +260,6 @@ void GlobalObject::visitGeneratedLazyClasses(GlobalObject *thisObject, Visitor&
       thisObject->m_JSTextDecoder.visit(visitor);  visitor.append(thisObject->m_JSTextDecoderSetterValue);
       thisObject->m_JSTimeout.visit(visitor);  visitor.append(thisObject->m_JSTimeoutSetterValue);
       thisObject->m_JSTranspiler.visit(visitor);  visitor.append(thisObject->m_JSTranspilerSetterValue);
+      thisObject->m_JSUDPSocket.visit(visitor);  visitor.append(thisObject->m_JSUDPSocketSetterValue);
+      thisObject->m_JSWorker.visit(visitor);  visitor.append(thisObject->m_JSWorkerSetterValue);
 }
\ No newline at end of file
@@ -106,6 +106,8 @@
 #include "BunJSCModule.h"
 #include "ModuleLoader.h"
 #include "NodeVMScript.h"
+#include "NodeZlib.h"
+#include "SerializedScriptValue.h"
 
 #include "ZigGeneratedClasses.h"
 #include "JavaScriptCore/DateInstance.h"
@@ -121,6 +123,7 @@
 using namespace Bun;
 
 extern "C" JSC::EncodedJSValue Bun__fetch(JSC::JSGlobalObject* lexicalGlobalObject, JSC::CallFrame* callFrame);
+extern "C" JSC::EncodedJSValue Bun__WorkerThreads__createBinding(JSC::JSGlobalObject* globalObject);
 
 using JSGlobalObject
     = JSC::JSGlobalObject;
@@ -1343,6 +1346,21 @@ JSC_DEFINE_HOST_FUNCTION(functionCreateUninitializedArrayBuffer,
     RELEASE_AND_RETURN(scope, JSValue::encode(JSC::JSArrayBuffer::create(globalObject->vm(), globalObject->arrayBufferStructure(JSC::ArrayBufferSharingMode::Default), WTFMove(arrayBuffer))));
 }
 
+JSC_DECLARE_HOST_FUNCTION(functionInvalidateRequireResolution);
+JSC_DEFINE_HOST_FUNCTION(functionInvalidateRequireResolution,
+    (JSC::JSGlobalObject * lexicalGlobalObject, JSC::CallFrame* callFrame))
+{
+    JSValue id = callFrame->argument(0);
+    if (id.isString()) {
+        auto scope = DECLARE_THROW_SCOPE(lexicalGlobalObject->vm());
+        auto idString = id.toWTFString(lexicalGlobalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        jsCast<Zig::GlobalObject*>(lexicalGlobalObject)->invalidateRequireResolution(idString);
+    }
+
+    return JSC::JSValue::encode(JSC::jsUndefined());
+}
+
 JSC_DEFINE_HOST_FUNCTION(functionNoop, (JSC::JSGlobalObject*, JSC::CallFrame*))
 {
     return JSC::JSValue::encode(JSC::jsUndefined());
@@ -1576,6 +1594,18 @@ JSC:
             auto* obj = constructEmptyObject(globalObject);
         }
 
+        if (string == "zlib"_s) {
+            auto* obj = constructEmptyObject(globalObject);
+            obj->putDirect(
+                vm, JSC::PropertyName(JSC::Identifier::fromString(vm, "Zlib"_s)),
+                reinterpret_cast<Zig::GlobalObject*>(globalObject)->NodeZlib(), 0);
+            return JSValue::encode(obj);
+        }
+
+        if (string == "worker_threads"_s) {
+            return Bun__WorkerThreads__createBinding(globalObject);
+        }
+
         if (string == "primordials"_s) {
             auto sourceOrigin = callFrame->callerSourceOrigin(vm).url();
             bool isBuiltin = sourceOrigin.protocolIs("builtin"_s);
@@ -2616,6 +2646,144 @@ JSC_DEFINE_HOST_FUNCTION(jsFunctionPerformMicrotask, (JSGlobalObject * globalObj
     return JSValue::encode(jsUndefined());
 }
 
+void GlobalObject::queueNextTick(const JSC::ArgList& arguments)
+{
+    auto& vm = this->vm();
+    JSC::JSArray* queue = m_nextTickQueue.get();
+    if (UNLIKELY(!queue)) {
+        queue = JSC::constructEmptyArray(this, nullptr, 64);
+        m_nextTickQueue.set(vm, this, queue);
+    }
+
+    unsigned tail = queue->length();
+    unsigned argumentCount = arguments.size() - 1;
+    queue->putDirectIndex(this, tail++, arguments.at(0));
+    queue->putDirectIndex(this, tail++, jsNumber(argumentCount));
+    for (unsigned i = 1; i < arguments.size(); i++) {
+        queue->putDirectIndex(this, tail++, arguments.at(i));
+    }
+
+    m_nextTickQueueDepth++;
+    if (m_nextTickQueueDepth > m_nextTickQueuePeakDepth) {
+        m_nextTickQueuePeakDepth = m_nextTickQueueDepth;
+    }
+
+    // Inside drainMicrotasks() the queue is drained once the promise jobs
+    // run out, so only schedule the fallback job outside of it.
+    if (!m_nextTickDrainScheduled && !m_drainingMicrotasks) {
+        m_nextTickDrainScheduled = true;
+        queueMicrotask(drainNextTickQueueFunction(), JSValue {}, JSValue {}, JSValue {}, JSValue {});
+    }
+}
+
+void GlobalObject::drainNextTickQueue()
+{
+    auto& vm = this->vm();
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    JSC::JSArray* queue = m_nextTickQueue.get();
+
+    if (LIKELY(queue)) {
+        MarkedArgumentBuffer arguments;
+
+        // Ticks queued by a callback are appended to the same array, so they
+        // run in this loop before any promise jobs queued in the meantime.
+        while (m_nextTickQueueHead < queue->length()) {
+            unsigned head = m_nextTickQueueHead;
+            JSValue job = queue->getIndex(this, head);
+            unsigned argumentCount = queue->getIndex(this, head + 1).asUInt32();
+            arguments.clear();
+            for (unsigned i = 0; i < argumentCount; i++) {
+                arguments.append(queue->getIndex(this, head + 2 + i));
+            }
+
+            // Release the slots as they are consumed, so a tick that keeps
+            // rescheduling itself doesn't keep every earlier callback alive.
+            for (unsigned i = head; i < head + 2 + argumentCount; i++) {
+                queue->putDirectIndex(this, i, jsUndefined());
+            }
+
+            m_nextTickQueueHead = head + 2 + argumentCount;
+            m_nextTickQueueDepth--;
+
+            // Once most of the array is consumed slots, move the rest down.
+            unsigned length = queue->length();
+            if (UNLIKELY(m_nextTickQueueHead >= nextTickQueueCompactionThreshold && m_nextTickQueueHead * 2 >= length)) {
+                unsigned remaining = length - m_nextTickQueueHead;
+                for (unsigned i = 0; i < remaining; i++) {
+                    queue->putDirectIndex(this, i, queue->getIndex(this, m_nextTickQueueHead + i));
+                }
+                queue->setLength(this, remaining);
+                m_nextTickQueueHead = 0;
+            }
+
+            auto callData = JSC::getCallData(job);
+            if (UNLIKELY(callData.type == CallData::Type::None)) {
+                continue;
+            }
+
+            JSC::call(this, job, callData, jsUndefined(), arguments);
+
+            if (auto* exception = scope.exception()) {
+                // worker.terminate() and process.exit() in a worker unwind
+                // the whole thread: leave the exception pending and run
+                // nothing else.
+                if (UNLIKELY(vm.isTerminationException(exception))) {
+                    return;
+                }
+
+                scope.clearException();
+                Bun__reportUnhandledError(this, JSValue::encode(exception));
+            }
+        }
+
+        queue->setLength(this, 0);
+        scope.clearException();
+    }
+
+    m_nextTickQueueHead = 0;
+    m_nextTickQueueDepth = 0;
+}
+
+void GlobalObject::drainMicrotasks()
+{
+    auto& vm = this->vm();
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    bool wasDrainingMicrotasks = m_drainingMicrotasks;
+
+    // Like Node: every pending tick runs before the promise jobs, and ticks
+    // queued by a promise job run once the promise jobs run out.
+    do {
+        if (m_nextTickQueueDepth > 0) {
+            drainNextTickQueue();
+            if (UNLIKELY(scope.exception() && vm.isTerminationException(scope.exception()))) {
+                return;
+            }
+        }
+
+        m_drainingMicrotasks = true;
+        vm.drainMicrotasks();
+        m_drainingMicrotasks = wasDrainingMicrotasks;
+    } while (m_nextTickQueueDepth > 0 && !scope.exception());
+}
+
+extern "C" void JSC__JSGlobalObject__drainMicrotasks(Zig::GlobalObject* globalObject)
+{
+    globalObject->drainMicrotasks();
+}
+
+JSC_DEFINE_HOST_FUNCTION(jsFunctionDrainNextTickQueue, (JSGlobalObject * globalObject, CallFrame*))
+{
+    auto* zigGlobalObject = jsCast<Zig::GlobalObject*>(globalObject);
+    zigGlobalObject->m_nextTickDrainScheduled = false;
+
+    // drainMicrotasks() drains the ticks itself once this job's turn ends.
+    if (!zigGlobalObject->m_drainingMicrotasks) {
+        zigGlobalObject->drainNextTickQueue();
+    }
+
+    return JSValue::encode(jsUndefined());
+}
+
 extern "C" EncodedJSValue Bun__DNSResolver__lookup(JSGlobalObject*, JSC::CallFrame*);
 extern "C" EncodedJSValue Bun__DNSResolver__resolve(JSGlobalObject*, JSC::CallFrame*);
 extern "C" EncodedJSValue Bun__DNSResolver__resolveSrv(JSGlobalObject*, JSC::CallFrame*);
@@ -3031,6 +3199,10 @@ void GlobalObject::finishCreation(VM& vm)
         [](const Initializer<JSFunction>& init) {
             init.set(JSFunction::create(init.vm, init.owner, 4, "emitReadable"_s, WebCore::jsReadable_emitReadable_, ImplementationVisibility::Public));
         });
+    m_drainNextTickQueueFunction.initLater(
+        [](const Initializer<JSFunction>& init) {
+            init.set(JSFunction::create(init.vm, init.owner, 0, "processTicks"_s, jsFunctionDrainNextTickQueue, ImplementationVisibility::Public));
+        });
 
     m_bunSleepThenCallback.initLater(
         [](const Initializer<JSFunction>& init) {
@@ -3322,6 +3494,19 @@ void GlobalObject::finishCreation(VM& vm)
             init.setConstructor(constructor);
         });
 
+    m_NodeZlibClassStructure.initLater(
+        [](LazyClassStructure::Initializer& init) {
+            auto prototype = NodeZlib::createPrototype(init.vm, init.global);
+            auto* structure = NodeZlib::createStructure(init.vm, init.global, prototype);
+            auto* constructorStructure = NodeZlibConstructor::createStructure(
+                init.vm, init.global, init.global->m_functionPrototype.get());
+            auto* constructor = NodeZlibConstructor::create(
+                init.vm, init.global, constructorStructure, prototype);
+            init.setPrototype(prototype);
+            init.setStructure(structure);
+            init.setConstructor(constructor);
+        });
+
     addBuiltinGlobals(vm);
 
 #if ENABLE(REMOTE_INSPECTOR)
@@ -3723,6 +3908,12 @@ void GlobalObject::addBuiltinGlobals(JSC::VM& vm)
             JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalObject()), 1,
                 "reportError"_s, functionReportError, ImplementationVisibility::Public),
             JSC::PropertyAttribute::DontDelete | 0 });
+    JSC::Identifier structuredCloneIdentifier = JSC::Identifier::fromString(vm, "structuredClone"_s);
+    extraStaticGlobals.uncheckedAppend(
+        GlobalPropertyInfo { structuredCloneIdentifier,
+            JSC::JSFunction::create(vm, JSC::jsCast<JSC::JSGlobalObject*>(globalObject()), 2,
+                "structuredClone"_s, WebCore::functionStructuredClone, ImplementationVisibility::Public),
+            JSC::PropertyAttribute::Function | JSC::PropertyAttribute::DontDelete | 0 });
 
     extraStaticGlobals.uncheckedAppend(
         GlobalPropertyInfo { builtinNames.startDirectStreamPrivateName(),
@@ -3782,6 +3973,7 @@ void GlobalObject::addBuiltinGlobals(JSC::VM& vm)
     putDirectBuiltinFunction(vm, this, builtinNames.internalRequirePrivateName(), importMetaObjectInternalRequireCodeGenerator(vm), PropertyAttribute::Builtin | PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly);
     putDirectNativeFunction(vm, this, builtinNames.createUninitializedArrayBufferPrivateName(), 1, functionCreateUninitializedArrayBuffer, ImplementationVisibility::Public, NoIntrinsic, PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly | PropertyAttribute::Function);
     putDirectNativeFunction(vm, this, builtinNames.resolveSyncPrivateName(), 1, functionImportMeta__resolveSyncPrivate, ImplementationVisibility::Public, NoIntrinsic, PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly | PropertyAttribute::Function);
+    putDirectNativeFunction(vm, this, builtinNames.invalidateRequireResolutionPrivateName(), 1, functionInvalidateRequireResolution, ImplementationVisibility::Public, NoIntrinsic, PropertyAttribute::DontDelete | PropertyAttribute::ReadOnly | PropertyAttribute::Function);
 
     putDirectCustomAccessor(vm, JSC::Identifier::fromString(vm, "process"_s), JSC::CustomGetterSetter::create(vm, property_lazyProcessGetter, property_lazyProcessSetter),
         JSC::PropertyAttribute::CustomAccessor | 0);
@@ -4234,6 +4426,7 @@ void GlobalObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
     thisObject->m_NapiClassStructure.visit(visitor);
     thisObject->m_JSBufferClassStructure.visit(visitor);
     thisObject->m_NodeVMScriptClassStructure.visit(visitor);
+    thisObject->m_NodeZlibClassStructure.visit(visitor);
 
     thisObject->m_pendingVirtualModuleResultStructure.visit(visitor);
     thisObject->m_performMicrotaskFunction.visit(visitor);
@@ -4254,6 +4447,7 @@ void GlobalObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
     thisObject->m_JSHTTPResponseController.visit(visitor);
     thisObject->m_callSiteStructure.visit(visitor);
     thisObject->m_emitReadableNextTickFunction.visit(visitor);
+    thisObject->m_drainNextTickQueueFunction.visit(visitor);
     thisObject->m_JSBufferSubclassStructure.visit(visitor);
 
     thisObject->m_importMetaRequireFunctionUnbound.visit(visitor);
@@ -4286,6 +4480,7 @@ void GlobalObject::visitChildrenImpl(JSCell* cell, Visitor& visitor)
 
     thisObject->visitGeneratedLazyClasses<Visitor>(thisObject, visitor);
     visitor.append(thisObject->m_BunCommonJSModuleValue);
+    visitor.append(thisObject->m_nextTickQueue);
 
     ScriptExecutionContext* context = thisObject->scriptExecutionContext();
     visitor.addOpaqueRoot(context);
@@ -4394,6 +4589,7 @@ void GlobalObject::reload()
 
     registry->clear(this->vm());
     this->requireMap()->clear(this->vm());
+    this->clearRequireResolutionCache();
 
     // If we run the GC every time, we will never get the SourceProvider cache hit.
     // So we run the GC every other time.
@@ -4402,6 +4598,36 @@ void GlobalObject::reload()
     }
 }
 
+static WTF::String requireResolutionCacheKey(const WTF::String& from, const WTF::String& specifier)
+{
+    // Neither a path nor a specifier can contain a NUL byte.
+    return makeString(from, '\0', specifier);
+}
+
+WTF::String GlobalObject::cachedRequireResolution(const WTF::String& from, const WTF::String& specifier)
+{
+    auto it = m_requireResolutionCache.find(requireResolutionCacheKey(from, specifier));
+    if (it == m_requireResolutionCache.end()) {
+        m_requireResolutionCacheMisses++;
+        return WTF::String();
+    }
+
+    m_requireResolutionCacheHits++;
+    return it->value;
+}
+
+void GlobalObject::cacheRequireResolution(const WTF::String& from, const WTF::String& specifier, const WTF::String& resolved)
+{
+    m_requireResolutionCache.set(requireResolutionCacheKey(from, specifier), resolved);
+}
+
+void GlobalObject::invalidateRequireResolution(const WTF::String& resolved)
+{
+    m_requireResolutionCache.removeIf([&](auto& entry) {
+        return entry.value == resolved;
+    });
+}
+
 extern "C" void JSC__JSGlobalObject__reload(JSC__JSGlobalObject* arg0)
 {
     Zig::GlobalObject* globalObject = reinterpret_cast<Zig::GlobalObject*>(arg0);
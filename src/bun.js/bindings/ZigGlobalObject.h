@@ -74,6 +74,7 @@ extern "C" JSC::EncodedJSValue jsFunctionOnLoadObjectResultReject(JSC::JSGlobalO
 namespace Zig {
 
 class JSCStackTrace;
+class NapiRefPool;
 
 using JSDOMStructureMap = HashMap<const JSC::ClassInfo*, JSC::WriteBarrier<JSC::Structure>>;
 using DOMGuardedObjectSet = HashSet<WebCore::DOMGuardedObject*>;
@@ -234,6 +235,10 @@ public:
     JSC::JSObject* NodeVMScript() { return m_NodeVMScriptClassStructure.constructorInitializedOnMainThread(this); }
     JSC::JSValue NodeVMScriptPrototype() { return m_NodeVMScriptClassStructure.prototypeInitializedOnMainThread(this); }
 
+    JSC::Structure* NodeZlibStructure() { return m_NodeZlibClassStructure.getInitializedOnMainThread(this); }
+    JSC::JSObject* NodeZlib() { return m_NodeZlibClassStructure.constructorInitializedOnMainThread(this); }
+    JSC::JSValue NodeZlibPrototype() { return m_NodeZlibClassStructure.prototypeInitializedOnMainThread(this); }
+
     JSC::JSMap* readableStreamNativeMap() { return m_lazyReadableStreamPrototypeMap.getInitializedOnMainThread(this); }
     JSC::JSMap* requireMap() { return m_requireMap.getInitializedOnMainThread(this); }
     JSC::Structure* encodeIntoObjectStructure() { return m_encodeIntoObjectStructure.getInitializedOnMainThread(this); }
@@ -247,6 +252,19 @@ public:
     JSC::JSFunction* performMicrotaskVariadicFunction() { return m_performMicrotaskVariadicFunction.getInitializedOnMainThread(this); }
 
     JSC::JSFunction* emitReadableNextTickFunction() { return m_emitReadableNextTickFunction.getInitializedOnMainThread(this); }
+    JSC::JSFunction* drainNextTickQueueFunction() { return m_drainNextTickQueueFunction.getInitializedOnMainThread(this); }
+
+    // process.nextTick() callbacks are stored flat in a single array as
+    // [callback, argumentCount, ...arguments] and run by one microtask which
+    // drains the whole queue, including ticks queued while draining.
+    void queueNextTick(const JSC::ArgList& arguments);
+    void drainNextTickQueue();
+
+    // The event loop drains microtasks through this so that pending ticks
+    // run before promise jobs, as they do in Node.
+    void drainMicrotasks();
+    size_t nextTickQueueDepth() const { return m_nextTickQueueDepth; }
+    size_t nextTickQueuePeakDepth() const { return m_nextTickQueuePeakDepth; }
 
     JSObject* importMetaRequireFunctionUnbound() { return m_importMetaRequireFunctionUnbound.getInitializedOnMainThread(this); }
     JSObject* importMetaRequireResolveFunctionUnbound() { return m_importMetaRequireResolveFunctionUnbound.getInitializedOnMainThread(this); }
@@ -367,6 +385,7 @@ public:
     mutable WriteBarrier<Unknown> m_JSWebSocketSetterValue;
     mutable WriteBarrier<Unknown> m_JSDOMFormDataSetterValue;
     mutable WriteBarrier<Unknown> m_BunCommonJSModuleValue;
+    mutable WriteBarrier<JSC::JSArray> m_nextTickQueue;
 
     mutable WriteBarrier<JSFunction> m_thenables[promiseFunctionsSize + 1];
 
@@ -401,6 +420,18 @@ public:
 
     void reload();
 
+    // Resolved ids of CommonJS require() calls, keyed by the referrer and the
+    // specifier, so repeated require("x") from the same file skips the
+    // resolver. Entries for a module are dropped when it is deleted from
+    // require.cache, and reload() clears everything.
+    WTF::String cachedRequireResolution(const WTF::String& from, const WTF::String& specifier);
+    void cacheRequireResolution(const WTF::String& from, const WTF::String& specifier, const WTF::String& resolved);
+    void invalidateRequireResolution(const WTF::String& resolved);
+    void clearRequireResolutionCache() { m_requireResolutionCache.clear(); }
+    size_t requireResolutionCacheSize() const { return m_requireResolutionCache.size(); }
+    size_t requireResolutionCacheHits() const { return m_requireResolutionCacheHits; }
+    size_t requireResolutionCacheMisses() const { return m_requireResolutionCacheMisses; }
+
     JSC::Structure* pendingVirtualModuleResultStructure() { return m_pendingVirtualModuleResultStructure.get(this); }
 
     // When a napi module initializes on dlopen, we need to know what the value is
@@ -417,6 +448,10 @@ public:
     void* napiInstanceDataFinalizer = nullptr;
     void* napiInstanceDataFinalizerHint = nullptr;
 
+    // Lazily created by NapiRefPool::from(). Never freed: weak handles may
+    // still point into it while the global is being torn down.
+    NapiRefPool* napiRefPool = nullptr;
+
     Bun::JSMockModule mockModule;
 
 #include "ZigGeneratedClasses+lazyStructureHeader.h"
@@ -456,6 +491,7 @@ private:
     LazyClassStructure m_callSiteStructure;
     LazyClassStructure m_JSBufferClassStructure;
     LazyClassStructure m_NodeVMScriptClassStructure;
+    LazyClassStructure m_NodeZlibClassStructure;
 
     /**
      * WARNING: You must update visitChildrenImpl() if you add a new field.
@@ -472,8 +508,12 @@ private:
     LazyProperty<JSGlobalObject, JSFunction> m_nativeMicrotaskTrampoline;
     LazyProperty<JSGlobalObject, JSFunction> m_performMicrotaskVariadicFunction;
     LazyProperty<JSGlobalObject, JSFunction> m_emitReadableNextTickFunction;
+    LazyProperty<JSGlobalObject, JSFunction> m_drainNextTickQueueFunction;
     LazyProperty<JSGlobalObject, JSMap> m_lazyReadableStreamPrototypeMap;
     LazyProperty<JSGlobalObject, JSMap> m_requireMap;
+    WTF::HashMap<WTF::String, WTF::String> m_requireResolutionCache;
+    size_t m_requireResolutionCacheHits = 0;
+    size_t m_requireResolutionCacheMisses = 0;
     LazyProperty<JSGlobalObject, Structure> m_encodeIntoObjectStructure;
     LazyProperty<JSGlobalObject, JSObject> m_JSArrayBufferControllerPrototype;
     LazyProperty<JSGlobalObject, JSObject> m_JSFileSinkControllerPrototype;
@@ -510,6 +550,14 @@ private:
 
     WTF::Vector<JSC::Strong<JSC::JSPromise>> m_aboutToBeNotifiedRejectedPromises;
     WTF::Vector<JSC::Strong<JSC::JSFunction>> m_ffiFunctions;
+
+    // Consumed slots at the front of m_nextTickQueue before it is compacted.
+    static constexpr unsigned nextTickQueueCompactionThreshold = 1024;
+    unsigned m_nextTickQueueHead = 0;
+    size_t m_nextTickQueueDepth = 0;
+    size_t m_nextTickQueuePeakDepth = 0;
+    bool m_nextTickDrainScheduled = false;
+    bool m_drainingMicrotasks = false;
 };
 
 } // namespace Zig
@@ -7,7 +7,11 @@
 #include "JavaScriptCore/BytecodeCacheError.h"
 #include "ZigGlobalObject.h"
 
+#include "JavaScriptCore/CachedTypes.h"
+#include "JavaScriptCore/CodeCache.h"
 #include "JavaScriptCore/Completion.h"
+#include "wtf/FileSystem.h"
+#include "wtf/SHA1.h"
 #include "wtf/Scope.h"
 #include "wtf/text/StringHash.h"
 #include <sys/stat.h>
@@ -58,6 +62,45 @@ static SourceOrigin toSourceOrigin(const String& sourceURL, bool isBuiltin)
     return SourceOrigin(WTF::URL::fileURLWithFileSystemPath(sourceURL));
 }
 
+// The bytecode cache is opt-in: set BUN_BYTECODE_CACHE_DIR to a directory and
+// each ES module gets a file there named after a hash of its source, its path
+// and the Bun/JavaScriptCore build, so editing a file or upgrading Bun never
+// hits an old entry.
+static const String& bytecodeCacheDirectory()
+{
+    static NeverDestroyed<String> directory = [] {
+        const char* path = getenv("BUN_BYTECODE_CACHE_DIR");
+        if (!path || !*path)
+            return String();
+
+        String directory = String::fromUTF8(path);
+        if (!FileSystem::makeAllDirectories(directory))
+            return String();
+        return directory;
+    }();
+    return directory;
+}
+
+static String bytecodeCachePath(const StringImpl& source, const String& sourceURL)
+{
+    const auto& directory = bytecodeCacheDirectory();
+    if (directory.isNull())
+        return String();
+
+    SHA1 sha1;
+    sha1.addBytes(reinterpret_cast<const uint8_t*>(Bun__version_sha), strlen(Bun__version_sha));
+    sha1.addBytes(reinterpret_cast<const uint8_t*>(Bun__versions_webkit), strlen(Bun__versions_webkit));
+    sha1.addBytes(sourceURL.utf8());
+    if (source.is8Bit())
+        sha1.addBytes(source.characters8(), source.length());
+    else
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(source.characters16()), source.length() * sizeof(UChar));
+
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return FileSystem::pathByAppendingComponent(directory, makeString(SHA1::hexDigest(digest).data(), ".jsc"_s));
+}
+
 Ref<SourceProvider> SourceProvider::create(Zig::GlobalObject* globalObject, ResolvedSource resolvedSource, JSC::SourceProviderSourceType sourceType, bool isBuiltin)
 {
 
@@ -71,6 +114,12 @@ Ref<SourceProvider> SourceProvider::create(Zig::GlobalObject* globalObject, Reso
         sourceURLString.impl(), TextPosition(),
         sourceType));
 
+    if (sourceType == SourceProviderSourceType::Module && !isBuiltin) {
+        provider->m_bytecodeCachePath = bytecodeCachePath(provider->m_source.get(), sourceURLString);
+        if (provider->isBytecodeCacheEnabled())
+            provider->readOrGenerateByteCodeCache(globalObject->vm(), JSC::SourceCode(provider.copyRef()));
+    }
+
     return provider;
 }
 
@@ -87,115 +136,166 @@ void SourceProvider::freeSourceCode()
 {
 }
 
+// Providers holding function updates that haven't been written yet. Module
+// providers usually live until the process exits, so the destructor alone
+// would almost never get to commit them.
+static Lock s_pendingBytecodeCacheLock;
+static HashSet<const SourceProvider*>& pendingBytecodeCacheProviders() WTF_REQUIRES_LOCK(s_pendingBytecodeCacheLock)
+{
+    static NeverDestroyed<HashSet<const SourceProvider*>> providers;
+    return providers;
+}
+
 void SourceProvider::updateCache(const UnlinkedFunctionExecutable* executable, const SourceCode&,
     CodeSpecializationKind kind,
-    const UnlinkedFunctionCodeBlock* codeBlock)
+    const UnlinkedFunctionCodeBlock* codeBlock) const
 {
-    // if (!m_resolvedSource.bytecodecache_fd || !m_cachedBytecode)
-    return;
+    if (!isBytecodeCacheEnabled() || !m_cachedBytecode)
+        return;
 
     JSC::BytecodeCacheError error;
     RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
-    if (cachedBytecode && !error.isValid())
+    if (cachedBytecode && !error.isValid()) {
         m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+
+        Locker locker { s_pendingBytecodeCacheLock };
+        pendingBytecodeCacheProviders().add(this);
+    }
 }
 
-void SourceProvider::cacheBytecode(const BytecodeCacheGenerator& generator)
+void SourceProvider::cacheBytecode(const BytecodeCacheGenerator& generator) const
 {
-    // if (!m_resolvedSource.bytecodecache_fd)
-    return;
+    if (!isBytecodeCacheEnabled())
+        return;
 
     if (!m_cachedBytecode)
         m_cachedBytecode = JSC::CachedBytecode::create();
     auto update = generator();
-    if (update)
-        m_cachedBytecode->addGlobalUpdate(*update);
+    if (!update)
+        return;
+
+    // Write the top-level code block right away. Function updates can only be
+    // appended to a cache that was decoded from disk, so this run stops
+    // recording here and the next one picks up the rest.
+    m_cachedBytecode->addGlobalUpdate(*update);
+    writeCachedBytecode();
+    m_cachedBytecode = nullptr;
 }
-void SourceProvider::commitCachedBytecode()
+
+void SourceProvider::commitCachedBytecode() const
 {
-    // if (!m_resolvedSource.bytecodecache_fd || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
-    return;
+    {
+        Locker locker { s_pendingBytecodeCacheLock };
+        pendingBytecodeCacheProviders().remove(this);
+    }
 
-    // auto clearBytecode = WTF::makeScopeExit([&] { m_cachedBytecode = nullptr; });
-    // const auto fd = m_resolvedSource.bytecodecache_fd;
+    if (!isBytecodeCacheEnabled() || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
 
-    // auto fileSize = FileSystem::fileSize(fd);
-    // if (!fileSize)
-    //     return;
+    auto clearBytecode = WTF::makeScopeExit([&] { m_cachedBytecode = nullptr; });
+    writeCachedBytecode();
+}
 
-    // size_t cacheFileSize;
-    // if (!WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != m_cachedBytecode->size()) {
-    //     // The bytecode cache has already been updated
-    //     return;
-    // }
+void SourceProvider::commitAllCachedBytecode()
+{
+    Locker locker { s_pendingBytecodeCacheLock };
+    auto providers = std::exchange(pendingBytecodeCacheProviders(), {});
+    for (auto* provider : providers) {
+        if (provider->m_cachedBytecode && provider->m_cachedBytecode->hasUpdates())
+            provider->writeCachedBytecode();
+        provider->m_cachedBytecode = nullptr;
+    }
+}
 
-    // if (!FileSystem::truncateFile(fd, m_cachedBytecode->sizeForUpdate()))
-    //     return;
+extern "C" void Zig__SourceProvider__commitAllCachedBytecode()
+{
+    SourceProvider::commitAllCachedBytecode();
+}
+
+bool SourceProvider::writeCachedBytecode() const
+{
+    auto fd = FileSystem::openFile(m_bytecodeCachePath, FileSystem::FileOpenMode::ReadWrite);
+    if (!FileSystem::isHandleValid(fd))
+        return false;
+    auto closeFile = WTF::makeScopeExit([&] { FileSystem::closeFile(fd); });
+
+    auto fileSize = FileSystem::fileSize(fd);
+    if (!fileSize)
+        return false;
+
+    size_t cacheFileSize;
+    if (!WTF::convertSafely(*fileSize, cacheFileSize) || cacheFileSize != m_cachedBytecode->size()) {
+        // Another process updated the cache after we read it
+        return false;
+    }
+
+    if (!FileSystem::truncateFile(fd, m_cachedBytecode->sizeForUpdate()))
+        return false;
 
-    // m_cachedBytecode->commitUpdates([&](off_t offset, const void* data, size_t size) {
-    //     long long result = FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning);
-    //     ASSERT_UNUSED(result, result != -1);
-    //     size_t bytesWritten = static_cast<size_t>(FileSystem::writeToFile(fd, data, size));
-    //     ASSERT_UNUSED(bytesWritten, bytesWritten == size);
-    // });
+    bool success = true;
+    m_cachedBytecode->commitUpdates([&](off_t offset, const void* data, size_t size) {
+        if (!success)
+            return;
+        if (FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning) == -1
+            || static_cast<size_t>(FileSystem::writeToFile(fd, data, size)) != size)
+            success = false;
+    });
+
+    // Leave an empty file rather than a partially written one.
+    if (!success)
+        FileSystem::truncateFile(fd, 0);
+
+    return success;
 }
 
 bool SourceProvider::isBytecodeCacheEnabled() const
 {
-    // return m_resolvedSource.bytecodecache_fd > 0;
-    return false;
+    return !m_bytecodeCachePath.isNull();
 }
 
 void SourceProvider::readOrGenerateByteCodeCache(JSC::VM& vm, const JSC::SourceCode& sourceCode)
 {
-    // auto status = this->readCache(vm, sourceCode);
-    // switch (status) {
-    // case -1: {
-    //     m_resolvedSource.bytecodecache_fd = 0;
-    //     break;
-    // }
-    // case 0: {
-    //     JSC::BytecodeCacheError err;
-    //     m_cachedBytecode = JSC::generateModuleBytecode(vm, sourceCode, m_resolvedSource.bytecodecache_fd, err);
-
-    //     if (err.isValid()) {
-    //         m_resolvedSource.bytecodecache_fd = 0;
-    //         m_cachedBytecode = JSC::CachedBytecode::create();
-    //     }
-    // }
-    // // TODO: read the bytecode into a JSC::SourceCode object here
-    // case 1: {
-    // }
-    // }
+    if (readCache(vm, sourceCode) == -1)
+        m_bytecodeCachePath = String();
 }
+
+// Returns 1 when a valid cache was mapped, 0 when there is nothing usable on
+// disk yet (JSC will call cacheBytecode() once it has compiled the module) and
+// -1 when the cache file can't be used at all.
 int SourceProvider::readCache(JSC::VM& vm, const JSC::SourceCode& sourceCode)
 {
-    return -1;
-    // if (m_resolvedSource.bytecodecache_fd == 0)
-    //     return -1;
-    // if (!FileSystem::isHandleValid(m_resolvedSource.bytecodecache_fd))
-    //     return -1;
-    // const auto fd = m_resolvedSource.bytecodecache_fd;
-
-    // bool success;
-    // FileSystem::MappedFileData mappedFile(fd, FileSystem::MappedFileMode::Shared, success);
-    // if (!success)
-    //     return -1;
-
-    // const uint8_t* fileData = reinterpret_cast<const uint8_t*>(mappedFile.data());
-    // unsigned fileTotalSize = mappedFile.size();
-    // if (fileTotalSize == 0)
-    //     return 0;
-
-    // Ref<JSC::CachedBytecode> cachedBytecode = JSC::CachedBytecode::create(WTFMove(mappedFile));
-    // // auto key = JSC::sourceCodeKeyForSerializedModule(vm, sourceCode);
-    // // if (isCachedBytecodeStillValid(vm, cachedBytecode.copyRef(), key,
-    // //                                JSC::SourceCodeType::ModuleType)) {
-    // m_cachedBytecode = WTFMove(cachedBytecode);
-    // return 1;
-    // } else {
-    //   FileSystem::truncateFile(fd, 0);
-    //   return 0;
-    // }
-}
-}; // namespace Zig
\ No newline at end of file
+    if (!isBytecodeCacheEnabled())
+        return -1;
+
+    auto fd = FileSystem::openFile(m_bytecodeCachePath, FileSystem::FileOpenMode::ReadWrite);
+    if (!FileSystem::isHandleValid(fd))
+        return -1;
+    auto closeFile = WTF::makeScopeExit([&] { FileSystem::closeFile(fd); });
+
+    auto fileSize = FileSystem::fileSize(fd);
+    if (!fileSize)
+        return -1;
+
+    if (!*fileSize) {
+        m_cachedBytecode = JSC::CachedBytecode::create();
+        return 0;
+    }
+
+    bool success;
+    FileSystem::MappedFileData mappedFile(fd, FileSystem::MappedFileMode::Shared, success);
+    if (!success)
+        return -1;
+
+    Ref<JSC::CachedBytecode> cachedBytecode = JSC::CachedBytecode::create(WTFMove(mappedFile));
+    auto key = JSC::sourceCodeKeyForSerializedModule(vm, sourceCode);
+    if (JSC::isCachedBytecodeStillValid(vm, cachedBytecode.copyRef(), key, JSC::SourceCodeType::ModuleType)) {
+        m_cachedBytecode = WTFMove(cachedBytecode);
+        return 1;
+    }
+
+    // Stale or corrupt: start over and let JSC regenerate it.
+    FileSystem::truncateFile(fd, 0);
+    m_cachedBytecode = JSC::CachedBytecode::create();
+    return 0;
+}
+}; // namespace Zig
@@ -44,25 +44,27 @@ public:
 
     unsigned hash() const override;
     StringView source() const override { return StringView(m_source.get()); }
-    RefPtr<JSC::CachedBytecode> cachedBytecode()
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const override
     {
-        // if (m_resolvedSource.bytecodecache_fd == 0) {
-        return nullptr;
-        // }
+        if (!m_cachedBytecode || !m_cachedBytecode->size())
+            return nullptr;
 
-        // return m_cachedBytecode;
+        return m_cachedBytecode;
     };
 
     void updateCache(const UnlinkedFunctionExecutable* executable, const SourceCode&,
-        CodeSpecializationKind kind, const UnlinkedFunctionCodeBlock* codeBlock);
-    void cacheBytecode(const BytecodeCacheGenerator& generator);
-    void commitCachedBytecode();
+        CodeSpecializationKind kind, const UnlinkedFunctionCodeBlock* codeBlock) const override;
+    void cacheBytecode(const BytecodeCacheGenerator& generator) const override;
+    void commitCachedBytecode() const override;
     bool isBytecodeCacheEnabled() const;
     void readOrGenerateByteCodeCache(JSC::VM& vm, const JSC::SourceCode& sourceCode);
     ResolvedSource m_resolvedSource;
     int readCache(JSC::VM& vm, const JSC::SourceCode& sourceCode);
     void freeSourceCode();
 
+    // Writes out function updates that are still pending. Called on exit.
+    static void commitAllCachedBytecode();
+
 private:
     SourceProvider(Zig::GlobalObject* globalObject, ResolvedSource resolvedSource, Ref<WTF::StringImpl>&& sourceImpl,
         const SourceOrigin& sourceOrigin, WTF::String&& sourceURL,
@@ -74,13 +76,17 @@ private:
         m_resolvedSource = resolvedSource;
     }
 
-    RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    bool writeCachedBytecode() const;
+
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
     Ref<WTF::StringImpl> m_source;
     bool did_free_source_code = false;
     Zig::GlobalObject* m_globalObjectForSourceProviderMap;
     unsigned m_hash;
 
-    // JSC::SourceCodeKey key;
+    // Path of this module's entry in the on-disk bytecode cache, or null when
+    // the cache is disabled for it.
+    String m_bytecodeCachePath;
 };
 
 } // namespace Zig
\ No newline at end of file
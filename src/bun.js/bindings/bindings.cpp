@@ -2444,9 +2444,10 @@ JSC__JSModuleLoader__loadAndEvaluateModule(JSC__JSGlobalObject* globalObject,
                 JSC::JSInternalPromise::rejectedPromise(globalObject, callFrame->argument(0)));
         });
 
-    globalObject->vm().drainMicrotasks();
+    auto* zigGlobalObject = jsCast<Zig::GlobalObject*>(globalObject);
+    zigGlobalObject->drainMicrotasks();
     auto result = promise->then(globalObject, resolverFunction, rejecterFunction);
-    globalObject->vm().drainMicrotasks();
+    zigGlobalObject->drainMicrotasks();
 
     // if (promise->status(globalObject->vm()) ==
     // JSC::JSPromise::Status::Fulfilled) {
@@ -3873,7 +3874,18 @@ void JSC__VM__doWork(JSC__VM* vm)
     vm->deferredWorkTimer->doWork(*vm);
 }
 
-void JSC__VM__deinit(JSC__VM* arg1, JSC__JSGlobalObject* globalObject) {}
+void JSC__VM__deinit(JSC__VM* arg1, JSC__JSGlobalObject* globalObject)
+{
+    JSC::VM& vm = *arg1;
+    JSC::JSLockHolder locker(vm);
+    JSC::gcUnprotect(globalObject);
+
+    // Drop both references taken by Zig__GlobalObject__create. The locker
+    // holds the last one, so the VM is destroyed once it is released.
+    vm.deref();
+    vm.deref();
+}
+extern "C" void JSC__VM__notifyNeedTermination(JSC__VM* vm) { vm->notifyNeedTermination(); }
 void JSC__VM__drainMicrotasks(JSC__VM* arg0) { arg0->drainMicrotasks(); }
 
 bool JSC__VM__executionForbidden(JSC__VM* arg0) { return (*arg0).executionForbidden(); }
@@ -2957,6 +2957,46 @@ pub const JSArrayIterator = struct {
     }
 };
 
+/// A value cloned with the structured clone algorithm. It holds no
+/// references into the VM that created it, so it can be handed to another
+/// thread and deserialized there.
+pub const SerializedScriptValue = opaque {
+    extern fn SerializedScriptValue__create(*JSGlobalObject, JSValue, transfer: [*]const JSValue, transfer_len: usize, host_objects: [*]const JSValue, host_objects_len: usize) ?*SerializedScriptValue;
+    extern fn SerializedScriptValue__deserialize(*SerializedScriptValue, *JSGlobalObject, host_objects: [*]const JSValue, host_objects_len: usize, threw: *bool) JSValue;
+    extern fn SerializedScriptValue__deref(*SerializedScriptValue) void;
+    extern fn SerializedScriptValue__throwDataCloneError(*JSGlobalObject, *const ZigString) void;
+
+    /// Returns null with an exception thrown when `value` can't be cloned.
+    /// ArrayBuffers in `transfer` are detached on success. Objects in
+    /// `host_objects` are not cloned; they are passed back by position to
+    /// `deserialize`.
+    pub fn create(globalThis: *JSGlobalObject, value: JSValue, transfer: []const JSValue, host_objects: []const JSValue) ?*SerializedScriptValue {
+        return SerializedScriptValue__create(globalThis, value, transfer.ptr, transfer.len, host_objects.ptr, host_objects.len);
+    }
+
+    pub const Deserialized = union(enum) {
+        result: JSValue,
+        err: JSValue,
+    };
+
+    /// Can only be called once. An exception thrown while rebuilding the
+    /// value is caught and returned as `.err`.
+    pub fn deserialize(this: *SerializedScriptValue, globalThis: *JSGlobalObject, host_objects: []const JSValue) Deserialized {
+        var threw = false;
+        const value = SerializedScriptValue__deserialize(this, globalThis, host_objects.ptr, host_objects.len, &threw);
+        return if (threw) .{ .err = value } else .{ .result = value };
+    }
+
+    pub fn deref(this: *SerializedScriptValue) void {
+        SerializedScriptValue__deref(this);
+    }
+
+    /// Throws a DOMException named "DataCloneError".
+    pub fn throwDataCloneError(globalThis: *JSGlobalObject, comptime message: []const u8) void {
+        SerializedScriptValue__throwDataCloneError(globalThis, ZigString.static(message));
+    }
+};
+
 pub const JSMap = opaque {
     pub const shim = Shimmer("JSC", "JSMap", @This());
     pub const Type = JSMap;
@@ -4977,6 +5017,14 @@ pub const VM = extern struct {
         return cppFn("deleteAllCode", .{ vm, global_object });
     }
 
+    extern fn JSC__VM__notifyNeedTermination(vm: *VM) void;
+
+    /// Safe to call from any thread. Running JavaScript on this VM throws an
+    /// uncatchable termination exception at its next trap check.
+    pub fn notifyNeedTermination(vm: *VM) void {
+        JSC__VM__notifyNeedTermination(vm);
+    }
+
     extern fn Bun__setOnEachMicrotaskTick(vm: *VM, ptr: ?*anyopaque, callback: ?*const fn (*anyopaque) callconv(.C) void) void;
 
     pub fn onEachMicrotask(vm: *VM, comptime Ptr: type, ptr: *Ptr, comptime callback: *const fn (*Ptr) void) void {
@@ -2194,6 +2194,93 @@ pub const JSMatchedRoute = struct {
         }
     }
 };
+pub const JSMessagePort = struct {
+    const MessagePort = Classes.MessagePort;
+    const GetterType = fn (*MessagePort, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const GetterTypeWithThisValue = fn (*MessagePort, JSC.JSValue, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const SetterType = fn (*MessagePort, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const SetterTypeWithThisValue = fn (*MessagePort, JSC.JSValue, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const CallbackType = fn (*MessagePort, *JSC.JSGlobalObject, *JSC.CallFrame) callconv(.C) JSC.JSValue;
+
+    /// Return the pointer to the wrapped object.
+    /// If the object does not match the type, return null.
+    pub fn fromJS(value: JSC.JSValue) ?*MessagePort {
+        JSC.markBinding(@src());
+        return MessagePort__fromJS(value);
+    }
+
+    /// Get the MessagePort constructor value.
+    /// This loads lazily from the global object.
+    pub fn getConstructor(globalObject: *JSC.JSGlobalObject) JSC.JSValue {
+        JSC.markBinding(@src());
+        return MessagePort__getConstructor(globalObject);
+    }
+
+    /// Create a new instance of MessagePort
+    pub fn toJS(this: *MessagePort, globalObject: *JSC.JSGlobalObject) JSC.JSValue {
+        JSC.markBinding(@src());
+        if (comptime Environment.allow_assert) {
+            const value__ = MessagePort__create(globalObject, this);
+            std.debug.assert(value__.as(MessagePort).? == this); // If this fails, likely a C ABI issue.
+            return value__;
+        } else {
+            return MessagePort__create(globalObject, this);
+        }
+    }
+
+    /// Modify the internal ptr to point to a new instance of MessagePort.
+    pub fn dangerouslySetPtr(value: JSC.JSValue, ptr: ?*MessagePort) bool {
+        JSC.markBinding(@src());
+        return MessagePort__dangerouslySetPtr(value, ptr);
+    }
+
+    /// Detach the ptr from the thisValue
+    pub fn detachPtr(_: *MessagePort, value: JSC.JSValue) void {
+        JSC.markBinding(@src());
+        std.debug.assert(MessagePort__dangerouslySetPtr(value, null));
+    }
+
+    extern fn MessagePort__fromJS(JSC.JSValue) ?*MessagePort;
+    extern fn MessagePort__getConstructor(*JSC.JSGlobalObject) JSC.JSValue;
+
+    extern fn MessagePort__create(globalObject: *JSC.JSGlobalObject, ptr: ?*MessagePort) JSC.JSValue;
+
+    extern fn MessagePort__dangerouslySetPtr(JSC.JSValue, ?*MessagePort) bool;
+
+    comptime {
+        if (@TypeOf(MessagePort.constructor) != (fn (*JSC.JSGlobalObject, *JSC.CallFrame) callconv(.C) ?*MessagePort)) {
+            @compileLog("MessagePort.constructor is not a constructor");
+        }
+
+        if (@TypeOf(MessagePort.finalize) != (fn (*MessagePort) callconv(.C) void)) {
+            @compileLog("MessagePort.finalize is not a finalizer");
+        }
+
+        if (@TypeOf(MessagePort.close) != CallbackType)
+            @compileLog("Expected MessagePort.close to be a callback but received " ++ @typeName(@TypeOf(MessagePort.close)));
+        if (@TypeOf(MessagePort.hasRef) != CallbackType)
+            @compileLog("Expected MessagePort.hasRef to be a callback but received " ++ @typeName(@TypeOf(MessagePort.hasRef)));
+        if (@TypeOf(MessagePort.postMessage) != CallbackType)
+            @compileLog("Expected MessagePort.postMessage to be a callback but received " ++ @typeName(@TypeOf(MessagePort.postMessage)));
+        if (@TypeOf(MessagePort.doRef) != CallbackType)
+            @compileLog("Expected MessagePort.doRef to be a callback but received " ++ @typeName(@TypeOf(MessagePort.doRef)));
+        if (@TypeOf(MessagePort.start) != CallbackType)
+            @compileLog("Expected MessagePort.start to be a callback but received " ++ @typeName(@TypeOf(MessagePort.start)));
+        if (@TypeOf(MessagePort.doUnref) != CallbackType)
+            @compileLog("Expected MessagePort.doUnref to be a callback but received " ++ @typeName(@TypeOf(MessagePort.doUnref)));
+        if (!JSC.is_bindgen) {
+            @export(MessagePort.close, .{ .name = "MessagePortPrototype__close" });
+            @export(MessagePort.constructor, .{ .name = "MessagePortClass__construct" });
+            @export(MessagePort.doRef, .{ .name = "MessagePortPrototype__doRef" });
+            @export(MessagePort.doUnref, .{ .name = "MessagePortPrototype__doUnref" });
+            @export(MessagePort.finalize, .{ .name = "MessagePortClass__finalize" });
+            @export(MessagePort.hasPendingActivity, .{ .name = "MessagePort__hasPendingActivity" });
+            @export(MessagePort.hasRef, .{ .name = "MessagePortPrototype__hasRef" });
+            @export(MessagePort.postMessage, .{ .name = "MessagePortPrototype__postMessage" });
+            @export(MessagePort.start, .{ .name = "MessagePortPrototype__start" });
+        }
+    }
+};
 pub const JSNodeJSFS = struct {
     const NodeJSFS = Classes.NodeJSFS;
     const GetterType = fn (*NodeJSFS, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
@@ -4960,6 +5047,247 @@ pub const JSTranspiler = struct {
         }
     }
 };
+pub const JSUDPSocket = struct {
+    const UDPSocket = Classes.UDPSocket;
+    const GetterType = fn (*UDPSocket, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const GetterTypeWithThisValue = fn (*UDPSocket, JSC.JSValue, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const SetterType = fn (*UDPSocket, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const SetterTypeWithThisValue = fn (*UDPSocket, JSC.JSValue, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const CallbackType = fn (*UDPSocket, *JSC.JSGlobalObject, *JSC.CallFrame) callconv(.C) JSC.JSValue;
+
+    /// Return the pointer to the wrapped object.
+    /// If the object does not match the type, return null.
+    pub fn fromJS(value: JSC.JSValue) ?*UDPSocket {
+        JSC.markBinding(@src());
+        return UDPSocket__fromJS(value);
+    }
+
+    /// Create a new instance of UDPSocket
+    pub fn toJS(this: *UDPSocket, globalObject: *JSC.JSGlobalObject) JSC.JSValue {
+        JSC.markBinding(@src());
+        if (comptime Environment.allow_assert) {
+            const value__ = UDPSocket__create(globalObject, this);
+            std.debug.assert(value__.as(UDPSocket).? == this); // If this fails, likely a C ABI issue.
+            return value__;
+        } else {
+            return UDPSocket__create(globalObject, this);
+        }
+    }
+
+    /// Modify the internal ptr to point to a new instance of UDPSocket.
+    pub fn dangerouslySetPtr(value: JSC.JSValue, ptr: ?*UDPSocket) bool {
+        JSC.markBinding(@src());
+        return UDPSocket__dangerouslySetPtr(value, ptr);
+    }
+
+    /// Detach the ptr from the thisValue
+    pub fn detachPtr(_: *UDPSocket, value: JSC.JSValue) void {
+        JSC.markBinding(@src());
+        std.debug.assert(UDPSocket__dangerouslySetPtr(value, null));
+    }
+
+    extern fn UDPSocket__fromJS(JSC.JSValue) ?*UDPSocket;
+    extern fn UDPSocket__getConstructor(*JSC.JSGlobalObject) JSC.JSValue;
+
+    extern fn UDPSocket__create(globalObject: *JSC.JSGlobalObject, ptr: ?*UDPSocket) JSC.JSValue;
+
+    extern fn UDPSocket__dangerouslySetPtr(JSC.JSValue, ?*UDPSocket) bool;
+
+    comptime {
+        if (@TypeOf(UDPSocket.finalize) != (fn (*UDPSocket) callconv(.C) void)) {
+            @compileLog("UDPSocket.finalize is not a finalizer");
+        }
+
+        if (@TypeOf(UDPSocket.addMembership) != CallbackType)
+            @compileLog("Expected UDPSocket.addMembership to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.addMembership)));
+        if (@TypeOf(UDPSocket.getAddress) != GetterType)
+            @compileLog("Expected UDPSocket.getAddress to be a getter");
+
+        if (@TypeOf(UDPSocket.close) != CallbackType)
+            @compileLog("Expected UDPSocket.close to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.close)));
+        if (@TypeOf(UDPSocket.getClosed) != GetterType)
+            @compileLog("Expected UDPSocket.getClosed to be a getter");
+
+        if (@TypeOf(UDPSocket.connect) != CallbackType)
+            @compileLog("Expected UDPSocket.connect to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.connect)));
+        if (@TypeOf(UDPSocket.disconnect) != CallbackType)
+            @compileLog("Expected UDPSocket.disconnect to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.disconnect)));
+        if (@TypeOf(UDPSocket.dropMembership) != CallbackType)
+            @compileLog("Expected UDPSocket.dropMembership to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.dropMembership)));
+        if (@TypeOf(UDPSocket.getRecvBufferSize) != CallbackType)
+            @compileLog("Expected UDPSocket.getRecvBufferSize to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.getRecvBufferSize)));
+        if (@TypeOf(UDPSocket.getSendBufferSize) != CallbackType)
+            @compileLog("Expected UDPSocket.getSendBufferSize to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.getSendBufferSize)));
+        if (@TypeOf(UDPSocket.ref) != CallbackType)
+            @compileLog("Expected UDPSocket.ref to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.ref)));
+        if (@TypeOf(UDPSocket.getRemoteAddress) != GetterType)
+            @compileLog("Expected UDPSocket.getRemoteAddress to be a getter");
+
+        if (@TypeOf(UDPSocket.send) != CallbackType)
+            @compileLog("Expected UDPSocket.send to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.send)));
+        if (@TypeOf(UDPSocket.sendMany) != CallbackType)
+            @compileLog("Expected UDPSocket.sendMany to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.sendMany)));
+        if (@TypeOf(UDPSocket.setBroadcast) != CallbackType)
+            @compileLog("Expected UDPSocket.setBroadcast to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setBroadcast)));
+        if (@TypeOf(UDPSocket.setMulticastInterface) != CallbackType)
+            @compileLog("Expected UDPSocket.setMulticastInterface to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setMulticastInterface)));
+        if (@TypeOf(UDPSocket.setMulticastLoopback) != CallbackType)
+            @compileLog("Expected UDPSocket.setMulticastLoopback to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setMulticastLoopback)));
+        if (@TypeOf(UDPSocket.setMulticastTTL) != CallbackType)
+            @compileLog("Expected UDPSocket.setMulticastTTL to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setMulticastTTL)));
+        if (@TypeOf(UDPSocket.setRecvBufferSize) != CallbackType)
+            @compileLog("Expected UDPSocket.setRecvBufferSize to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setRecvBufferSize)));
+        if (@TypeOf(UDPSocket.setSendBufferSize) != CallbackType)
+            @compileLog("Expected UDPSocket.setSendBufferSize to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setSendBufferSize)));
+        if (@TypeOf(UDPSocket.setTTL) != CallbackType)
+            @compileLog("Expected UDPSocket.setTTL to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.setTTL)));
+        if (@TypeOf(UDPSocket.unref) != CallbackType)
+            @compileLog("Expected UDPSocket.unref to be a callback but received " ++ @typeName(@TypeOf(UDPSocket.unref)));
+        if (!JSC.is_bindgen) {
+            @export(UDPSocket.addMembership, .{ .name = "UDPSocketPrototype__addMembership" });
+            @export(UDPSocket.close, .{ .name = "UDPSocketPrototype__close" });
+            @export(UDPSocket.connect, .{ .name = "UDPSocketPrototype__connect" });
+            @export(UDPSocket.disconnect, .{ .name = "UDPSocketPrototype__disconnect" });
+            @export(UDPSocket.dropMembership, .{ .name = "UDPSocketPrototype__dropMembership" });
+            @export(UDPSocket.finalize, .{ .name = "UDPSocketClass__finalize" });
+            @export(UDPSocket.getAddress, .{ .name = "UDPSocketPrototype__getAddress" });
+            @export(UDPSocket.getClosed, .{ .name = "UDPSocketPrototype__getClosed" });
+            @export(UDPSocket.getRecvBufferSize, .{ .name = "UDPSocketPrototype__getRecvBufferSize" });
+            @export(UDPSocket.getRemoteAddress, .{ .name = "UDPSocketPrototype__getRemoteAddress" });
+            @export(UDPSocket.getSendBufferSize, .{ .name = "UDPSocketPrototype__getSendBufferSize" });
+            @export(UDPSocket.hasPendingActivity, .{ .name = "UDPSocket__hasPendingActivity" });
+            @export(UDPSocket.ref, .{ .name = "UDPSocketPrototype__ref" });
+            @export(UDPSocket.send, .{ .name = "UDPSocketPrototype__send" });
+            @export(UDPSocket.sendMany, .{ .name = "UDPSocketPrototype__sendMany" });
+            @export(UDPSocket.setBroadcast, .{ .name = "UDPSocketPrototype__setBroadcast" });
+            @export(UDPSocket.setMulticastInterface, .{ .name = "UDPSocketPrototype__setMulticastInterface" });
+            @export(UDPSocket.setMulticastLoopback, .{ .name = "UDPSocketPrototype__setMulticastLoopback" });
+            @export(UDPSocket.setMulticastTTL, .{ .name = "UDPSocketPrototype__setMulticastTTL" });
+            @export(UDPSocket.setRecvBufferSize, .{ .name = "UDPSocketPrototype__setRecvBufferSize" });
+            @export(UDPSocket.setSendBufferSize, .{ .name = "UDPSocketPrototype__setSendBufferSize" });
+            @export(UDPSocket.setTTL, .{ .name = "UDPSocketPrototype__setTTL" });
+            @export(UDPSocket.unref, .{ .name = "UDPSocketPrototype__unref" });
+        }
+    }
+};
+pub const JSWorker = struct {
+    const Worker = Classes.Worker;
+    const GetterType = fn (*Worker, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const GetterTypeWithThisValue = fn (*Worker, JSC.JSValue, *JSC.JSGlobalObject) callconv(.C) JSC.JSValue;
+    const SetterType = fn (*Worker, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const SetterTypeWithThisValue = fn (*Worker, JSC.JSValue, *JSC.JSGlobalObject, JSC.JSValue) callconv(.C) bool;
+    const CallbackType = fn (*Worker, *JSC.JSGlobalObject, *JSC.CallFrame) callconv(.C) JSC.JSValue;
+
+    /// Return the pointer to the wrapped object.
+    /// If the object does not match the type, return null.
+    pub fn fromJS(value: JSC.JSValue) ?*Worker {
+        JSC.markBinding(@src());
+        return Worker__fromJS(value);
+    }
+
+    extern fn WorkerPrototype__portSetCachedValue(JSC.JSValue, *JSC.JSGlobalObject, JSC.JSValue) void;
+
+    extern fn WorkerPrototype__portGetCachedValue(JSC.JSValue) JSC.JSValue;
+
+    /// `Worker.port` setter
+    /// This value will be visited by the garbage collector.
+    pub fn portSetCached(thisValue: JSC.JSValue, globalObject: *JSC.JSGlobalObject, value: JSC.JSValue) void {
+        JSC.markBinding(@src());
+        WorkerPrototype__portSetCachedValue(thisValue, globalObject, value);
+    }
+
+    /// `Worker.port` getter
+    /// This value will be visited by the garbage collector.
+    pub fn portGetCached(thisValue: JSC.JSValue) ?JSC.JSValue {
+        JSC.markBinding(@src());
+        const result = WorkerPrototype__portGetCachedValue(thisValue);
+        if (result == .zero)
+            return null;
+
+        return result;
+    }
+
+    extern fn WorkerPrototype__listenerSetCachedValue(JSC.JSValue, *JSC.JSGlobalObject, JSC.JSValue) void;
+
+    extern fn WorkerPrototype__listenerGetCachedValue(JSC.JSValue) JSC.JSValue;
+
+    /// `Worker.listener` setter
+    /// This value will be visited by the garbage collector.
+    pub fn listenerSetCached(thisValue: JSC.JSValue, globalObject: *JSC.JSGlobalObject, value: JSC.JSValue) void {
+        JSC.markBinding(@src());
+        WorkerPrototype__listenerSetCachedValue(thisValue, globalObject, value);
+    }
+
+    /// `Worker.listener` getter
+    /// This value will be visited by the garbage collector.
+    pub fn listenerGetCached(thisValue: JSC.JSValue) ?JSC.JSValue {
+        JSC.markBinding(@src());
+        const result = WorkerPrototype__listenerGetCachedValue(thisValue);
+        if (result == .zero)
+            return null;
+
+        return result;
+    }
+
+    /// Create a new instance of Worker
+    pub fn toJS(this: *Worker, globalObject: *JSC.JSGlobalObject) JSC.JSValue {
+        JSC.markBinding(@src());
+        if (comptime Environment.allow_assert) {
+            const value__ = Worker__create(globalObject, this);
+            std.debug.assert(value__.as(Worker).? == this); // If this fails, likely a C ABI issue.
+            return value__;
+        } else {
+            return Worker__create(globalObject, this);
+        }
+    }
+
+    /// Modify the internal ptr to point to a new instance of Worker.
+    pub fn dangerouslySetPtr(value: JSC.JSValue, ptr: ?*Worker) bool {
+        JSC.markBinding(@src());
+        return Worker__dangerouslySetPtr(value, ptr);
+    }
+
+    /// Detach the ptr from the thisValue
+    pub fn detachPtr(_: *Worker, value: JSC.JSValue) void {
+        JSC.markBinding(@src());
+        std.debug.assert(Worker__dangerouslySetPtr(value, null));
+    }
+
+    extern fn Worker__fromJS(JSC.JSValue) ?*Worker;
+    extern fn Worker__getConstructor(*JSC.JSGlobalObject) JSC.JSValue;
+
+    extern fn Worker__create(globalObject: *JSC.JSGlobalObject, ptr: ?*Worker) JSC.JSValue;
+
+    extern fn Worker__dangerouslySetPtr(JSC.JSValue, ?*Worker) bool;
+
+    comptime {
+        if (@TypeOf(Worker.finalize) != (fn (*Worker) callconv(.C) void)) {
+            @compileLog("Worker.finalize is not a finalizer");
+        }
+
+        if (@TypeOf(Worker.getPort) != GetterType)
+            @compileLog("Expected Worker.getPort to be a getter");
+
+        if (@TypeOf(Worker.doRef) != CallbackType)
+            @compileLog("Expected Worker.doRef to be a callback but received " ++ @typeName(@TypeOf(Worker.doRef)));
+        if (@TypeOf(Worker.terminate) != CallbackType)
+            @compileLog("Expected Worker.terminate to be a callback but received " ++ @typeName(@TypeOf(Worker.terminate)));
+        if (@TypeOf(Worker.getThreadId) != GetterType)
+            @compileLog("Expected Worker.getThreadId to be a getter");
+
+        if (@TypeOf(Worker.doUnref) != CallbackType)
+            @compileLog("Expected Worker.doUnref to be a callback but received " ++ @typeName(@TypeOf(Worker.doUnref)));
+        if (!JSC.is_bindgen) {
+            @export(Worker.doRef, .{ .name = "WorkerPrototype__doRef" });
+            @export(Worker.doUnref, .{ .name = "WorkerPrototype__doUnref" });
+            @export(Worker.finalize, .{ .name = "WorkerClass__finalize" });
+            @export(Worker.getPort, .{ .name = "WorkerPrototype__getPort" });
+            @export(Worker.getThreadId, .{ .name = "WorkerPrototype__getThreadId" });
+            @export(Worker.hasPendingActivity, .{ .name = "Worker__hasPendingActivity" });
+            @export(Worker.terminate, .{ .name = "WorkerPrototype__terminate" });
+        }
+    }
+};
 
 comptime {
     _ = JSBlob;
@@ -4978,6 +5306,7 @@ comptime {
     _ = JSMD4;
     _ = JSMD5;
     _ = JSMatchedRoute;
+    _ = JSMessagePort;
     _ = JSNodeJSFS;
     _ = JSRequest;
     _ = JSResolveMessage;
@@ -4996,4 +5325,6 @@ comptime {
     _ = JSTextDecoder;
     _ = JSTimeout;
     _ = JSTranspiler;
+    _ = JSUDPSocket;
+    _ = JSWorker;
 }
@@ -33,9 +33,12 @@ pub const Classes = struct {
     pub const TCPSocket = JSC.API.TCPSocket;
     pub const TLSSocket = JSC.API.TLSSocket;
     pub const TextDecoder = JSC.WebCore.TextDecoder;
+    pub const UDPSocket = JSC.API.UDPSocket;
     pub const Timeout = JSC.API.Bun.Timer.TimerObject;
     pub const BuildArtifact = JSC.API.BuildArtifact;
     pub const BuildMessage = JSC.BuildMessage;
     pub const ResolveMessage = JSC.ResolveMessage;
     pub const FSWatcher = JSC.Node.FSWatcher;
+    pub const MessagePort = JSC.WebCore.MessagePort;
+    pub const Worker = JSC.WebWorker;
 };
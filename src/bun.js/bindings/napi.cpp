@@ -155,6 +155,51 @@ void NapiRef::clear()
     this->strongRef.clear();
 }
 
+NapiRefPool& NapiRefPool::from(Zig::GlobalObject* globalObject)
+{
+    if (!globalObject->napiRefPool)
+        globalObject->napiRefPool = new NapiRefPool();
+    return *globalObject->napiRefPool;
+}
+
+NapiRef* NapiRefPool::create(JSC::JSGlobalObject* global, uint32_t count)
+{
+    if (!m_freeList) {
+        auto slab = makeUniqueArray<Cell>(slabSize);
+        for (size_t i = slabSize; i-- > 0;) {
+            slab[i].next = m_freeList;
+            m_freeList = &slab[i];
+        }
+        m_slabs.append(WTFMove(slab));
+    }
+
+    Cell* cell = m_freeList;
+    m_freeList = cell->next;
+    auto* ref = new (NotNull, cell->storage) NapiRef(global, count);
+    ref->pool = this;
+    return ref;
+}
+
+void NapiRefPool::destroy(NapiRef* ref)
+{
+    NapiRefPool* pool = ref->pool;
+    ref->~NapiRef();
+
+    auto* cell = reinterpret_cast<Cell*>(ref);
+    cell->next = pool->m_freeList;
+    pool->m_freeList = cell;
+}
+
+static void finalizeNapiWrap(JSCell* cell)
+{
+    auto* object = static_cast<NapiPrototype*>(cell);
+    if (!object->isWrapped)
+        return;
+
+    object->isWrapped = false;
+    object->wrapFinalizer.call(object->wrapGlobalObject, object->wrappedData);
+}
+
 // namespace Napi {
 // class Reference
 // }
@@ -561,30 +606,29 @@ extern "C" napi_status napi_wrap(napi_env env,
         return napi_object_expected;
     }
 
-    if (val->napiRef) {
+    if (val->isWrapped) {
         // Calling napi_wrap() a second time on an object will return an error.
         // To associate another native instance with the object, use
         // napi_remove_wrap() first.
         return napi_invalid_arg;
     }
 
-    auto clientData = WebCore::clientData(vm);
-
-    auto* ref = new NapiRef(globalObject, 1);
-    ref->strongRef.set(globalObject->vm(), value.getObject());
+    val->isWrapped = true;
+    val->wrappedData = native_object;
+    val->wrapFinalizer.finalize_cb = finalize_cb;
+    val->wrapFinalizer.finalize_hint = finalize_hint;
+    val->wrapGlobalObject = globalObject;
 
-    if (finalize_cb) {
-        ref->finalizer.finalize_cb = finalize_cb;
-        ref->finalizer.finalize_hint = finalize_hint;
+    if (finalize_cb && !val->hasWrapHeapFinalizer) {
+        // Registered once per object; napi_remove_wrap() just clears isWrapped.
+        val->hasWrapHeapFinalizer = true;
+        vm.heap.addFinalizer(val, finalizeNapiWrap);
     }
 
-    if (native_object) {
-        ref->data = native_object;
-    }
-
-    val->napiRef = ref;
-
     if (result) {
+        // Like Node, the returned reference is weak.
+        auto* ref = NapiRefPool::from(globalObject).create(globalObject, 0);
+        ref->weakValueRef.setObject(val, weakValueHandleOwner(), ref);
         *result = toNapi(ref);
     }
 
@@ -599,24 +643,25 @@ extern "C" napi_status napi_remove_wrap(napi_env env, napi_value js_object,
         return napi_object_expected;
     }
 
-    auto* globalObject = toJS(env);
-    auto& vm = globalObject->vm();
     auto* val = jsDynamicCast<NapiPrototype*>(value);
 
     if (!val) {
         return napi_object_expected;
     }
 
-    if (!val->napiRef) {
+    if (!val->isWrapped) {
         // not sure if this should succeed or return an error
         return napi_ok;
     }
 
-    *result = val->napiRef->data;
+    if (result) {
+        *result = val->wrappedData;
+    }
 
-    auto* ref = val->napiRef;
-    val->napiRef = nullptr;
-    delete ref;
+    // The finalizer is not called once the wrap has been removed.
+    val->isWrapped = false;
+    val->wrappedData = nullptr;
+    val->wrapFinalizer = {};
 
     return napi_ok;
 }
@@ -635,7 +680,7 @@ extern "C" napi_status napi_unwrap(napi_env env, napi_value js_object,
     auto clientData = WebCore::clientData(vm);
 
     if (object) {
-        *result = object->napiRef ? object->napiRef->data : nullptr;
+        *result = object->isWrapped ? object->wrappedData : nullptr;
     }
 
     return napi_ok;
@@ -717,11 +762,11 @@ extern "C" napi_status napi_get_cb_info(
         if (Zig::JSFFIFunction* ffiFunction = JSC::jsDynamicCast<Zig::JSFFIFunction*>(callee)) {
             *data = reinterpret_cast<void*>(ffiFunction->dataPtr);
         } else if (auto* proto = JSC::jsDynamicCast<NapiPrototype*>(callee)) {
-            *data = proto->napiRef ? proto->napiRef->data : nullptr;
+            *data = proto->isWrapped ? proto->wrappedData : nullptr;
         } else if (auto* proto = JSC::jsDynamicCast<NapiClass*>(callee)) {
             *data = proto->dataPtr;
         } else if (auto* proto = JSC::jsDynamicCast<NapiPrototype*>(thisValue)) {
-            *data = proto->napiRef ? proto->napiRef->data : nullptr;
+            *data = proto->isWrapped ? proto->wrappedData : nullptr;
         } else if (auto* proto = JSC::jsDynamicCast<NapiClass*>(thisValue)) {
             *data = proto->dataPtr;
         } else if (auto* proto = JSC::jsDynamicCast<Bun::NapiExternal*>(thisValue)) {
@@ -751,7 +796,7 @@ napi_define_properties(napi_env env, napi_value object, size_t property_count,
 
     void* inheritedDataPtr = nullptr;
     if (NapiPrototype* proto = jsDynamicCast<NapiPrototype*>(objectValue)) {
-        inheritedDataPtr = proto->napiRef ? proto->napiRef->data : nullptr;
+        inheritedDataPtr = proto->isWrapped ? proto->wrappedData : nullptr;
     } else if (NapiClass* proto = jsDynamicCast<NapiClass*>(objectValue)) {
         inheritedDataPtr = proto->dataPtr;
     }
@@ -794,15 +839,8 @@ extern "C" napi_status napi_create_reference(napi_env env, napi_value value,
     }
 
     Zig::GlobalObject* globalObject = toJS(env);
-    JSC::VM& vm = globalObject->vm();
 
-    NapiPrototype* object = jsDynamicCast<NapiPrototype*>(val);
-    if (object && object->napiRef) {
-        *result = toNapi(object->napiRef);
-        return napi_ok;
-    }
-    auto clientData = WebCore::clientData(vm);
-    auto* ref = new NapiRef(globalObject, initial_refcount);
+    auto* ref = NapiRefPool::from(globalObject).create(globalObject, initial_refcount);
     if (initial_refcount > 0) {
         ref->strongRef.set(globalObject->vm(), val);
     } else {
@@ -815,10 +853,6 @@ extern "C" napi_status napi_create_reference(napi_env env, napi_value value,
         }
     }
 
-    if (object) {
-        object->napiRef = ref;
-    }
-
     *result = toNapi(ref);
 
     return napi_ok;
@@ -894,15 +928,13 @@ extern "C" napi_status napi_reference_ref(napi_env env, napi_ref ref,
 
 extern "C" napi_status napi_delete_reference(napi_env env, napi_ref ref)
 {
-    NapiRef* napiRef = toJS(ref);
-    napiRef->~NapiRef();
+    NapiRefPool::destroy(toJS(ref));
     return napi_ok;
 }
 
 extern "C" void napi_delete_reference_internal(napi_ref ref)
 {
-    NapiRef* napiRef = toJS(ref);
-    napiRef->~NapiRef();
+    NapiRefPool::destroy(toJS(ref));
 }
 
 extern "C" napi_status napi_is_detached_arraybuffer(napi_env env,
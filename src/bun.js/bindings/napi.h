@@ -13,6 +13,7 @@ class GlobalObject;
 #include "JavaScriptCore/CallFrame.h"
 #include "js_native_api_types.h"
 #include "JavaScriptCore/JSWeakValue.h"
+#include <wtf/UniqueArray.h>
 #include "JSFFIFunction.h"
 
 namespace JSC {
@@ -56,11 +57,13 @@ static inline napi_env toNapi(JSC::JSGlobalObject* val)
 class NapiFinalizer {
 public:
     void* finalize_hint = nullptr;
-    napi_finalize finalize_cb;
+    napi_finalize finalize_cb = nullptr;
 
     void call(JSC::JSGlobalObject* globalObject, void* data);
 };
 
+class NapiRefPool;
+
 class NapiRef : public RefCounted<NapiRef>, public CanMakeWeakPtr<NapiRef> {
     WTF_MAKE_FAST_ALLOCATED;
 
@@ -110,6 +113,31 @@ public:
     NapiFinalizer finalizer;
     void* data = nullptr;
     uint32_t refCount = 0;
+    NapiRefPool* pool = nullptr;
+};
+
+// Addons create and drop references at a high rate (one per wrapped object
+// for many of them), so NapiRefs come from per-global slabs with a free list
+// rather than one heap allocation each.
+class NapiRefPool {
+    WTF_MAKE_FAST_ALLOCATED;
+
+public:
+    static NapiRefPool& from(Zig::GlobalObject*);
+
+    NapiRef* create(JSC::JSGlobalObject* global, uint32_t count);
+    static void destroy(NapiRef*);
+
+private:
+    static constexpr size_t slabSize = 256;
+
+    union Cell {
+        Cell* next;
+        alignas(NapiRef) unsigned char storage[sizeof(NapiRef)];
+    };
+
+    Vector<UniqueArray<Cell>> m_slabs;
+    Cell* m_freeList = nullptr;
 };
 
 static inline napi_ref toNapi(NapiRef* val)
@@ -223,7 +251,12 @@ public:
         return footprint;
     }
 
-    NapiRef* napiRef = nullptr;
+    // napi_wrap() state lives inline so wrapping an object doesn't allocate.
+    void* wrappedData = nullptr;
+    NapiFinalizer wrapFinalizer;
+    JSC::JSGlobalObject* wrapGlobalObject = nullptr;
+    bool isWrapped = false;
+    bool hasWrapHeapFinalizer = false;
 
 private:
     NapiPrototype(VM& vm, Structure* structure)
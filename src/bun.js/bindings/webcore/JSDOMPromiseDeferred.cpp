@@ -284,6 +284,21 @@ void fulfillPromiseWithArrayBuffer(Ref<DeferredPromise>&& promise, const void* d
     fulfillPromiseWithArrayBuffer(WTFMove(promise), ArrayBuffer::tryCreate(data, length).get());
 }
 
+void fulfillPromiseWithArrayBuffer(Ref<DeferredPromise>&& promise, Vector<uint8_t>&& data)
+{
+    size_t length = data.size();
+    if (!length) {
+        fulfillPromiseWithArrayBuffer(WTFMove(promise), nullptr, 0);
+        return;
+    }
+
+    // Adopt the vector's allocation rather than copying it into a new buffer.
+    auto buffer = data.releaseBuffer();
+    auto* bytes = buffer.get();
+    auto arrayBuffer = ArrayBuffer::createFromBytes(bytes, length, createSharedTask<void(void*)>([buffer = WTFMove(buffer)](void*) {}));
+    fulfillPromiseWithArrayBuffer(WTFMove(promise), arrayBuffer.ptr());
+}
+
 bool DeferredPromise::handleTerminationExceptionIfNeeded(CatchScope& scope, JSDOMGlobalObject& lexicalGlobalObject)
 {
     auto* exception = scope.exception();
@@ -0,0 +1,762 @@
+#include "root.h"
+
+#include "SerializedScriptValue.h"
+
+#include "JavaScriptCore/BooleanObject.h"
+#include "JavaScriptCore/DateInstance.h"
+#include "JavaScriptCore/Error.h"
+#include "JavaScriptCore/ErrorInstance.h"
+#include "JavaScriptCore/IteratorOperations.h"
+#include "JavaScriptCore/JSArrayBuffer.h"
+#include "JavaScriptCore/JSArrayBufferViewInlines.h"
+#include "JavaScriptCore/JSMap.h"
+#include "JavaScriptCore/JSSet.h"
+#include "JavaScriptCore/NumberObject.h"
+#include "JavaScriptCore/ObjectConstructor.h"
+#include "JavaScriptCore/PropertyNameArray.h"
+#include "JavaScriptCore/RegExpObject.h"
+#include "JavaScriptCore/StringObject.h"
+#include "JavaScriptCore/YarrFlags.h"
+#include "JSDOMException.h"
+#include "JSDOMExceptionHandling.h"
+#include "helpers.h"
+
+namespace WebCore {
+using namespace JSC;
+
+// The wire format is a flat list of tags, each followed by its payload.
+// Objects are numbered in the order they are first seen; ObjectReference
+// points back at one of them, which is how shared and cyclic references
+// survive the round trip.
+enum class SerializationTag : uint8_t {
+    Undefined,
+    Null,
+    True,
+    False,
+    Int32,
+    Double,
+    String,
+    BigInt,
+    ObjectReference,
+    Object,
+    Array,
+    ArrayHole,
+    Date,
+    RegExp,
+    Map,
+    Set,
+    Error,
+    BooleanObject,
+    NumberObject,
+    StringObject,
+    ArrayBuffer,
+    TransferredArrayBuffer,
+    SharedArrayBuffer,
+    ArrayBufferView,
+    HostObject,
+    End,
+};
+
+static void throwDataCloneError(JSGlobalObject& globalObject, ThrowScope& scope, const String& message)
+{
+    throwException(&globalObject, scope, createDOMException(&globalObject, DataCloneError, message));
+}
+
+class CloneSerializer {
+public:
+    CloneSerializer(JSGlobalObject& globalObject, SerializedScriptValue& result, const Vector<JSValue>& hostObjects)
+        : m_globalObject(globalObject)
+        , m_vm(globalObject.vm())
+        , m_result(result)
+        , m_hostObjects(hostObjects)
+    {
+    }
+
+    bool prepareTransferList(const Vector<JSValue>& transferList);
+    bool serialize(JSValue);
+    bool transferArrayBuffers();
+
+private:
+    template<typename T> void write(T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        m_result.m_data.append(bytes, sizeof(T));
+    }
+
+    void write(SerializationTag tag) { write(static_cast<uint8_t>(tag)); }
+
+    void writeString(const String& string)
+    {
+        write(static_cast<uint32_t>(m_result.m_strings.size()));
+        m_result.m_strings.append(string.isolatedCopy());
+    }
+
+    // Returns true when the object was written as a back reference.
+    bool writeReferenceIfSeen(JSObject* object)
+    {
+        auto result = m_objects.add(object, m_objects.size());
+        if (result.isNewEntry)
+            return false;
+        write(SerializationTag::ObjectReference);
+        write(result.iterator->value);
+        return true;
+    }
+
+    bool serializeObject(JSObject*);
+    bool serializeProperties(JSObject*);
+    bool serializeArrayBuffer(JSArrayBuffer*);
+
+    JSGlobalObject& m_globalObject;
+    VM& m_vm;
+    SerializedScriptValue& m_result;
+    const Vector<JSValue>& m_hostObjects;
+    HashMap<JSObject*, uint32_t> m_objects;
+    Vector<JSArrayBuffer*> m_transferList;
+};
+
+bool CloneSerializer::prepareTransferList(const Vector<JSValue>& transferList)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+    for (JSValue value : transferList) {
+        if (m_hostObjects.contains(value))
+            continue;
+
+        auto* arrayBuffer = jsDynamicCast<JSArrayBuffer*>(value);
+        if (!arrayBuffer || arrayBuffer->isShared()) {
+            throwDataCloneError(m_globalObject, scope, "Value in the transfer list is not transferable"_s);
+            return false;
+        }
+        if (arrayBuffer->impl()->isDetached()) {
+            throwDataCloneError(m_globalObject, scope, "ArrayBuffer in the transfer list is detached"_s);
+            return false;
+        }
+        if (m_transferList.contains(arrayBuffer)) {
+            throwDataCloneError(m_globalObject, scope, "ArrayBuffer appears in the transfer list more than once"_s);
+            return false;
+        }
+        m_transferList.append(arrayBuffer);
+    }
+    return true;
+}
+
+bool CloneSerializer::transferArrayBuffers()
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+    m_result.m_transferredArrayBuffers.resize(m_transferList.size());
+    for (size_t i = 0; i < m_transferList.size(); i++) {
+        if (!m_transferList[i]->impl()->transferTo(m_vm, m_result.m_transferredArrayBuffers[i])) {
+            throwDataCloneError(m_globalObject, scope, "ArrayBuffer in the transfer list could not be transferred"_s);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CloneSerializer::serialize(JSValue value)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+    if (value.isUndefined()) {
+        write(SerializationTag::Undefined);
+        return true;
+    }
+    if (value.isNull()) {
+        write(SerializationTag::Null);
+        return true;
+    }
+    if (value.isBoolean()) {
+        write(value.asBoolean() ? SerializationTag::True : SerializationTag::False);
+        return true;
+    }
+    if (value.isInt32()) {
+        write(SerializationTag::Int32);
+        write(value.asInt32());
+        return true;
+    }
+    if (value.isNumber()) {
+        write(SerializationTag::Double);
+        write(value.asNumber());
+        return true;
+    }
+    if (value.isString()) {
+        auto string = asString(value)->value(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        write(SerializationTag::String);
+        writeString(string);
+        return true;
+    }
+    if (value.isBigInt()) {
+        auto string = value.toWTFString(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        write(SerializationTag::BigInt);
+        writeString(string);
+        return true;
+    }
+    if (value.isSymbol()) {
+        throwDataCloneError(m_globalObject, scope, "Symbol values can't be cloned"_s);
+        return false;
+    }
+
+    RELEASE_AND_RETURN(scope, serializeObject(asObject(value)));
+}
+
+bool CloneSerializer::serializeObject(JSObject* object)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+    if (UNLIKELY(!m_vm.isSafeToRecurse())) {
+        throwStackOverflowError(&m_globalObject, scope);
+        return false;
+    }
+
+    if (writeReferenceIfSeen(object))
+        return true;
+
+    auto hostObjectIndex = m_hostObjects.find(JSValue(object));
+    if (hostObjectIndex != notFound) {
+        write(SerializationTag::HostObject);
+        write(static_cast<uint32_t>(hostObjectIndex));
+        return true;
+    }
+
+    if (object->isCallable()) {
+        throwDataCloneError(m_globalObject, scope, "Functions can't be cloned"_s);
+        return false;
+    }
+
+    switch (object->type()) {
+    case ProxyObjectType:
+    case JSPromiseType:
+    case JSWeakMapType:
+    case JSWeakSetType:
+        throwDataCloneError(m_globalObject, scope, makeString(object->classInfo()->className, " objects can't be cloned"_s));
+        return false;
+    default:
+        break;
+    }
+
+    if (auto* array = jsDynamicCast<JSArray*>(object)) {
+        // Only indexed elements are kept, like the other engines do.
+        unsigned length = array->length();
+        write(SerializationTag::Array);
+        write(static_cast<uint32_t>(length));
+        for (unsigned i = 0; i < length; i++) {
+            JSValue element;
+            if (array->canGetIndexQuickly(i)) {
+                element = array->getIndexQuickly(i);
+            } else {
+                bool exists = array->hasProperty(&m_globalObject, i);
+                RETURN_IF_EXCEPTION(scope, false);
+                if (!exists) {
+                    write(SerializationTag::ArrayHole);
+                    continue;
+                }
+                element = array->get(&m_globalObject, i);
+                RETURN_IF_EXCEPTION(scope, false);
+            }
+            bool ok = serialize(element);
+            RETURN_IF_EXCEPTION(scope, false);
+            if (!ok)
+                return false;
+        }
+        return true;
+    }
+
+    if (auto* arrayBuffer = jsDynamicCast<JSArrayBuffer*>(object))
+        RELEASE_AND_RETURN(scope, serializeArrayBuffer(arrayBuffer));
+
+    if (auto* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        if (view->isDetached()) {
+            throwDataCloneError(m_globalObject, scope, "Typed array is detached"_s);
+            return false;
+        }
+        write(SerializationTag::ArrayBufferView);
+        write(static_cast<uint8_t>(typedArrayType(view->type())));
+        write(static_cast<uint64_t>(view->byteOffset()));
+        write(static_cast<uint64_t>(view->length()));
+        auto* buffer = view->possiblySharedJSBuffer(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        RELEASE_AND_RETURN(scope, serializeObject(buffer));
+    }
+
+    if (auto* date = jsDynamicCast<DateInstance*>(object)) {
+        write(SerializationTag::Date);
+        write(date->internalNumber());
+        return true;
+    }
+
+    if (auto* regExp = jsDynamicCast<RegExpObject*>(object)) {
+        write(SerializationTag::RegExp);
+        writeString(regExp->regExp()->pattern());
+        write(static_cast<uint32_t>(regExp->regExp()->flags().toRaw()));
+        return true;
+    }
+
+    if (auto* error = jsDynamicCast<ErrorInstance*>(object)) {
+        write(SerializationTag::Error);
+        write(static_cast<uint8_t>(error->errorType()));
+        for (auto& name : { m_vm.propertyNames->message, m_vm.propertyNames->stack }) {
+            JSValue property = object->get(&m_globalObject, name);
+            RETURN_IF_EXCEPTION(scope, false);
+            auto string = property.isUndefined() ? String() : property.toWTFString(&m_globalObject);
+            RETURN_IF_EXCEPTION(scope, false);
+            writeString(string);
+        }
+        return true;
+    }
+
+    if (auto* booleanObject = jsDynamicCast<BooleanObject*>(object)) {
+        write(SerializationTag::BooleanObject);
+        write(static_cast<uint8_t>(booleanObject->internalValue().asBoolean()));
+        return true;
+    }
+
+    if (auto* numberObject = jsDynamicCast<NumberObject*>(object)) {
+        write(SerializationTag::NumberObject);
+        write(numberObject->internalValue().asNumber());
+        return true;
+    }
+
+    if (auto* stringObject = jsDynamicCast<StringObject*>(object)) {
+        auto string = stringObject->internalValue()->value(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, false);
+        write(SerializationTag::StringObject);
+        writeString(string);
+        return true;
+    }
+
+    if (jsDynamicCast<JSMap*>(object) || jsDynamicCast<JSSet*>(object)) {
+        bool isMap = jsDynamicCast<JSMap*>(object);
+        // Collect first: serializing an entry runs arbitrary getters, which
+        // must not run while the collection is being iterated.
+        MarkedArgumentBuffer entries;
+        forEachInIterable(&m_globalObject, object, [&](VM&, JSGlobalObject* globalObject, JSValue entry) {
+            if (!isMap) {
+                entries.append(entry);
+                return;
+            }
+            auto* pair = entry.getObject();
+            entries.append(pair->getIndex(globalObject, 0));
+            entries.append(pair->getIndex(globalObject, 1));
+        });
+        RETURN_IF_EXCEPTION(scope, false);
+
+        write(isMap ? SerializationTag::Map : SerializationTag::Set);
+        write(static_cast<uint32_t>(entries.size()));
+        for (size_t i = 0; i < entries.size(); i++) {
+            bool ok = serialize(entries.at(i));
+            RETURN_IF_EXCEPTION(scope, false);
+            if (!ok)
+                return false;
+        }
+        return true;
+    }
+
+    write(SerializationTag::Object);
+    RELEASE_AND_RETURN(scope, serializeProperties(object));
+}
+
+bool CloneSerializer::serializeProperties(JSObject* object)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+    PropertyNameArray propertyNames(m_vm, PropertyNameMode::Strings, PrivateSymbolMode::Exclude);
+    object->methodTable()->getOwnPropertyNames(object, &m_globalObject, propertyNames, DontEnumPropertiesMode::Exclude);
+    RETURN_IF_EXCEPTION(scope, false);
+
+    write(static_cast<uint32_t>(propertyNames.size()));
+    for (auto& propertyName : propertyNames) {
+        JSValue value = object->get(&m_globalObject, propertyName);
+        RETURN_IF_EXCEPTION(scope, false);
+        writeString(propertyName.string());
+        bool ok = serialize(value);
+        RETURN_IF_EXCEPTION(scope, false);
+        if (!ok)
+            return false;
+    }
+    return true;
+}
+
+bool CloneSerializer::serializeArrayBuffer(JSArrayBuffer* arrayBuffer)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+    auto* impl = arrayBuffer->impl();
+
+    if (arrayBuffer->isShared()) {
+        m_result.m_sharedArrayBuffers.append({});
+        if (!impl->shareWith(m_result.m_sharedArrayBuffers.last())) {
+            throwDataCloneError(m_globalObject, scope, "SharedArrayBuffer could not be shared"_s);
+            return false;
+        }
+        write(SerializationTag::SharedArrayBuffer);
+        write(static_cast<uint32_t>(m_result.m_sharedArrayBuffers.size() - 1));
+        return true;
+    }
+
+    if (impl->isDetached()) {
+        throwDataCloneError(m_globalObject, scope, "ArrayBuffer is detached"_s);
+        return false;
+    }
+
+    auto transferIndex = m_transferList.find(arrayBuffer);
+    if (transferIndex != notFound) {
+        write(SerializationTag::TransferredArrayBuffer);
+        write(static_cast<uint32_t>(transferIndex));
+        return true;
+    }
+
+    // Copy into a buffer nothing else references, so its contents can be
+    // moved out of this VM.
+    auto copy = ArrayBuffer::tryCreate(impl->data(), impl->byteLength());
+    m_result.m_arrayBuffers.append({});
+    if (!copy || !copy->transferTo(m_vm, m_result.m_arrayBuffers.last())) {
+        throwOutOfMemoryError(&m_globalObject, scope);
+        return false;
+    }
+    write(SerializationTag::ArrayBuffer);
+    write(static_cast<uint32_t>(m_result.m_arrayBuffers.size() - 1));
+    return true;
+}
+
+class CloneDeserializer {
+public:
+    CloneDeserializer(JSGlobalObject& globalObject, SerializedScriptValue& value, const Vector<JSValue>& hostObjects)
+        : m_globalObject(globalObject)
+        , m_vm(globalObject.vm())
+        , m_value(value)
+        , m_hostObjects(hostObjects)
+        , m_transferredArrayBuffers(value.m_transferredArrayBuffers.size())
+    {
+    }
+
+    JSValue deserialize();
+
+private:
+    template<typename T> T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        RELEASE_ASSERT(m_position + sizeof(T) <= m_value.m_data.size());
+        T value;
+        memcpy(&value, m_value.m_data.data() + m_position, sizeof(T));
+        m_position += sizeof(T);
+        return value;
+    }
+
+    const String& readString() { return m_value.m_strings[read<uint32_t>()]; }
+
+    // Objects are numbered when they are created, before their contents are
+    // read, matching the order the serializer saw them in.
+    uint32_t reserveObject()
+    {
+        m_objects.append(nullptr);
+        return m_objects.size() - 1;
+    }
+
+    JSObject* addObject(uint32_t index, JSObject* object)
+    {
+        m_objects[index] = object;
+        m_gcBuffer.append(object);
+        return object;
+    }
+
+    JSObject* addObject(JSObject* object) { return addObject(reserveObject(), object); }
+
+    JSArrayBuffer* createArrayBuffer(ArrayBufferContents&&, ArrayBufferSharingMode);
+    JSValue readArrayBufferView(uint32_t index);
+
+    JSGlobalObject& m_globalObject;
+    VM& m_vm;
+    SerializedScriptValue& m_value;
+    const Vector<JSValue>& m_hostObjects;
+    size_t m_position { 0 };
+    Vector<JSObject*> m_objects;
+    MarkedArgumentBuffer m_gcBuffer;
+    Vector<JSArrayBuffer*> m_transferredArrayBuffers;
+};
+
+JSArrayBuffer* CloneDeserializer::createArrayBuffer(ArrayBufferContents&& contents, ArrayBufferSharingMode mode)
+{
+    return JSArrayBuffer::create(m_vm, m_globalObject.arrayBufferStructure(mode), ArrayBuffer::create(WTFMove(contents)));
+}
+
+JSValue CloneDeserializer::readArrayBufferView(uint32_t index)
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+    auto type = static_cast<TypedArrayType>(read<uint8_t>());
+    auto byteOffset = read<uint64_t>();
+    auto length = read<uint64_t>();
+    JSValue buffer = deserialize();
+    RETURN_IF_EXCEPTION(scope, {});
+
+    JSObject* constructor = m_globalObject.typedArrayConstructor(type);
+    MarkedArgumentBuffer arguments;
+    arguments.append(buffer);
+    arguments.append(jsNumber(byteOffset));
+    arguments.append(jsNumber(length));
+    JSObject* view = construct(&m_globalObject, constructor, arguments, "Failed to construct typed array"_s);
+    RETURN_IF_EXCEPTION(scope, {});
+    return addObject(index, view);
+}
+
+JSValue CloneDeserializer::deserialize()
+{
+    auto scope = DECLARE_THROW_SCOPE(m_vm);
+
+    if (UNLIKELY(!m_vm.isSafeToRecurse())) {
+        throwStackOverflowError(&m_globalObject, scope);
+        return {};
+    }
+
+    switch (read<SerializationTag>()) {
+    case SerializationTag::Undefined:
+        return jsUndefined();
+    case SerializationTag::Null:
+        return jsNull();
+    case SerializationTag::True:
+        return jsBoolean(true);
+    case SerializationTag::False:
+        return jsBoolean(false);
+    case SerializationTag::Int32:
+        return jsNumber(read<int32_t>());
+    case SerializationTag::Double:
+        return jsNumber(read<double>());
+    case SerializationTag::String:
+        return jsString(m_vm, readString());
+    case SerializationTag::BigInt: {
+        JSValue bigIntFunction = m_globalObject.get(&m_globalObject, m_vm.propertyNames->BigInt);
+        RETURN_IF_EXCEPTION(scope, {});
+        MarkedArgumentBuffer arguments;
+        arguments.append(jsString(m_vm, readString()));
+        RELEASE_AND_RETURN(scope, call(&m_globalObject, bigIntFunction, getCallData(bigIntFunction), jsUndefined(), arguments));
+    }
+    case SerializationTag::ObjectReference:
+        return m_objects[read<uint32_t>()];
+    case SerializationTag::HostObject: {
+        JSValue hostObject = m_hostObjects[read<uint32_t>()];
+        addObject(hostObject.getObject());
+        return hostObject;
+    }
+    case SerializationTag::Object: {
+        JSObject* object = addObject(constructEmptyObject(&m_globalObject));
+        uint32_t count = read<uint32_t>();
+        for (uint32_t i = 0; i < count; i++) {
+            auto name = Identifier::fromString(m_vm, readString());
+            JSValue value = deserialize();
+            RETURN_IF_EXCEPTION(scope, {});
+            object->putDirectMayBeIndex(&m_globalObject, name, value);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        return object;
+    }
+    case SerializationTag::Array: {
+        uint32_t length = read<uint32_t>();
+        JSArray* array = constructEmptyArray(&m_globalObject, nullptr, length);
+        RETURN_IF_EXCEPTION(scope, {});
+        addObject(array);
+        for (uint32_t i = 0; i < length; i++) {
+            if (m_value.m_data[m_position] == static_cast<uint8_t>(SerializationTag::ArrayHole)) {
+                m_position++;
+                continue;
+            }
+            JSValue value = deserialize();
+            RETURN_IF_EXCEPTION(scope, {});
+            array->putDirectIndex(&m_globalObject, i, value);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        return array;
+    }
+    case SerializationTag::ArrayHole:
+        return jsUndefined();
+    case SerializationTag::Date:
+        return addObject(DateInstance::create(m_vm, m_globalObject.dateStructure(), read<double>()));
+    case SerializationTag::RegExp: {
+        const String& pattern = readString();
+        auto flags = OptionSet<Yarr::Flags>::fromRaw(read<uint32_t>());
+        RegExp* regExp = RegExp::create(m_vm, pattern, flags);
+        return addObject(RegExpObject::create(m_vm, m_globalObject.regExpStructure(), regExp));
+    }
+    case SerializationTag::Map: {
+        JSMap* map = JSMap::create(m_vm, m_globalObject.mapStructure());
+        addObject(map);
+        uint32_t count = read<uint32_t>();
+        for (uint32_t i = 0; i < count; i += 2) {
+            JSValue key = deserialize();
+            RETURN_IF_EXCEPTION(scope, {});
+            JSValue value = deserialize();
+            RETURN_IF_EXCEPTION(scope, {});
+            map->set(&m_globalObject, key, value);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        return map;
+    }
+    case SerializationTag::Set: {
+        JSSet* set = JSSet::create(m_vm, m_globalObject.setStructure());
+        addObject(set);
+        uint32_t count = read<uint32_t>();
+        for (uint32_t i = 0; i < count; i++) {
+            JSValue key = deserialize();
+            RETURN_IF_EXCEPTION(scope, {});
+            set->add(&m_globalObject, key);
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        return set;
+    }
+    case SerializationTag::Error: {
+        auto errorType = static_cast<ErrorType>(read<uint8_t>());
+        const String& message = readString();
+        const String& stack = readString();
+        JSObject* error = addObject(createError(&m_globalObject, errorType, message));
+        if (!stack.isNull())
+            error->putDirect(m_vm, m_vm.propertyNames->stack, jsString(m_vm, stack), static_cast<unsigned>(PropertyAttribute::DontEnum));
+        return error;
+    }
+    case SerializationTag::BooleanObject: {
+        JSObject* object = jsBoolean(read<uint8_t>()).toObject(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        return addObject(object);
+    }
+    case SerializationTag::NumberObject: {
+        JSObject* object = jsNumber(read<double>()).toObject(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        return addObject(object);
+    }
+    case SerializationTag::StringObject: {
+        JSObject* object = jsString(m_vm, readString())->toObject(&m_globalObject);
+        RETURN_IF_EXCEPTION(scope, {});
+        return addObject(object);
+    }
+    case SerializationTag::ArrayBuffer: {
+        auto& contents = m_value.m_arrayBuffers[read<uint32_t>()];
+        return addObject(createArrayBuffer(WTFMove(contents), ArrayBufferSharingMode::Default));
+    }
+    case SerializationTag::TransferredArrayBuffer: {
+        uint32_t index = read<uint32_t>();
+        if (!m_transferredArrayBuffers[index]) {
+            auto& contents = m_value.m_transferredArrayBuffers[index];
+            m_transferredArrayBuffers[index] = createArrayBuffer(WTFMove(contents), ArrayBufferSharingMode::Default);
+        }
+        return addObject(m_transferredArrayBuffers[index]);
+    }
+    case SerializationTag::SharedArrayBuffer: {
+        auto& contents = m_value.m_sharedArrayBuffers[read<uint32_t>()];
+        return addObject(createArrayBuffer(WTFMove(contents), ArrayBufferSharingMode::Shared));
+    }
+    case SerializationTag::ArrayBufferView:
+        RELEASE_AND_RETURN(scope, readArrayBufferView(reserveObject()));
+    case SerializationTag::End:
+        break;
+    }
+
+    RELEASE_ASSERT_NOT_REACHED();
+    return {};
+}
+
+RefPtr<SerializedScriptValue> SerializedScriptValue::create(JSGlobalObject& globalObject, JSValue value, const Vector<JSValue>& transferList, const Vector<JSValue>& hostObjects)
+{
+    auto scope = DECLARE_THROW_SCOPE(globalObject.vm());
+    auto result = adoptRef(*new SerializedScriptValue());
+    CloneSerializer serializer(globalObject, result.get(), hostObjects);
+
+    bool ok = serializer.prepareTransferList(transferList);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!ok)
+        return nullptr;
+
+    ok = serializer.serialize(value);
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!ok)
+        return nullptr;
+
+    // Only detach the transferred buffers once nothing else can fail.
+    ok = serializer.transferArrayBuffers();
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    if (!ok)
+        return nullptr;
+
+    result->m_data.shrinkToFit();
+    return result;
+}
+
+JSValue SerializedScriptValue::deserialize(JSGlobalObject& globalObject, const Vector<JSValue>& hostObjects)
+{
+    CloneDeserializer deserializer(globalObject, *this, hostObjects);
+    return deserializer.deserialize();
+}
+
+SerializedScriptValue::~SerializedScriptValue() = default;
+
+static Vector<JSValue> toVector(const EncodedJSValue* values, size_t length)
+{
+    Vector<JSValue> result;
+    result.reserveInitialCapacity(length);
+    for (size_t i = 0; i < length; i++)
+        result.uncheckedAppend(JSValue::decode(values[i]));
+    return result;
+}
+
+JSC_DEFINE_HOST_FUNCTION(functionStructuredClone, (JSGlobalObject * globalObject, CallFrame* callFrame))
+{
+    VM& vm = globalObject->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    if (callFrame->argumentCount() == 0) {
+        throwTypeError(globalObject, scope, "structuredClone requires 1 argument"_s);
+        return {};
+    }
+
+    Vector<JSValue> transferList;
+    JSValue options = callFrame->argument(1);
+    if (options.isObject()) {
+        JSValue transfer = options.getObject()->get(globalObject, Identifier::fromString(vm, "transfer"_s));
+        RETURN_IF_EXCEPTION(scope, {});
+        if (!transfer.isUndefined()) {
+            forEachInIterable(globalObject, transfer, [&](VM&, JSGlobalObject*, JSValue value) {
+                transferList.append(value);
+            });
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+    }
+
+    auto serialized = SerializedScriptValue::create(*globalObject, callFrame->argument(0), transferList, {});
+    RETURN_IF_EXCEPTION(scope, {});
+    RELEASE_AND_RETURN(scope, JSValue::encode(serialized->deserialize(*globalObject, {})));
+}
+
+} // namespace WebCore
+
+using WebCore::SerializedScriptValue;
+
+// Returns an owned reference, or null with an exception thrown.
+extern "C" SerializedScriptValue* SerializedScriptValue__create(JSC::JSGlobalObject* globalObject, JSC::EncodedJSValue value, const JSC::EncodedJSValue* transferList, size_t transferListLength, const JSC::EncodedJSValue* hostObjects, size_t hostObjectsLength)
+{
+    auto serialized = SerializedScriptValue::create(*globalObject, JSC::JSValue::decode(value), WebCore::toVector(transferList, transferListLength), WebCore::toVector(hostObjects, hostObjectsLength));
+    return serialized.leakRef();
+}
+
+// Messages are delivered from the event loop, where there is no caller to
+// rethrow to, so a failure is handed back as the returned value instead.
+extern "C" JSC::EncodedJSValue SerializedScriptValue__deserialize(SerializedScriptValue* serialized, JSC::JSGlobalObject* globalObject, const JSC::EncodedJSValue* hostObjects, size_t hostObjectsLength, bool* threw)
+{
+    auto scope = DECLARE_CATCH_SCOPE(globalObject->vm());
+    JSC::JSValue result = serialized->deserialize(*globalObject, WebCore::toVector(hostObjects, hostObjectsLength));
+    if (auto* exception = scope.exception()) {
+        scope.clearException();
+        *threw = true;
+        return JSC::JSValue::encode(exception->value());
+    }
+    *threw = false;
+    return JSC::JSValue::encode(result);
+}
+
+extern "C" void SerializedScriptValue__deref(SerializedScriptValue* serialized)
+{
+    serialized->deref();
+}
+
+extern "C" void SerializedScriptValue__throwDataCloneError(JSC::JSGlobalObject* globalObject, const ZigString* message)
+{
+    auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+    WebCore::throwDataCloneError(*globalObject, scope, Zig::toStringCopy(*message));
+}
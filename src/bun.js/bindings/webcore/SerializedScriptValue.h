@@ -0,0 +1,46 @@
+#pragma once
+
+#include "root.h"
+
+#include "JavaScriptCore/ArrayBuffer.h"
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// A value serialized with the structured clone algorithm, so it can be
+// rebuilt in another global object, on another thread. Strings are isolated
+// copies and ArrayBuffer contents are detached from their VM, so after
+// create() returns nothing in here refers to the source VM.
+//
+// Host objects (message ports) are not serialized. They are recorded by their
+// index in the list passed to create() and substituted back in deserialize();
+// moving them between threads is up to the caller.
+class SerializedScriptValue : public ThreadSafeRefCounted<SerializedScriptValue> {
+public:
+    // Returns null with an exception on the scope when the value can't be
+    // cloned. ArrayBuffers in `transferList` are detached from their owners.
+    static RefPtr<SerializedScriptValue> create(JSC::JSGlobalObject&, JSC::JSValue, const Vector<JSC::JSValue>& transferList, const Vector<JSC::JSValue>& hostObjects);
+
+    // Can only be called once: transferred and copied buffers are moved into
+    // the new global object.
+    JSC::JSValue deserialize(JSC::JSGlobalObject&, const Vector<JSC::JSValue>& hostObjects);
+
+    ~SerializedScriptValue();
+
+private:
+    friend class CloneSerializer;
+    friend class CloneDeserializer;
+
+    SerializedScriptValue() = default;
+
+    Vector<uint8_t> m_data;
+    Vector<String> m_strings;
+    Vector<JSC::ArrayBufferContents> m_arrayBuffers;
+    Vector<JSC::ArrayBufferContents> m_transferredArrayBuffers;
+    Vector<JSC::ArrayBufferContents> m_sharedArrayBuffers;
+};
+
+JSC_DECLARE_HOST_FUNCTION(functionStructuredClone);
+
+} // namespace WebCore
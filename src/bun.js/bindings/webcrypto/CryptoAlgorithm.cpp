@@ -92,13 +92,24 @@ ExceptionOr<size_t> CryptoAlgorithm::getKeyLength(const CryptoAlgorithmParameter
     return Exception { NotSupportedError };
 }
 
+// The results passed back (Vector<uint8_t> and bool) own nothing tied to the
+// work queue thread, so only an exception message needs an isolated copy.
+// Moving the value saves copying large encrypt/decrypt outputs again.
+template<typename T>
+static ExceptionOr<T> isolatedResult(ExceptionOr<T>&& result)
+{
+    if (result.hasException())
+        return isolatedCopy(result.releaseException());
+    return result.releaseReturnValue();
+}
+
 template<typename ResultCallbackType, typename OperationType>
 static void dispatchAlgorithmOperation(WorkQueue& workQueue, ScriptExecutionContext& context, ResultCallbackType&& callback, CryptoAlgorithm::ExceptionCallback&& exceptionCallback, OperationType&& operation)
 {
     workQueue.dispatch(
         [operation = WTFMove(operation), callback = WTFMove(callback), exceptionCallback = WTFMove(exceptionCallback), contextIdentifier = context.identifier()]() mutable {
             auto result = operation();
-            ScriptExecutionContext::postTaskTo(contextIdentifier, [result = crossThreadCopy(WTFMove(result)), callback = WTFMove(callback), exceptionCallback = WTFMove(exceptionCallback)](auto&) mutable {
+            ScriptExecutionContext::postTaskTo(contextIdentifier, [result = isolatedResult(WTFMove(result)), callback = WTFMove(callback), exceptionCallback = WTFMove(exceptionCallback)](auto&) mutable {
                 if (result.hasException()) {
                     exceptionCallback(result.releaseException().code());
                     return;
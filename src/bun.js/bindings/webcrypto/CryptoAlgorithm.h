@@ -58,7 +58,7 @@ public:
     using KeyCallback = Function<void(CryptoKey&)>;
     using KeyOrKeyPairCallback = Function<void(KeyOrKeyPair&&)>;
     // FIXME: https://bugs.webkit.org/show_bug.cgi?id=169395
-    using VectorCallback = Function<void(const Vector<uint8_t>&)>;
+    using VectorCallback = Function<void(Vector<uint8_t>&&)>;
     using VoidCallback = Function<void()>;
     using ExceptionCallback = Function<void(ExceptionCode)>;
     using KeyDataCallback = Function<void(CryptoKeyFormat, KeyData&&)>;
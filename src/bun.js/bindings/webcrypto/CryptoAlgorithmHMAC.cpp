@@ -42,6 +42,11 @@ static constexpr auto ALG384 = "HS384"_s;
 static constexpr auto ALG512 = "HS512"_s;
 }
 
+// HMAC over a small message costs less than posting it to the work queue and
+// back, so those are computed right away. The promise still settles
+// asynchronously from the caller's point of view.
+static constexpr size_t maxSynchronousHMACDataSize = 16 * 1024;
+
 static inline bool usagesAreInvalidForCryptoAlgorithmHMAC(CryptoKeyUsageBitmap usages)
 {
     return usages & (CryptoKeyUsageEncrypt | CryptoKeyUsageDecrypt | CryptoKeyUsageDeriveKey | CryptoKeyUsageDeriveBits | CryptoKeyUsageWrapKey | CryptoKeyUsageUnwrapKey);
@@ -59,6 +64,16 @@ CryptoAlgorithmIdentifier CryptoAlgorithmHMAC::identifier() const
 
 void CryptoAlgorithmHMAC::sign(const CryptoAlgorithmParameters&, Ref<CryptoKey>&& key, Vector<uint8_t>&& data, VectorCallback&& callback, ExceptionCallback&& exceptionCallback, ScriptExecutionContext& context, WorkQueue& workQueue)
 {
+    if (data.size() <= maxSynchronousHMACDataSize) {
+        auto result = platformSign(downcast<CryptoKeyHMAC>(key.get()), data);
+        if (result.hasException()) {
+            exceptionCallback(result.releaseException().code());
+            return;
+        }
+        callback(result.releaseReturnValue());
+        return;
+    }
+
     dispatchOperationInWorkQueue(workQueue, context, WTFMove(callback), WTFMove(exceptionCallback),
         [key = WTFMove(key), data = WTFMove(data)] {
             return platformSign(downcast<CryptoKeyHMAC>(key.get()), data);
@@ -67,6 +82,16 @@ void CryptoAlgorithmHMAC::sign(const CryptoAlgorithmParameters&, Ref<CryptoKey>&
 
 void CryptoAlgorithmHMAC::verify(const CryptoAlgorithmParameters&, Ref<CryptoKey>&& key, Vector<uint8_t>&& signature, Vector<uint8_t>&& data, BoolCallback&& callback, ExceptionCallback&& exceptionCallback, ScriptExecutionContext& context, WorkQueue& workQueue)
 {
+    if (data.size() <= maxSynchronousHMACDataSize) {
+        auto result = platformVerify(downcast<CryptoKeyHMAC>(key.get()), signature, data);
+        if (result.hasException()) {
+            exceptionCallback(result.releaseException().code());
+            return;
+        }
+        callback(result.releaseReturnValue());
+        return;
+    }
+
     dispatchOperationInWorkQueue(workQueue, context, WTFMove(callback), WTFMove(exceptionCallback),
         [key = WTFMove(key), signature = WTFMove(signature), data = WTFMove(data)] {
             return platformVerify(downcast<CryptoKeyHMAC>(key.get()), signature, data);
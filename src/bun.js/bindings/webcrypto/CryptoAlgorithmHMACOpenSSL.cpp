@@ -36,13 +36,10 @@
 
 namespace WebCore {
 
-static std::optional<Vector<uint8_t>> calculateSignature(const EVP_MD* algorithm, const Vector<uint8_t>& key, const uint8_t* data, size_t dataLength)
+static std::optional<Vector<uint8_t>> calculateSignature(const EVP_MD* algorithm, const CryptoKeyHMAC& key, const uint8_t* data, size_t dataLength)
 {
-    HMACCtxPtr ctx;
-    if (!(ctx = HMACCtxPtr(HMAC_CTX_new())))
-        return std::nullopt;
-
-    if (1 != HMAC_Init_ex(ctx.get(), key.data(), key.size(), algorithm, nullptr))
+    auto ctx = key.copyKeyedContext(algorithm);
+    if (!ctx)
         return std::nullopt;
 
     // Call update with the message
@@ -65,7 +62,7 @@ ExceptionOr<Vector<uint8_t>> CryptoAlgorithmHMAC::platformSign(const CryptoKeyHM
     if (!algorithm)
         return Exception { OperationError };
 
-    auto result = calculateSignature(algorithm, key.key(), data.data(), data.size());
+    auto result = calculateSignature(algorithm, key, data.data(), data.size());
     if (!result)
         return Exception { OperationError };
     return WTFMove(*result);
@@ -77,7 +74,7 @@ ExceptionOr<bool> CryptoAlgorithmHMAC::platformVerify(const CryptoKeyHMAC& key,
     if (!algorithm)
         return Exception { OperationError };
 
-    auto expectedSignature = calculateSignature(algorithm, key.key(), data.data(), data.size());
+    auto expectedSignature = calculateSignature(algorithm, key, data.data(), data.size());
     if (!expectedSignature)
         return Exception { OperationError };
     // Using a constant time comparison to prevent timing attacks.
@@ -148,4 +148,45 @@ Vector<uint8_t> CryptoDigest::computeHash()
     return m_context->computeHash();
 }
 
+size_t CryptoDigest::digestLength(CryptoDigest::Algorithm algorithm)
+{
+    switch (algorithm) {
+    case CryptoDigest::Algorithm::SHA_1:
+        return SHA1Functions::digestLength;
+    case CryptoDigest::Algorithm::SHA_224:
+        return SHA224Functions::digestLength;
+    case CryptoDigest::Algorithm::SHA_256:
+        return SHA256Functions::digestLength;
+    case CryptoDigest::Algorithm::SHA_384:
+        return SHA384Functions::digestLength;
+    case CryptoDigest::Algorithm::SHA_512:
+        return SHA512Functions::digestLength;
+    }
+
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+void CryptoDigest::computeHash(CryptoDigest::Algorithm algorithm, const void* input, size_t length, uint8_t* output)
+{
+    auto* bytes = static_cast<const uint8_t*>(input);
+
+    switch (algorithm) {
+    case CryptoDigest::Algorithm::SHA_1:
+        SHA1(bytes, length, output);
+        return;
+    case CryptoDigest::Algorithm::SHA_224:
+        SHA224(bytes, length, output);
+        return;
+    case CryptoDigest::Algorithm::SHA_256:
+        SHA256(bytes, length, output);
+        return;
+    case CryptoDigest::Algorithm::SHA_384:
+        SHA384(bytes, length, output);
+        return;
+    case CryptoDigest::Algorithm::SHA_512:
+        SHA512(bytes, length, output);
+        return;
+    }
+}
+
 } // namespace PAL
@@ -55,6 +55,11 @@ public:
     PAL_EXPORT Vector<uint8_t> computeHash();
     PAL_EXPORT String toHexString();
 
+    // One-shot hashing without allocating a context. `output` must hold
+    // digestLength(algorithm) bytes.
+    PAL_EXPORT static size_t digestLength(Algorithm);
+    PAL_EXPORT static void computeHash(Algorithm, const void* input, size_t length, uint8_t* output);
+
 private:
     CryptoDigest();
 
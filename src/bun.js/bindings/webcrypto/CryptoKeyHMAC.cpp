@@ -69,6 +69,25 @@ CryptoKeyHMAC::CryptoKeyHMAC(Vector<uint8_t>&& key, CryptoAlgorithmIdentifier ha
 
 CryptoKeyHMAC::~CryptoKeyHMAC() = default;
 
+#if USE(OPENSSL)
+HMACCtxPtr CryptoKeyHMAC::copyKeyedContext(const EVP_MD* algorithm) const
+{
+    Locker locker { m_keyedContextLock };
+
+    if (!m_keyedContext) {
+        HMACCtxPtr keyedContext(HMAC_CTX_new());
+        if (!keyedContext || 1 != HMAC_Init_ex(keyedContext.get(), m_key.data(), m_key.size(), algorithm, nullptr))
+            return nullptr;
+        m_keyedContext = WTFMove(keyedContext);
+    }
+
+    HMACCtxPtr ctx(HMAC_CTX_new());
+    if (!ctx || 1 != HMAC_CTX_copy(ctx.get(), m_keyedContext.get()))
+        return nullptr;
+    return ctx;
+}
+#endif
+
 RefPtr<CryptoKeyHMAC> CryptoKeyHMAC::generate(size_t lengthBits, CryptoAlgorithmIdentifier hash, bool extractable, CryptoKeyUsageBitmap usages)
 {
     if (!lengthBits) {
@@ -32,6 +32,11 @@
 #include <wtf/Function.h>
 #include <wtf/Vector.h>
 
+#if USE(OPENSSL)
+#include "OpenSSLCryptoUniquePtr.h"
+#include <wtf/Lock.h>
+#endif
+
 namespace WebCore {
 
 class CryptoAlgorithmParameters;
@@ -57,6 +62,12 @@ public:
 
     CryptoAlgorithmIdentifier hashAlgorithmIdentifier() const { return m_hash; }
 
+#if USE(OPENSSL)
+    // Returns a copy of a context that was keyed once with this key, so each
+    // sign/verify skips deriving the inner and outer pads again.
+    HMACCtxPtr copyKeyedContext(const EVP_MD*) const;
+#endif
+
     static ExceptionOr<size_t> getKeyLength(const CryptoAlgorithmParameters&);
 
 private:
@@ -67,6 +78,11 @@ private:
 
     CryptoAlgorithmIdentifier m_hash;
     Vector<uint8_t> m_key;
+
+#if USE(OPENSSL)
+    mutable Lock m_keyedContextLock;
+    mutable HMACCtxPtr m_keyedContext WTF_GUARDED_BY_LOCK(m_keyedContextLock);
+#endif
 };
 
 } // namespace WebCore
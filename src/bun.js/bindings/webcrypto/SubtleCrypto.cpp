@@ -30,6 +30,7 @@
 
 #include "CryptoAlgorithm.h"
 #include "CryptoAlgorithmRegistry.h"
+#include "CryptoDigest.h"
 #include "JSAesCbcCfbParams.h"
 #include "JSAesCtrParams.h"
 #include "JSAesGcmParams.h"
@@ -51,17 +52,47 @@
 #include "JSRsaKeyGenParams.h"
 #include "JSRsaOaepParams.h"
 #include "JSRsaPssParams.h"
+#include <JavaScriptCore/JSArrayBuffer.h>
 #include <JavaScriptCore/JSONObject.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/text/StringToIntegerConversion.h>
 
 namespace WebCore {
 using namespace JSC;
 
+static constexpr unsigned maxCryptoWorkQueueCount = 16;
+
+// BUN_CRYPTO_THREADS overrides the number of threads, which otherwise
+// defaults to the number of cores.
+static unsigned cryptoWorkQueueCount()
+{
+    static unsigned count = [] {
+        unsigned value = WTF::numberOfProcessorCores();
+        if (const char* env = getenv("BUN_CRYPTO_THREADS")) {
+            if (auto parsed = parseInteger<unsigned>(StringView::fromLatin1(env)); parsed && *parsed > 0)
+                value = *parsed;
+        }
+        return std::clamp(value, 1u, maxCryptoWorkQueueCount);
+    }();
+    return count;
+}
+
 SubtleCrypto::SubtleCrypto(ScriptExecutionContext* context)
     : ContextDestructionObserver(context)
-    , m_workQueue(WorkQueue::create("com.apple.WebKit.CryptoQueue"))
 {
 }
 
+WorkQueue& SubtleCrypto::workQueue()
+{
+    unsigned index = m_nextWorkQueue++ % cryptoWorkQueueCount();
+
+    // Threads are only started once there is enough work to reach them.
+    if (index == m_workQueues.size())
+        m_workQueues.append(WorkQueue::create("com.apple.WebKit.CryptoQueue"));
+
+    return m_workQueues[index].get();
+}
+
 SubtleCrypto::~SubtleCrypto() = default;
 
 enum class Operations {
@@ -606,16 +637,16 @@ void SubtleCrypto::encrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& alg
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis](const Vector<uint8_t>& cipherText) mutable {
+    auto callback = [index, weakThis](Vector<uint8_t>&& cipherText) mutable {
         if (auto promise = getPromise(index, weakThis))
-            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), cipherText.data(), cipherText.size());
+            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(cipherText));
     };
     auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
         if (auto promise = getPromise(index, weakThis))
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->encrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->encrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::decrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -646,16 +677,16 @@ void SubtleCrypto::decrypt(JSC::JSGlobalObject& state, AlgorithmIdentifier&& alg
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis](const Vector<uint8_t>& plainText) mutable {
+    auto callback = [index, weakThis](Vector<uint8_t>&& plainText) mutable {
         if (auto promise = getPromise(index, weakThis))
-            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), plainText.data(), plainText.size());
+            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(plainText));
     };
     auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
         if (auto promise = getPromise(index, weakThis))
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->decrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->decrypt(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -684,16 +715,16 @@ void SubtleCrypto::sign(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algori
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis](const Vector<uint8_t>& signature) mutable {
+    auto callback = [index, weakThis](Vector<uint8_t>&& signature) mutable {
         if (auto promise = getPromise(index, weakThis))
-            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), signature.data(), signature.size());
+            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(signature));
     };
     auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
         if (auto promise = getPromise(index, weakThis))
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->sign(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->sign(*params, key, WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& key, BufferSource&& signatureBufferSource, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -732,7 +763,7 @@ void SubtleCrypto::verify(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->verify(*params, key, WTFMove(signature), WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->verify(*params, key, WTFMove(signature), WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::digest(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, BufferSource&& dataBufferSource, Ref<DeferredPromise>&& promise)
@@ -751,16 +782,162 @@ void SubtleCrypto::digest(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algo
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis](const Vector<uint8_t>& digest) mutable {
+    auto callback = [index, weakThis](Vector<uint8_t>&& digest) mutable {
         if (auto promise = getPromise(index, weakThis))
-            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), digest.data(), digest.size());
+            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(digest));
     };
     auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
         if (auto promise = getPromise(index, weakThis))
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->digest(WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->digest(WTFMove(data), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
+}
+
+static std::optional<PAL::CryptoDigest::Algorithm> toCryptoDigestAlgorithm(CryptoAlgorithmIdentifier identifier)
+{
+    switch (identifier) {
+    case CryptoAlgorithmIdentifier::SHA_1:
+        return PAL::CryptoDigest::Algorithm::SHA_1;
+    case CryptoAlgorithmIdentifier::SHA_224:
+        return PAL::CryptoDigest::Algorithm::SHA_224;
+    case CryptoAlgorithmIdentifier::SHA_256:
+        return PAL::CryptoDigest::Algorithm::SHA_256;
+    case CryptoAlgorithmIdentifier::SHA_384:
+        return PAL::CryptoDigest::Algorithm::SHA_384;
+    case CryptoAlgorithmIdentifier::SHA_512:
+        return PAL::CryptoDigest::Algorithm::SHA_512;
+    default:
+        return std::nullopt;
+    }
+}
+
+// Below this many input bytes per queue, handing work to another thread costs
+// more than hashing it where it is.
+static constexpr size_t minDigestManyBytesPerQueue = 64 * 1024;
+
+// Inputs are copied back to back into one buffer when the call is made, and
+// every digest is written into one output buffer. Each chunk of the batch
+// hashes a disjoint range of inputs on its own work queue.
+class DigestManyJob : public ThreadSafeRefCounted<DigestManyJob> {
+public:
+    static Ref<DigestManyJob> create(PAL::CryptoDigest::Algorithm algorithm, Vector<BufferSource::VariantType>&& sources)
+    {
+        return adoptRef(*new DigestManyJob(algorithm, WTFMove(sources)));
+    }
+
+    size_t size() const { return m_offsets.size() - 1; }
+    size_t inputLength() const { return m_input.size(); }
+    size_t digestLength() const { return m_digestLength; }
+    const uint8_t* digestAt(size_t index) const { return m_output.data() + index * m_digestLength; }
+
+    void setPendingChunks(unsigned count) { m_pendingChunks.store(count); }
+
+    // Returns true for whichever chunk finishes last.
+    bool hash(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            PAL::CryptoDigest::computeHash(m_algorithm, m_input.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i], m_output.data() + i * m_digestLength);
+        return m_pendingChunks.fetch_sub(1) == 1;
+    }
+
+private:
+    DigestManyJob(PAL::CryptoDigest::Algorithm algorithm, Vector<BufferSource::VariantType>&& sources)
+        : m_algorithm(algorithm)
+        , m_digestLength(PAL::CryptoDigest::digestLength(algorithm))
+    {
+        Vector<BufferSource> buffers;
+        buffers.reserveInitialCapacity(sources.size());
+        size_t totalLength = 0;
+        for (auto& source : sources) {
+            buffers.uncheckedAppend(BufferSource { WTFMove(source) });
+            totalLength += buffers.last().length();
+        }
+
+        m_input.reserveInitialCapacity(totalLength);
+        m_offsets.reserveInitialCapacity(buffers.size() + 1);
+        m_offsets.uncheckedAppend(0);
+        for (auto& buffer : buffers) {
+            m_input.append(buffer.data(), buffer.length());
+            m_offsets.uncheckedAppend(m_input.size());
+        }
+        m_output.grow(buffers.size() * m_digestLength);
+    }
+
+    PAL::CryptoDigest::Algorithm m_algorithm;
+    size_t m_digestLength;
+    Vector<uint8_t> m_input;
+    Vector<size_t> m_offsets;
+    Vector<uint8_t> m_output;
+    std::atomic<unsigned> m_pendingChunks { 0 };
+};
+
+static void fulfillPromiseWithDigests(Ref<DeferredPromise>&& promise, const DigestManyJob& job)
+{
+    promise->resolveWithCallback([&](JSDOMGlobalObject& globalObject) -> JSValue {
+        auto& vm = globalObject.vm();
+        auto scope = DECLARE_THROW_SCOPE(vm);
+        auto* structure = globalObject.arrayBufferStructure(ArrayBufferSharingMode::Default);
+
+        auto* array = constructEmptyArray(&globalObject, nullptr, job.size());
+        RETURN_IF_EXCEPTION(scope, {});
+        for (size_t i = 0; i < job.size(); i++) {
+            auto buffer = ArrayBuffer::tryCreate(job.digestAt(i), job.digestLength());
+            if (UNLIKELY(!buffer)) {
+                throwOutOfMemoryError(&globalObject, scope);
+                return {};
+            }
+            array->putDirectIndex(&globalObject, i, JSArrayBuffer::create(vm, structure, buffer.releaseNonNull()));
+            RETURN_IF_EXCEPTION(scope, {});
+        }
+        return array;
+    });
+}
+
+void SubtleCrypto::digestMany(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, Vector<BufferSource::VariantType>&& dataBufferSources, Ref<DeferredPromise>&& promise)
+{
+    auto paramsOrException = normalizeCryptoAlgorithmParameters(state, WTFMove(algorithmIdentifier), Operations::Digest);
+    if (paramsOrException.hasException()) {
+        promise->reject(paramsOrException.releaseException());
+        return;
+    }
+    auto params = paramsOrException.releaseReturnValue();
+
+    auto digestAlgorithm = toCryptoDigestAlgorithm(params->identifier);
+    if (!digestAlgorithm) {
+        promise->reject(NotSupportedError);
+        return;
+    }
+
+    auto job = DigestManyJob::create(*digestAlgorithm, WTFMove(dataBufferSources));
+    size_t count = job->size();
+    if (!count) {
+        fulfillPromiseWithDigests(WTFMove(promise), job.get());
+        return;
+    }
+
+    size_t chunkCount = std::clamp<size_t>(job->inputLength() / minDigestManyBytesPerQueue, 1, std::min<size_t>(cryptoWorkQueueCount(), count));
+    size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+    chunkCount = (count + chunkSize - 1) / chunkSize;
+    job->setPendingChunks(chunkCount);
+
+    auto index = promise.ptr();
+    m_pendingPromises.add(index, WTFMove(promise));
+    WeakPtr weakThis { *this };
+    auto contextIdentifier = scriptExecutionContext()->identifier();
+
+    for (size_t begin = 0; begin < count; begin += chunkSize) {
+        size_t end = std::min(begin + chunkSize, count);
+        workQueue().dispatch([job, begin, end, index, weakThis, contextIdentifier]() mutable {
+            if (!job->hash(begin, end))
+                return;
+
+            ScriptExecutionContext::postTaskTo(contextIdentifier, [job = WTFMove(job), index, weakThis = WTFMove(weakThis)](auto&) mutable {
+                if (auto promise = getPromise(index, weakThis))
+                    fulfillPromiseWithDigests(promise.releaseNonNull(), job.get());
+            });
+        });
+    }
 }
 
 void SubtleCrypto::generateKey(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, bool extractable, Vector<CryptoKeyUsage>&& keyUsages, Ref<DeferredPromise>&& promise)
@@ -884,7 +1061,7 @@ void SubtleCrypto::deriveKey(JSC::JSGlobalObject& state, AlgorithmIdentifier&& a
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::deriveBits(JSC::JSGlobalObject& state, AlgorithmIdentifier&& algorithmIdentifier, CryptoKey& baseKey, unsigned length, Ref<DeferredPromise>&& promise)
@@ -911,16 +1088,16 @@ void SubtleCrypto::deriveBits(JSC::JSGlobalObject& state, AlgorithmIdentifier&&
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis](const Vector<uint8_t>& derivedKey) mutable {
+    auto callback = [index, weakThis](Vector<uint8_t>&& derivedKey) mutable {
         if (auto promise = getPromise(index, weakThis))
-            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), derivedKey.data(), derivedKey.size());
+            fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(derivedKey));
     };
     auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
         if (auto promise = getPromise(index, weakThis))
             rejectWithException(promise.releaseNonNull(), ec);
     };
 
-    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    algorithm->deriveBits(*params, baseKey, length, WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 void SubtleCrypto::importKey(JSC::JSGlobalObject& state, KeyFormat format, KeyDataVariant&& keyDataVariant, AlgorithmIdentifier&& algorithmIdentifier, bool extractable, Vector<CryptoKeyUsage>&& keyUsages, Ref<DeferredPromise>&& promise)
@@ -1057,7 +1234,7 @@ void SubtleCrypto::wrapKey(JSC::JSGlobalObject& state, KeyFormat format, CryptoK
     auto index = promise.ptr();
     m_pendingPromises.add(index, WTFMove(promise));
     WeakPtr weakThis { *this };
-    auto callback = [index, weakThis, wrapAlgorithm, wrappingKey = Ref { wrappingKey }, wrapParams = WTFMove(wrapParams), isEncryption, context, workQueue = m_workQueue](SubtleCrypto::KeyFormat format, KeyData&& key) mutable {
+    auto callback = [index, weakThis, wrapAlgorithm, wrappingKey = Ref { wrappingKey }, wrapParams = WTFMove(wrapParams), isEncryption, context, queue = Ref { workQueue() }](SubtleCrypto::KeyFormat format, KeyData&& key) mutable {
         if (weakThis) {
             if (auto promise = weakThis->m_pendingPromises.get(index)) {
                 Vector<uint8_t> bytes;
@@ -1076,9 +1253,9 @@ void SubtleCrypto::wrapKey(JSC::JSGlobalObject& state, KeyFormat format, CryptoK
                 }
                 }
 
-                auto callback = [index, weakThis](const Vector<uint8_t>& wrappedKey) mutable {
+                auto callback = [index, weakThis](Vector<uint8_t>&& wrappedKey) mutable {
                     if (auto promise = getPromise(index, weakThis))
-                        fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), wrappedKey.data(), wrappedKey.size());
+                        fulfillPromiseWithArrayBuffer(promise.releaseNonNull(), WTFMove(wrappedKey));
                 };
                 auto exceptionCallback = [index, weakThis](ExceptionCode ec) mutable {
                     if (auto promise = getPromise(index, weakThis))
@@ -1093,7 +1270,7 @@ void SubtleCrypto::wrapKey(JSC::JSGlobalObject& state, KeyFormat format, CryptoK
                     return;
                 }
                 // The following operation should be performed asynchronously.
-                wrapAlgorithm->encrypt(*wrapParams, WTFMove(wrappingKey), WTFMove(bytes), WTFMove(callback), WTFMove(exceptionCallback), *context, workQueue);
+                wrapAlgorithm->encrypt(*wrapParams, WTFMove(wrappingKey), WTFMove(bytes), WTFMove(callback), WTFMove(exceptionCallback), *context, queue);
             }
         }
     };
@@ -1221,7 +1398,7 @@ void SubtleCrypto::unwrapKey(JSC::JSGlobalObject& state, KeyFormat format, Buffe
         return;
     }
 
-    unwrapAlgorithm->decrypt(*unwrapParams, unwrappingKey, WTFMove(wrappedKey), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), m_workQueue);
+    unwrapAlgorithm->decrypt(*unwrapParams, unwrappingKey, WTFMove(wrappedKey), WTFMove(callback), WTFMove(exceptionCallback), *scriptExecutionContext(), workQueue());
 }
 
 }
@@ -294,6 +294,11 @@ pub const GarbageCollectionController = struct {
         this.gc_timer_interval = gc_timer_interval;
     }
 
+    pub fn deinit(this: *GarbageCollectionController) void {
+        this.gc_timer.deinit();
+        this.gc_repeating_timer.deinit();
+    }
+
     pub fn scheduleGCTimer(this: *GarbageCollectionController) void {
         this.gc_timer_state = .scheduled;
         this.gc_timer.set(this, onGCTimer, 16, 0);
@@ -411,9 +416,35 @@ pub const EventLoop = struct {
     defer_count: std.atomic.Atomic(usize) = std.atomic.Atomic(usize).init(0),
     forever_timer: ?*uws.Timer = null,
 
+    /// Set by the first thread to enqueue a concurrent task since the last
+    /// `tickConcurrent`. Other threads see it set and skip waking the loop,
+    /// so a burst of completions costs one wakeup instead of one each.
+    concurrent_wakeup_pending: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
+
+    /// Reported by `eventLoopStats()` in bun:jsc.
+    concurrent_stats: ConcurrentStats = .{},
+
+    pub const ConcurrentStats = struct {
+        /// Concurrent tasks drained on the JS thread.
+        tasks: u64 = 0,
+        /// Non-empty batches those tasks arrived in.
+        batches: u64 = 0,
+        /// Largest number of tasks waiting in one batch.
+        peak_depth: u64 = 0,
+        /// Times a producer actually woke the loop. Written off the JS thread.
+        wakeups: std.atomic.Atomic(u64) = std.atomic.Atomic(u64).init(0),
+    };
+
     pub const Queue = std.fifo.LinearFifo(Task, .Dynamic);
     const log = bun.Output.scoped(.EventLoop, false);
 
+    extern fn JSC__JSGlobalObject__drainMicrotasks(*JSGlobalObject) void;
+
+    /// Runs pending process.nextTick() callbacks ahead of the promise jobs.
+    pub fn drainMicrotasks(this: *EventLoop) void {
+        JSC__JSGlobalObject__drainMicrotasks(this.global);
+    }
+
     pub fn tickWithCount(this: *EventLoop) u32 {
         var global = this.global;
         var global_vm = global.vm();
@@ -499,7 +530,7 @@ pub const EventLoop = struct {
             }
 
             global_vm.releaseWeakRefs();
-            global_vm.drainMicrotasks();
+            this.drainMicrotasks();
         }
 
         this.tasks.head = if (this.tasks.count == 0) 0 else this.tasks.head;
@@ -511,11 +542,27 @@ pub const EventLoop = struct {
     }
 
     pub fn tickConcurrentWithCount(this: *EventLoop) usize {
+        // Clear the flag before popping: anything pushed after this point
+        // either lands in this batch or wakes the loop again.
+        _ = this.concurrent_wakeup_pending.swap(false, .AcqRel);
+
         var concurrent = this.concurrent_tasks.popBatch();
         const count = concurrent.count;
+
+        // popBatch() leaves behind a task whose producer is still linking it in.
+        // That producer may have skipped the wakeup, so make sure we come back for it.
+        if (!this.concurrent_tasks.isEmpty()) {
+            this.wakeupConcurrent();
+        }
+
         if (count == 0)
             return 0;
 
+        log("tickConcurrent: {d} tasks", .{count});
+        this.concurrent_stats.tasks += count;
+        this.concurrent_stats.batches += 1;
+        this.concurrent_stats.peak_depth = @max(this.concurrent_stats.peak_depth, count);
+
         var iter = concurrent.iterator();
         const start_count = this.tasks.count;
         if (start_count == 0) {
@@ -620,7 +667,7 @@ pub const EventLoop = struct {
                 this.tickConcurrent();
             } else {
                 global_vm.releaseWeakRefs();
-                global_vm.drainMicrotasks();
+                this.drainMicrotasks();
                 this.tickConcurrent();
                 if (this.tasks.count > 0) continue;
             }
@@ -642,7 +689,7 @@ pub const EventLoop = struct {
         var ctx = this.virtual_machine;
 
         ctx.global.vm().releaseWeakRefs();
-        ctx.global.vm().drainMicrotasks();
+        this.drainMicrotasks();
         var loop = ctx.uws_event_loop orelse return;
 
         if (loop.active > 0 or (ctx.us_loop_reference_count > 0 and !ctx.is_us_loop_entered and (loop.num_polls > 0 or this.start_server_on_next_tick))) {
@@ -750,13 +797,32 @@ pub const EventLoop = struct {
         JSC.markBinding(@src());
 
         this.concurrent_tasks.push(task);
+        this.wakeupConcurrent();
+    }
+
+    fn wakeupConcurrent(this: *EventLoop) void {
+        if (this.concurrent_wakeup_pending.swap(true, .AcqRel)) {
+            return;
+        }
 
+        _ = this.concurrent_stats.wakeups.fetchAdd(1, .Monotonic);
         if (this.virtual_machine.uws_event_loop) |loop| {
             loop.wakeup();
         }
     }
 };
 
+pub export fn Bun__EventLoop__stats(globalObject: *JSGlobalObject) JSValue {
+    JSC.markBinding(@src());
+    const stats = &globalObject.bunVM().eventLoop().concurrent_stats;
+    const object = JSValue.createEmptyObject(globalObject, 4);
+    object.put(globalObject, JSC.ZigString.static("concurrentTasks"), JSValue.jsNumber(stats.tasks));
+    object.put(globalObject, JSC.ZigString.static("concurrentBatches"), JSValue.jsNumber(stats.batches));
+    object.put(globalObject, JSC.ZigString.static("peakConcurrentDepth"), JSValue.jsNumber(stats.peak_depth));
+    object.put(globalObject, JSC.ZigString.static("wakeups"), JSValue.jsNumber(stats.wakeups.load(.Monotonic)));
+    return object;
+}
+
 pub const MiniEventLoop = struct {
     tasks: Queue,
     concurrent_tasks: UnboundedQueue(AnyTaskWithExtraContext, .next) = .{},
@@ -913,3 +979,9 @@ pub const AnyEventLoop = union(enum) {
         }
     }
 };
+
+comptime {
+    if (!JSC.is_bindgen) {
+        _ = Bun__EventLoop__stats;
+    }
+}
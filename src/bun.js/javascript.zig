@@ -292,6 +292,16 @@ pub export fn Bun__queueTaskWithTimeout(global: *JSGlobalObject, task: *JSC.CppT
     global.bunVM().eventLoop().enqueueTaskWithTimeout(Task.init(task), milliseconds);
 }
 
+/// Keeps the event loop alive while native code has work running on another
+/// thread. Both are called on the main thread.
+pub export fn Bun__refActiveTask(global: *JSGlobalObject) void {
+    global.bunVM().active_tasks += 1;
+}
+
+pub export fn Bun__unrefActiveTask(global: *JSGlobalObject) void {
+    global.bunVM().active_tasks -= 1;
+}
+
 pub export fn Bun__reportUnhandledError(globalObject: *JSGlobalObject, value: JSValue) callconv(.C) JSValue {
     var jsc_vm = globalObject.bunVM();
     jsc_vm.onUnhandledError(globalObject, value);
@@ -348,11 +358,16 @@ pub const ExitHandler = struct {
     extern fn Process__dispatchOnBeforeExit(*JSC.JSGlobalObject, code: u8) void;
     extern fn Process__dispatchOnExit(*JSC.JSGlobalObject, code: u8) void;
     extern fn Bun__closeAllSQLiteDatabasesForTermination() void;
+    extern fn Zig__SourceProvider__commitAllCachedBytecode() void;
 
     pub fn dispatchOnExit(this: *ExitHandler) void {
         var vm = @fieldParentPtr(VirtualMachine, "exit_handler", this);
         Process__dispatchOnExit(vm.global, this.exit_code);
+
+        // Process-wide; a worker exiting must leave these to the main thread.
+        if (vm.worker != null) return;
         Bun__closeAllSQLiteDatabasesForTermination();
+        Zig__SourceProvider__commitAllCachedBytecode();
     }
 
     pub fn dispatchOnBeforeExit(this: *ExitHandler) void {
@@ -402,6 +417,8 @@ pub const VirtualMachine = struct {
 
     plugin_runner: ?PluginRunner = null,
     is_main_thread: bool = false,
+    /// Set when this VM runs inside a node:worker_threads Worker.
+    worker: ?*JSC.WebWorker = null,
     last_reported_error_for_dedupe: JSValue = .zero,
     exit_handler: ExitHandler = .{},
 
@@ -1581,8 +1598,16 @@ pub const VirtualMachine = struct {
         }
     }
 
-    // TODO:
-    pub fn deinit(_: *VirtualMachine) void {}
+    /// Destroys the JSC VM and everything this thread set up for it. The main
+    /// thread's VM lives as long as the process and never gets here. Memory
+    /// from `allocator` is left to the caller, which owns it.
+    pub fn deinit(this: *VirtualMachine) void {
+        this.global.vm().deinit(this.global);
+        if (this.uws_event_loop != null) this.gc_controller.deinit();
+        this.regular_event_loop.tasks.deinit();
+        source_code_printer = null;
+        VMHolder.vm = null;
+    }
 
     pub const ExceptionList = std.ArrayList(Api.JsException);
 
@@ -1666,6 +1691,22 @@ pub const VirtualMachine = struct {
                     return promise;
             }
 
+            // A cluster worker has to connect back to its primary whether or not
+            // it imports node:cluster. The module takes NODE_UNIQUE_ID out of
+            // process.env; drop it here too so that Bun.spawn() without an env
+            // doesn't pass it on. NODE_UNIQUE_ID alone may be inherited from a
+            // Node cluster, which has no socket for us to connect back to.
+            if (this.worker == null and this.bundler.env.map.get("NODE_UNIQUE_ID") != null and this.bundler.env.map.get("BUN_CLUSTER_IPC_PATH") != null) {
+                promise = JSModuleLoader.loadAndEvaluateModule(this.global, &String.static("node:cluster"));
+                this.waitForPromise(JSC.AnyPromise{
+                    .Internal = promise,
+                });
+                this.bundler.env.map.remove("NODE_UNIQUE_ID");
+                this.bundler.env.map.remove("BUN_CLUSTER_IPC_PATH");
+                if (promise.status(this.global.vm()) == .Rejected)
+                    return promise;
+            }
+
             {
                 this.is_in_preload = true;
                 defer this.is_in_preload = false;
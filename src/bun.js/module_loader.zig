@@ -876,6 +876,332 @@ pub const ModuleLoader = struct {
         ) void;
     };
 
+    /// Transpiles a module on the work pool instead of the JS thread.
+    ///
+    /// JSC's module loader fetches every static dependency of a module as soon
+    /// as it has parsed that module, without waiting for each fetch to settle.
+    /// Returning a pending promise here, instead of transpiling synchronously,
+    /// lets the whole import graph be read, parsed, linked and printed in
+    /// parallel while the JS thread only creates source providers.
+    ///
+    /// Anything that needs the JS thread (plugins, macros, the watcher,
+    /// auto-install) stays on the synchronous path; see `canRunConcurrently`.
+    pub const TranspileJob = struct {
+        vm: *VirtualMachine,
+        globalThis: *JSC.JSGlobalObject,
+        event_loop: *JSC.EventLoop,
+        promise: JSC.Strong = .{},
+        poll_ref: JSC.PollRef = .{},
+
+        path: Fs.Path,
+        specifier: string = "",
+        referrer: string = "",
+        string_buf: []u8 = &[_]u8{},
+        loader: options.Loader,
+        hash: u32,
+
+        /// A private copy so the worker never touches the VM's bundler,
+        /// which the JS thread keeps using for synchronous loads.
+        bundler: Bundler,
+        arena: bun.ArenaAllocator,
+        log: logger.Log,
+
+        result: Result = .{ .fallback = {} },
+        source_map: ?SourceMapResult = null,
+        resolved_count: u32 = 0,
+
+        work_task: JSC.WorkPoolTask = .{ .callback = &runFromWorkPool },
+        any_task: JSC.AnyTask = undefined,
+        concurrent_task: JSC.ConcurrentTask = .{},
+
+        pub const Result = union(enum) {
+            source: ResolvedSource,
+            err: anyerror,
+            /// The file needs something only the JS thread can do. Transpile
+            /// it synchronously once we're back there.
+            fallback: void,
+        };
+
+        const SourceMapResult = struct {
+            source: logger.Source,
+            mappings: MutableString,
+        };
+
+        pub fn canRunConcurrently(jsc_vm: *VirtualMachine, path: Fs.Path, loader: options.Loader) bool {
+            if (comptime !bun.FeatureFlags.concurrent_transpiler)
+                return false;
+
+            return switch (loader) {
+                .js, .jsx, .ts, .tsx => true,
+                else => false,
+            } and
+                std.fs.path.isAbsolute(path.text) and
+                !strings.hasPrefixComptime(path.text, "/bun-vfs/") and
+                !jsc_vm.isWatcherEnabled() and
+                !jsc_vm.macro_mode and
+                !jsc_vm.has_any_macro_remappings and
+                jsc_vm.plugin_runner == null and
+                jsc_vm.node_modules == null and
+                !jsc_vm.bundler.options.rewrite_jest_for_tests and
+                !jsc_vm.bundler.resolver.usePackageManager();
+        }
+
+        pub fn schedule(
+            jsc_vm: *VirtualMachine,
+            globalObject: *JSC.JSGlobalObject,
+            specifier: string,
+            referrer: string,
+            path: Fs.Path,
+            loader: options.Loader,
+        ) *JSC.JSInternalPromise {
+            var buf = bun.StringBuilder{};
+            buf.count(specifier);
+            buf.count(referrer);
+            buf.count(path.text);
+            buf.allocate(bun.default_allocator) catch @panic("out of memory");
+
+            var job = bun.default_allocator.create(TranspileJob) catch @panic("out of memory");
+            job.* = TranspileJob{
+                .vm = jsc_vm,
+                .globalThis = globalObject,
+                .event_loop = jsc_vm.eventLoop(),
+                .specifier = buf.append(specifier),
+                .referrer = buf.append(referrer),
+                .path = Fs.Path.init(buf.append(path.text)),
+                .string_buf = buf.allocatedSlice(),
+                .loader = loader,
+                .hash = http.Watcher.getHash(path.text),
+                .bundler = jsc_vm.bundler,
+                .arena = bun.ArenaAllocator.init(bun.default_allocator),
+                .log = logger.Log.init(bun.default_allocator),
+            };
+
+            const promise = JSValue.createInternalPromise(globalObject);
+            job.promise.set(globalObject, promise);
+            job.poll_ref.ref(jsc_vm);
+            jsc_vm.transpiled_count += 1;
+
+            JSC.WorkPool.schedule(&job.work_task);
+            return promise.asInternalPromise().?;
+        }
+
+        pub fn onSourceMapChunk(this: *TranspileJob, chunk: bun.sourcemap.Chunk, source: logger.Source) anyerror!void {
+            this.source_map = .{ .source = source, .mappings = chunk.buffer };
+        }
+
+        const SourceMapHandler = js_printer.SourceMapHandler.For(TranspileJob, onSourceMapChunk);
+
+        fn runFromWorkPool(task: *JSC.WorkPoolTask) void {
+            var this = @fieldParentPtr(TranspileJob, "work_task", task);
+            this.result = this.run() catch |err| .{ .err = err };
+
+            this.any_task = JSC.AnyTask.New(TranspileJob, runFromJS).init(this);
+            this.concurrent_task = .{ .task = JSC.Task.init(&this.any_task) };
+            this.event_loop.enqueueTaskConcurrent(&this.concurrent_task);
+        }
+
+        fn run(this: *TranspileJob) !Result {
+            const allocator = this.arena.allocator();
+
+            var ast_memory_allocator = js_ast.ASTMemoryAllocator{ .allocator = allocator };
+            ast_memory_allocator.reset();
+            ast_memory_allocator.push();
+            defer ast_memory_allocator.pop();
+
+            var bundler = &this.bundler;
+            bundler.setAllocator(allocator);
+            bundler.setLog(&this.log);
+            bundler.linker.resolver = &bundler.resolver;
+            bundler.macro_context = null;
+            bundler.resolver.caches = @import("../cache.zig").Set.init(allocator);
+
+            var input_file_fd: StoredFileDescriptorType = 0;
+            defer {
+                if (input_file_fd != 0) {
+                    _ = bun.JSC.Node.Syscall.close(input_file_fd);
+                }
+            }
+
+            var parse_result = bundler.parseMaybeReturnFileOnly(
+                Bundler.ParseOptions{
+                    .allocator = allocator,
+                    .path = this.path,
+                    .loader = this.loader,
+                    .dirname_fd = 0,
+                    .file_descriptor = null,
+                    .file_fd_ptr = &input_file_fd,
+                    .file_hash = this.hash,
+                    .macro_remappings = MacroRemap{},
+                    .jsx = bundler.options.jsx,
+                    .hoist_bun_plugin = true,
+                    .dont_bundle_twice = true,
+                    .allow_commonjs = true,
+                },
+                null,
+                false,
+            ) orelse return error.ParseError;
+
+            if (parse_result.loader == .wasm or parse_result.ast.bun_plugin.hoisted_stmts.items.len > 0)
+                return .{ .fallback = {} };
+
+            if (this.log.errors > 0)
+                return error.ParseError;
+
+            if (parse_result.already_bundled) {
+                return .{
+                    .source = ResolvedSource{
+                        .allocator = null,
+                        .source_code = bun.String.createLatin1(parse_result.source.contents),
+                        .specifier = String.init(this.specifier),
+                        .source_url = ZigString.init(this.path.text),
+                        .hash = 0,
+                    },
+                };
+            }
+
+            const start_count = bundler.linker.import_counter;
+            try bundler.linker.link(
+                this.path,
+                &parse_result,
+                this.vm.origin,
+                .absolute_path,
+                false,
+                true,
+            );
+
+            if (parse_result.pending_imports.len > 0)
+                return .{ .fallback = {} };
+
+            this.resolved_count = bundler.linker.import_counter - start_count;
+
+            var printer = js_printer.BufferPrinter.init(try js_printer.BufferWriter.init(allocator));
+            printer.ctx.append_null_byte = false;
+
+            const written = try bundler.printWithSourceMap(
+                parse_result,
+                @TypeOf(&printer),
+                &printer,
+                .esm_ascii,
+                SourceMapHandler.init(this),
+            );
+
+            if (written == 0)
+                return error.PrintingErrorWriteFailed;
+
+            var commonjs_exports = try bun.default_allocator.alloc(ZigString, parse_result.ast.commonjs_export_names.len);
+            for (parse_result.ast.commonjs_export_names, commonjs_exports) |name, *out| {
+                out.* = ZigString.fromUTF8(name);
+            }
+
+            // Pass along package.json type "module" if set.
+            const tag = brk: {
+                if (parse_result.ast.exports_kind == .cjs and parse_result.source.path.isFile()) {
+                    var dir_info = (bundler.resolver.readDirInfo(parse_result.source.path.name.dir) catch null) orelse
+                        break :brk ResolvedSource.Tag.javascript;
+                    const package_json = dir_info.package_json orelse dir_info.enclosing_package_json orelse
+                        break :brk ResolvedSource.Tag.javascript;
+
+                    if (package_json.module_type == .esm) {
+                        break :brk ResolvedSource.Tag.package_json_type_module;
+                    }
+                }
+
+                break :brk ResolvedSource.Tag.javascript;
+            };
+
+            return .{
+                .source = ResolvedSource{
+                    .allocator = null,
+                    .source_code = bun.String.createLatin1(printer.ctx.getWritten()),
+                    .specifier = String.init(this.specifier),
+                    .source_url = ZigString.init(this.path.text),
+                    .commonjs_exports = if (commonjs_exports.len > 0)
+                        commonjs_exports.ptr
+                    else
+                        null,
+                    .commonjs_exports_len = if (commonjs_exports.len > 0)
+                        @truncate(u32, commonjs_exports.len)
+                    else if (parse_result.ast.exports_kind == .cjs)
+                        std.math.maxInt(u32)
+                    else
+                        0,
+                    // having JSC own the memory causes crashes
+                    .hash = 0,
+                    .tag = tag,
+                },
+            };
+        }
+
+        fn runFromJS(this: *TranspileJob) void {
+            JSC.markBinding(@src());
+            var jsc_vm = this.vm;
+            this.poll_ref.unref(jsc_vm);
+
+            var spec = bun.String.init(ZigString.init(this.specifier).withEncoding());
+            var ref = bun.String.init(ZigString.init(this.referrer).withEncoding());
+            var errorable: ErrorableResolvedSource = undefined;
+
+            switch (this.result) {
+                .source => |source| {
+                    if (this.source_map) |source_map| {
+                        jsc_vm.source_mappings.putMappings(source_map.source, source_map.mappings) catch {};
+                        this.source_map = null;
+                    }
+                    if (!jsc_vm.macro_mode)
+                        jsc_vm.resolved_count += this.resolved_count;
+                    errorable = ErrorableResolvedSource.ok(source);
+                },
+                .err => |err| {
+                    VirtualMachine.processFetchLog(this.globalThis, spec, ref, &this.log, &errorable, err);
+                },
+                .fallback => {
+                    var log = logger.Log.init(jsc_vm.allocator);
+                    defer log.deinit();
+                    // transpileSourceCode counts the file again
+                    jsc_vm.transpiled_count -= 1;
+                    if (transpileSourceCode(
+                        jsc_vm,
+                        this.specifier,
+                        this.specifier,
+                        this.referrer,
+                        spec,
+                        this.path,
+                        this.loader,
+                        &log,
+                        null,
+                        &errorable,
+                        null,
+                        VirtualMachine.source_code_printer.?,
+                        this.globalThis,
+                        FetchFlags.transpile,
+                    )) |source| {
+                        errorable = ErrorableResolvedSource.ok(source);
+                    } else |err| {
+                        // A failing plugin has already filled in `errorable`.
+                        if (err != error.PluginError)
+                            VirtualMachine.processFetchLog(this.globalThis, spec, ref, &log, &errorable, err);
+                    }
+                },
+            }
+
+            const promise = this.promise.swap();
+            AsyncModule.Bun__onFulfillAsyncModule(promise, &errorable, &spec, &ref);
+            this.deinit();
+        }
+
+        pub fn deinit(this: *TranspileJob) void {
+            this.promise.deinit();
+            if (this.source_map) |source_map| {
+                var mappings = source_map.mappings;
+                mappings.deinit();
+            }
+            this.log.deinit();
+            this.arena.deinit();
+            bun.default_allocator.free(this.string_buf);
+            bun.default_allocator.destroy(this);
+        }
+    };
+
     pub export fn Bun__getDefaultLoader(global: *JSC.JSGlobalObject, str: *const bun.String) Api.Loader {
         var jsc_vm = global.bunVM();
         const filename = str.toUTF8(jsc_vm.allocator);
@@ -1612,6 +1938,11 @@ pub const ModuleLoader = struct {
         );
         const path = Fs.Path.init(specifier);
         const loader = jsc_vm.bundler.options.loaders.get(path.name.ext) orelse options.Loader.js;
+
+        if (allow_promise and TranspileJob.canRunConcurrently(jsc_vm, path, loader)) {
+            return TranspileJob.schedule(jsc_vm, globalObject, specifier, referrer_slice.slice(), path, loader);
+        }
+
         var promise: ?*JSC.JSInternalPromise = null;
         ret.* = ErrorableResolvedSource.ok(
             ModuleLoader.transpileSourceCode(
@@ -1866,6 +2197,7 @@ pub const ModuleLoader = struct {
                 .@"node:util" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"node:util", "node/util.js", specifier),
                 .@"node:vm" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"node:vm", "node/vm.js", specifier),
                 .@"node:wasi" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"node:wasi", "node/wasi.js", specifier),
+                .@"node:worker_threads" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"node:worker_threads", "node/worker_threads.js", specifier),
                 .@"node:zlib" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"node:zlib", "node/zlib.js", specifier),
 
                 .@"detect-libc" => return jsResolvedSource(jsc_vm, jsc_vm.load_builtins_from_path, .@"detect-libc", if (Environment.isLinux) "thirdparty/detect-libc.linux.js" else "thirdparty/detect-libc.js", specifier),
@@ -1893,20 +2225,6 @@ pub const ModuleLoader = struct {
                     .hash = 0,
                 };
             }
-        } else if (DisabledModule.getWithEql(specifier, bun.String.eqlComptime) != null) {
-            return ResolvedSource{
-                .allocator = null,
-                .source_code = bun.String.static(
-                    \\var masqueradesAsUndefined=globalThis[Symbol.for("Bun.lazy")]("masqueradesAsUndefined");
-                    \\masqueradesAsUndefined[Symbol.for("CommonJS")]=0;
-                    \\masqueradesAsUndefined.default=masqueradesAsUndefined;
-                    \\export default masqueradesAsUndefined;
-                    \\
-                ),
-                .specifier = specifier,
-                .source_url = specifier.toZigString(),
-                .hash = 0,
-            };
         } else if (jsc_vm.standalone_module_graph) |graph| {
             const specifier_utf8 = specifier.toUTF8(bun.default_allocator);
             defer specifier_utf8.deinit();
@@ -2052,6 +2370,7 @@ pub const HardcodedModule = enum {
     @"node:util/types",
     @"node:vm",
     @"node:wasi",
+    @"node:worker_threads",
     @"node:zlib",
     undici,
     ws,
@@ -2124,6 +2443,7 @@ pub const HardcodedModule = enum {
             .{ "node:v8", HardcodedModule.@"node:v8" },
             .{ "node:vm", HardcodedModule.@"node:vm" },
             .{ "node:wasi", HardcodedModule.@"node:wasi" },
+            .{ "node:worker_threads", HardcodedModule.@"node:worker_threads" },
             .{ "node:zlib", HardcodedModule.@"node:zlib" },
             .{ "undici", HardcodedModule.undici },
             .{ "ws", HardcodedModule.ws },
@@ -2273,15 +2593,6 @@ pub const HardcodedModule = enum {
     );
 };
 
-pub const DisabledModule = bun.ComptimeStringMap(
-    void,
-    .{
-        // Stubbing out worker_threads will break esbuild.
-        .{"worker_threads"},
-        .{"node:worker_threads"},
-    },
-);
-
 fn jsResolvedSource(vm: *JSC.VirtualMachine, builtins: []const u8, comptime module: HardcodedModule, comptime input: []const u8, specifier: bun.String) ResolvedSource {
     // We use RefCountedResolvedSource because we want a stable StringImpl*
     // pointer so that the SourceProviderCache has the maximum hit rate
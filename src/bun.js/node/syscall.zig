@@ -110,6 +110,16 @@ pub const Tag = enum(u8) {
     pwritev,
     readv,
     preadv,
+    socket,
+    bind,
+    connect,
+    setsockopt,
+    getsockopt,
+    getsockname,
+    sendto,
+    recvfrom,
+    sendmmsg,
+    recvmmsg,
     pub var strings = std.EnumMap(Tag, JSC.C.JSStringRef).initFull(null);
 };
 const PathString = @import("root").bun.PathString;
@@ -575,6 +585,157 @@ pub fn send(fd: os.fd_t, buf: []const u8, flag: u32) Maybe(usize) {
     unreachable;
 }
 
+pub fn socket(domain: u32, socket_type: u32, protocol: u32) Maybe(fd_t) {
+    if (comptime Environment.isMac) {
+        const rc = std.c.socket(domain, socket_type, protocol);
+        log("socket({d}, {d}, {d}) = {d}", .{ domain, socket_type, protocol, rc });
+        if (Maybe(fd_t).errnoSys(rc, .socket)) |err| {
+            return err;
+        }
+
+        // Darwin has no SOCK_NONBLOCK or SOCK_CLOEXEC
+        _ = std.c.fcntl(rc, os.F.SETFD, @as(c_int, os.FD_CLOEXEC));
+        _ = std.c.fcntl(rc, os.F.SETFL, @as(c_int, os.O.NONBLOCK));
+        return Maybe(fd_t){ .result = rc };
+    } else {
+        const rc = linux.socket(domain, socket_type | os.SOCK.NONBLOCK | os.SOCK.CLOEXEC, protocol);
+        log("socket({d}, {d}, {d}) = {d}", .{ domain, socket_type, protocol, rc });
+        if (Maybe(fd_t).errnoSys(rc, .socket)) |err| {
+            return err;
+        }
+
+        return Maybe(fd_t){ .result = @intCast(fd_t, rc) };
+    }
+}
+
+pub fn bind(fd: fd_t, addr: *const os.sockaddr, len: os.socklen_t) Maybe(void) {
+    const rc = system.bind(fd, addr, len);
+    log("bind({d}) = {d}", .{ fd, rc });
+    return Maybe(void).errnoSysFd(rc, .bind, fd) orelse Maybe(void).success;
+}
+
+/// Datagram sockets only: there is no EINPROGRESS to wait on.
+pub fn connect(fd: fd_t, addr: *const os.sockaddr, len: os.socklen_t) Maybe(void) {
+    while (true) {
+        const rc = system.connect(fd, addr, len);
+        log("connect({d}) = {d}", .{ fd, rc });
+        if (Maybe(void).errnoSysFd(rc, .connect, fd)) |err| {
+            if (err.getErrno() == .INTR) continue;
+            return err;
+        }
+        return Maybe(void).success;
+    }
+}
+
+pub fn setsockopt(fd: fd_t, level: anytype, optname: anytype, value: []const u8) Maybe(void) {
+    const rc = system.setsockopt(fd, level, optname, value.ptr, @intCast(os.socklen_t, value.len));
+    log("setsockopt({d}, {d}, {d}) = {d}", .{ fd, level, optname, rc });
+    return Maybe(void).errnoSysFd(rc, .setsockopt, fd) orelse Maybe(void).success;
+}
+
+pub fn getsockopt(fd: fd_t, level: anytype, optname: anytype, buf: []u8) Maybe(usize) {
+    var len = @intCast(os.socklen_t, buf.len);
+    const rc = system.getsockopt(fd, level, optname, buf.ptr, &len);
+    log("getsockopt({d}, {d}, {d}) = {d}", .{ fd, level, optname, rc });
+    if (Maybe(usize).errnoSysFd(rc, .getsockopt, fd)) |err| {
+        return err;
+    }
+    return Maybe(usize){ .result = len };
+}
+
+pub fn getsockname(fd: fd_t, addr: *os.sockaddr, len: *os.socklen_t) Maybe(void) {
+    const rc = system.getsockname(fd, addr, len);
+    return Maybe(void).errnoSysFd(rc, .getsockname, fd) orelse Maybe(void).success;
+}
+
+pub fn sendto(fd: fd_t, buf: []const u8, flag: u32, addr: ?*const os.sockaddr, len: os.socklen_t) Maybe(usize) {
+    if (comptime Environment.isMac) {
+        const rc = system.@"sendto$NOCANCEL"(fd, buf.ptr, buf.len, flag, addr, len);
+        if (Maybe(usize).errnoSys(rc, .sendto)) |err| {
+            return err;
+        }
+        return Maybe(usize){ .result = @intCast(usize, rc) };
+    } else {
+        while (true) {
+            const rc = linux.sendto(fd, buf.ptr, buf.len, flag | os.MSG.NOSIGNAL, addr, len);
+
+            if (Maybe(usize).errnoSys(rc, .sendto)) |err| {
+                if (err.getErrno() == .INTR) continue;
+                return err;
+            }
+
+            return Maybe(usize){ .result = @intCast(usize, rc) };
+        }
+    }
+    unreachable;
+}
+
+pub fn recvfrom(fd: fd_t, buf: []u8, flag: u32, addr: ?*os.sockaddr, len: ?*os.socklen_t) Maybe(usize) {
+    if (comptime Environment.isMac) {
+        const rc = system.@"recvfrom$NOCANCEL"(fd, buf.ptr, buf.len, flag, addr, len);
+        if (Maybe(usize).errnoSys(rc, .recvfrom)) |err| {
+            return err;
+        }
+        return Maybe(usize){ .result = @intCast(usize, rc) };
+    } else {
+        while (true) {
+            const rc = linux.recvfrom(fd, buf.ptr, buf.len, flag, addr, len);
+
+            if (Maybe(usize).errnoSysFd(rc, .recvfrom, fd)) |err| {
+                if (err.getErrno() == .INTR) continue;
+                return err;
+            }
+            return Maybe(usize){ .result = @intCast(usize, rc) };
+        }
+    }
+    unreachable;
+}
+
+/// `struct mmsghdr` as the kernel lays it out on 64-bit targets. We don't use
+/// the one in std.os.linux because its field types differ per architecture.
+pub const MMsgHdr = extern struct {
+    hdr: extern struct {
+        name: ?*os.sockaddr = null,
+        namelen: os.socklen_t = 0,
+        iov: [*]os.iovec,
+        iovlen: usize = 1,
+        control: ?*anyopaque = null,
+        controllen: usize = 0,
+        flags: i32 = 0,
+    },
+    len: u32 = 0,
+};
+
+/// Returns how many messages were sent. On an error after the first message,
+/// the kernel reports the partial count and the error is returned by the next call.
+pub fn sendmmsg(fd: fd_t, msgs: []MMsgHdr, flag: u32) Maybe(usize) {
+    if (comptime !Environment.isLinux) @compileError("Linux-only");
+    while (true) {
+        const rc = linux.syscall4(.sendmmsg, @bitCast(usize, @as(isize, fd)), @intFromPtr(msgs.ptr), msgs.len, flag | os.MSG.NOSIGNAL);
+        log("sendmmsg({d}, {d}) = {d}", .{ fd, msgs.len, rc });
+
+        if (Maybe(usize).errnoSysFd(rc, .sendmmsg, fd)) |err| {
+            if (err.getErrno() == .INTR) continue;
+            return err;
+        }
+        return Maybe(usize){ .result = rc };
+    }
+}
+
+pub fn recvmmsg(fd: fd_t, msgs: []MMsgHdr, flag: u32) Maybe(usize) {
+    if (comptime !Environment.isLinux) @compileError("Linux-only");
+    while (true) {
+        const rc = linux.syscall5(.recvmmsg, @bitCast(usize, @as(isize, fd)), @intFromPtr(msgs.ptr), msgs.len, flag, 0);
+        log("recvmmsg({d}, {d}) = {d}", .{ fd, msgs.len, rc });
+
+        if (Maybe(usize).errnoSysFd(rc, .recvmmsg, fd)) |err| {
+            if (err.getErrno() == .INTR) continue;
+            return err;
+        }
+        return Maybe(usize){ .result = rc };
+    }
+}
+
 pub fn readlink(in: [:0]const u8, buf: []u8) Maybe(usize) {
     while (true) {
         const rc = sys.readlink(in, buf.ptr, buf.len);
@@ -143,6 +143,13 @@ pub fn Maybe(comptime ResultType: type) type {
             };
         }
 
+        pub inline fn asErr(this: @This()) ?Syscall.Error {
+            return switch (this) {
+                .result => null,
+                .err => |err| err,
+            };
+        }
+
         pub inline fn errno(rc: anytype) ?@This() {
             return switch (Syscall.getErrno(rc)) {
                 .SUCCESS => null,
@@ -2203,7 +2210,15 @@ pub const Process = struct {
     }
 
     pub fn exit(globalObject: *JSC.JSGlobalObject, code: i32) callconv(.C) void {
-        globalObject.bunVM().onExit();
+        var vm = globalObject.bunVM();
+        if (vm.worker) |worker| {
+            // Only the worker's thread stops; unwind whatever called exit().
+            worker.requestExit(code);
+            globalObject.throwTerminationException();
+            return;
+        }
+
+        vm.onExit();
 
         std.os.exit(@truncate(u8, @intCast(u32, @max(code, 0))));
     }
@@ -28,6 +28,8 @@ file_polls_: ?*JSC.FilePoll.HiveArray = null,
 
 global_dns_data: ?*JSC.DNS.GlobalData = null,
 
+udp_receive_buffer: ?*JSC.API.UDPSocket.ReceiveBuffer = null,
+
 mime_types: ?bun.HTTP.MimeType.Map = null,
 
 pub fn mimeTypeFromString(this: *RareData, allocator: std.mem.Allocator, str: []const u8) ?bun.HTTP.MimeType {
@@ -48,6 +50,13 @@ pub fn filePolls(this: *RareData, vm: *JSC.VirtualMachine) *JSC.FilePoll.HiveArr
     };
 }
 
+pub fn udpReceiveBuffer(this: *RareData) *JSC.API.UDPSocket.ReceiveBuffer {
+    return this.udp_receive_buffer orelse {
+        this.udp_receive_buffer = default_allocator.create(JSC.API.UDPSocket.ReceiveBuffer) catch unreachable;
+        return this.udp_receive_buffer.?;
+    };
+}
+
 pub fn nextUUID(this: *RareData) UUID {
     if (this.entropy_cache == null) {
         this.entropy_cache = default_allocator.create(EntropyCache) catch unreachable;
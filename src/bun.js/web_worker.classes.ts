@@ -0,0 +1,36 @@
+import { define } from "./scripts/class-definitions";
+
+export default [
+  define({
+    name: "Worker",
+    construct: false,
+    noConstructor: true,
+    finalize: true,
+    configurable: false,
+    hasPendingActivity: true,
+    klass: {},
+    JSType: "0b11101110",
+    proto: {
+      threadId: {
+        getter: "getThreadId",
+      },
+      port: {
+        getter: "getPort",
+        cache: true,
+      },
+      terminate: {
+        fn: "terminate",
+        length: 0,
+      },
+      ref: {
+        fn: "doRef",
+        length: 0,
+      },
+      unref: {
+        fn: "doUnref",
+        length: 0,
+      },
+    },
+    values: ["listener"],
+  }),
+];
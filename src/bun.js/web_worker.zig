@@ -0,0 +1,488 @@
+const std = @import("std");
+const bun = @import("root").bun;
+const Output = bun.Output;
+const JSC = bun.JSC;
+const JSValue = JSC.JSValue;
+const JSGlobalObject = JSC.JSGlobalObject;
+const ZigString = JSC.ZigString;
+const VirtualMachine = JSC.VirtualMachine;
+const SerializedScriptValue = JSC.SerializedScriptValue;
+const MessageChannel = JSC.WebCore.MessageChannel;
+const MessagePort = JSC.WebCore.MessagePort;
+const Arena = @import("../mimalloc_arena.zig").Arena;
+const DotEnv = bun.DotEnv;
+const js_ast = bun.JSAst;
+const Lock = bun.Lock;
+
+const log = Output.scoped(.Worker, false);
+
+var next_thread_id = std.atomic.Atomic(u32).init(1);
+
+/// A node:worker_threads Worker. Each one runs its own VirtualMachine, with
+/// its own JSC VM and event loop, on a dedicated thread.
+///
+/// The parent keeps this struct and the JavaScript wrapper; the worker thread
+/// only touches the fields marked as shared, and hands control back to the
+/// parent by posting the exit task as the very last thing it does.
+pub const WebWorker = struct {
+    // Parent thread
+    parent: *VirtualMachine,
+    globalThis: *JSGlobalObject,
+    this_value: JSValue = .zero,
+    poll_ref: JSC.PollRef = .{},
+    has_ref: bool = true,
+    has_pending_activity: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(true),
+    parent_port_claimed: bool = false,
+
+    // Shared
+    id: u32,
+    specifier: []const u8,
+    worker_data: ?*SerializedScriptValue = null,
+
+    /// The worker's copy of the parent's environment. The strings are shared;
+    /// only the table is copied, so the two threads never touch the same one.
+    env_map: DotEnv.Map = undefined,
+    env_loader: DotEnv.Loader = undefined,
+
+    /// Side 0 is the parent's `worker.port`, side 1 the worker's `parentPort`.
+    channel: *MessageChannel,
+
+    requested_terminate: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
+    online_task: JSC.AnyTask = undefined,
+    online_concurrent_task: JSC.ConcurrentTask = .{},
+    exit_task: JSC.AnyTask = undefined,
+    exit_concurrent_task: JSC.ConcurrentTask = .{},
+
+    /// Guards `vm`, which terminate() reads from the parent thread.
+    vm_lock: Lock = Lock.init(),
+    vm: ?*VirtualMachine = null,
+
+    // Worker thread; read by the parent once the exit task runs
+    arena: Arena = undefined,
+    exit_code: i32 = 0,
+    exit_called: bool = false,
+    child_port_claimed: bool = false,
+    uncaught_error: ?*SerializedScriptValue = null,
+
+    /// Set on workers started by Bun.serve({ workers }): the port the main
+    /// thread listened on, which the worker's own server listens on too.
+    serve_port: u16 = 0,
+    /// Worker thread. The server listening on `serve_port`, stopped when
+    /// the worker stops so the kernel no longer hands it connections.
+    serve_server: ?JSC.API.AnyServer = null,
+    /// Parent thread. The list of the server that started this worker.
+    serve_workers: ?*std.ArrayListUnmanaged(*WebWorker) = null,
+
+    pub usingnamespace JSC.Codegen.JSWorker;
+
+    /// createWorker(specifier, workerData, transferList, listener)
+    ///
+    /// `listener(event, value)` is called on the parent thread with
+    /// "online", "error" and "exit".
+    pub fn create(globalThis: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const args = callframe.arguments(4);
+        if (args.len < 4 or !args.ptr[0].isString() or !args.ptr[3].isCallable(globalThis.vm())) {
+            globalThis.throwInvalidArguments("createWorker expects a specifier and a listener", .{});
+            return .zero;
+        }
+
+        var transfer = std.ArrayList(JSValue).init(bun.default_allocator);
+        defer transfer.deinit();
+        if (!args.ptr[2].isUndefinedOrNull()) {
+            var iter = args.ptr[2].arrayIterator(globalThis);
+            while (iter.next()) |item| transfer.append(item) catch unreachable;
+        }
+
+        const worker_data = SerializedScriptValue.create(globalThis, args.ptr[1], transfer.items, &.{}) orelse return .zero;
+        const specifier = args.ptr[0].toSliceCloneWithAllocator(globalThis, bun.default_allocator) orelse {
+            worker_data.deref();
+            return .zero;
+        };
+
+        var this = start(globalThis, specifier.slice(), worker_data, 0) orelse {
+            globalThis.throw("Failed to start worker thread", .{});
+            return .zero;
+        };
+
+        const this_value = this.toJS(globalThis);
+        this.this_value = this_value;
+        WebWorker.listenerSetCached(this_value, globalThis, args.ptr[3]);
+        return this_value;
+    }
+
+    /// Starts a worker for Bun.serve({ workers }) that runs `specifier` and
+    /// listens on `serve_port`. There is no JavaScript wrapper: the worker
+    /// removes itself from `workers` and frees itself once it exits.
+    pub fn spawn(globalThis: *JSGlobalObject, specifier: []const u8, serve_port: u16, workers: *std.ArrayListUnmanaged(*WebWorker)) ?*WebWorker {
+        var this = start(globalThis, bun.default_allocator.dupe(u8, specifier) catch unreachable, null, serve_port) orelse return null;
+        this.serve_workers = workers;
+        return this;
+    }
+
+    /// Takes ownership of `specifier` and `worker_data`; on failure they
+    /// are released along with the worker.
+    fn start(globalThis: *JSGlobalObject, specifier: []const u8, worker_data: ?*SerializedScriptValue, serve_port: u16) ?*WebWorker {
+        const parent = globalThis.bunVM();
+        var this = bun.default_allocator.create(WebWorker) catch unreachable;
+        this.* = .{
+            .parent = parent,
+            .globalThis = globalThis,
+            .id = next_thread_id.fetchAdd(1, .Monotonic),
+            .specifier = specifier,
+            .worker_data = worker_data,
+            .channel = MessageChannel.create(),
+            .serve_port = serve_port,
+        };
+        this.env_map = .{ .map = parent.bundler.env.map.map.clone() catch unreachable };
+        this.env_loader = parent.bundler.env.*;
+        this.env_loader.map = &this.env_map;
+        this.online_task = JSC.AnyTask.New(WebWorker, onOnline).init(this);
+        this.exit_task = JSC.AnyTask.New(WebWorker, onExit).init(this);
+
+        var thread = std.Thread.spawn(.{ .stack_size = 4 * 1024 * 1024 }, threadMain, .{this}) catch {
+            this.has_pending_activity.store(false, .Release);
+            this.deinit();
+            return null;
+        };
+        thread.detach();
+
+        log("create({d}, {s})", .{ this.id, this.specifier });
+        this.poll_ref.ref(parent);
+        return this;
+    }
+
+    pub fn hasPendingActivity(this: *WebWorker) callconv(.C) bool {
+        @fence(.Acquire);
+        return this.has_pending_activity.load(.Acquire);
+    }
+
+    pub fn getThreadId(this: *WebWorker, _: *JSGlobalObject) callconv(.C) JSValue {
+        return JSValue.jsNumber(this.id);
+    }
+
+    /// The parent's end of the channel. Cached on the wrapper after the
+    /// first call.
+    pub fn getPort(this: *WebWorker, globalThis: *JSGlobalObject) callconv(.C) JSValue {
+        if (this.parent_port_claimed) return JSValue.jsUndefined();
+        this.parent_port_claimed = true;
+        return MessagePort.create(globalThis, this.channel, 0);
+    }
+
+    pub fn doRef(this: *WebWorker, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (!this.has_ref and this.hasPendingActivity()) {
+            this.has_ref = true;
+            this.poll_ref.ref(this.parent);
+        }
+        return JSValue.jsUndefined();
+    }
+
+    pub fn doUnref(this: *WebWorker, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (this.has_ref) {
+            this.has_ref = false;
+            this.poll_ref.unref(this.parent);
+        }
+        return JSValue.jsUndefined();
+    }
+
+    pub fn terminate(this: *WebWorker, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        this.requestTerminate();
+        return JSValue.jsUndefined();
+    }
+
+    /// Safe to call from any thread. Whatever JavaScript the worker is
+    /// running is interrupted at its next trap check.
+    pub fn requestTerminate(this: *WebWorker) void {
+        if (this.requested_terminate.swap(true, .AcqRel)) return;
+        log("terminate({d})", .{this.id});
+
+        this.vm_lock.lock();
+        defer this.vm_lock.unlock();
+        if (this.vm) |vm| {
+            vm.global.vm().notifyNeedTermination();
+            vm.uws_event_loop.?.wakeup();
+        }
+    }
+
+    /// process.exit() inside the worker. Only stops this thread.
+    pub fn requestExit(this: *WebWorker, code: i32) void {
+        if (!this.exit_called) {
+            this.exit_called = true;
+            this.exit_code = code;
+        }
+        this.requestTerminate();
+    }
+
+    fn deinit(this: *WebWorker) void {
+        if (this.worker_data) |worker_data| worker_data.deref();
+        if (this.uncaught_error) |err| err.deref();
+        if (!this.parent_port_claimed) {
+            this.channel.close(0);
+            this.channel.deref();
+        }
+        if (!this.child_port_claimed) this.channel.deref();
+        this.env_map.map.deinit();
+        bun.default_allocator.free(this.specifier);
+        bun.default_allocator.destroy(this);
+    }
+
+    pub fn finalize(this: *WebWorker) callconv(.C) void {
+        log("finalize({d})", .{this.id});
+        this.deinit();
+    }
+
+    fn emit(this: *WebWorker, comptime event: []const u8, value: JSValue) void {
+        const globalThis = this.globalThis;
+        const this_value = this.this_value;
+        // Bun.serve's workers have no wrapper to listen on; their errors go
+        // to the parent's handler instead.
+        if (this_value == .zero) {
+            if (comptime std.mem.eql(u8, event, "error")) this.parent.onUnhandledError(globalThis, value);
+            return;
+        }
+        this_value.ensureStillAlive();
+        const listener = WebWorker.listenerGetCached(this_value) orelse return;
+
+        const result = listener.call(globalThis, &[_]JSValue{ ZigString.static(event).toValue(globalThis), value });
+        if (result.isAnyError()) {
+            this.parent.onUnhandledError(globalThis, result);
+        }
+    }
+
+    fn onOnline(this: *WebWorker) void {
+        this.emit("online", JSValue.jsUndefined());
+    }
+
+    fn onExit(this: *WebWorker) void {
+        log("exit({d}, {d})", .{ this.id, this.exit_code });
+        const globalThis = this.globalThis;
+        this.poll_ref.unref(this.parent);
+
+        if (this.uncaught_error) |err| {
+            this.uncaught_error = null;
+            defer err.deref();
+            switch (err.deserialize(globalThis, &.{})) {
+                .result, .err => |value| this.emit("error", value),
+            }
+        }
+
+        this.emit("exit", JSValue.jsNumber(this.exit_code));
+        this.has_pending_activity.store(false, .Release);
+
+        // Nothing will finalize a worker without a wrapper.
+        if (this.this_value == .zero) {
+            if (this.serve_workers) |workers| {
+                if (std.mem.indexOfScalar(*WebWorker, workers.items, this)) |i| _ = workers.swapRemove(i);
+            }
+            this.deinit();
+        }
+    }
+
+    // --- Worker thread ---
+
+    fn threadMain(this: *WebWorker) void {
+        Output.Source.configureNamedThread("Worker");
+        JSC.markBinding(@src());
+
+        // Teardown runs in reverse: the VM, then the arena it was allocated
+        // from, then the AST stores, and finish() last. Once the exit task is
+        // posted, the parent may free `this`.
+        defer this.finish();
+        js_ast.Expr.Data.Store.create(bun.default_allocator);
+        js_ast.Stmt.Data.Store.create(bun.default_allocator);
+        defer {
+            js_ast.Expr.Data.Store.deinit();
+            js_ast.Stmt.Data.Store.deinit();
+        }
+        this.arena = Arena.init() catch unreachable;
+        defer this.arena.deinit();
+        const allocator = this.arena.allocator();
+
+        var vm = VirtualMachine.init(
+            allocator,
+            this.parent.bundler.options.transform_options,
+            null,
+            null,
+            &this.env_loader,
+            false,
+        ) catch {
+            this.exit_code = 1;
+            return;
+        };
+        defer vm.deinit();
+        vm.arena = &this.arena;
+        vm.allocator = allocator;
+        vm.argv = this.parent.argv;
+        vm.worker = this;
+        vm.onUnhandledRejection = onUnhandledRejection;
+
+        var b = &vm.bundler;
+        b.configureRouter(false) catch {};
+        b.configureDefines() catch {};
+        vm.loadExtraEnv();
+        vm.eventLoop().ensureWaker();
+
+        this.vm_lock.lock();
+        this.vm = vm;
+        this.vm_lock.unlock();
+
+        // terminate() may have been called before the VM existed.
+        if (!this.requested_terminate.load(.Acquire)) {
+            vm.global.vm().holdAPILock(this, JSC.OpaqueWrap(WebWorker, spin));
+        } else {
+            this.exit_code = 1;
+        }
+
+        this.vm_lock.lock();
+        this.vm = null;
+        this.vm_lock.unlock();
+    }
+
+    fn spin(this: *WebWorker) void {
+        var vm = this.vm.?;
+        defer this.stopServeServer();
+        this.parent.eventLoop().enqueueTaskConcurrent(this.online_concurrent_task.from(&this.online_task));
+
+        if (vm.loadEntryPoint(this.specifier)) |promise| {
+            if (promise.status(vm.global.vm()) == .Rejected) {
+                vm.onUnhandledError(vm.global, promise.result(vm.global.vm()));
+                return;
+            }
+        } else |err| {
+            const message = if (vm.log.msgs.items.len > 0) vm.log.msgs.items[0].data.text else @errorName(err);
+            vm.onUnhandledError(vm.global, vm.global.createErrorInstance("Failed to load worker {s}: {s}", .{ this.specifier, message }));
+            return;
+        }
+
+        while (!this.requested_terminate.load(.Acquire) and
+            (vm.eventLoop().tasks.count > 0 or vm.active_tasks > 0 or vm.uws_event_loop.?.active > 0))
+        {
+            vm.tick();
+            if (this.requested_terminate.load(.Acquire)) break;
+            vm.eventLoop().autoTickActive();
+        }
+
+        if (this.requested_terminate.load(.Acquire)) return;
+
+        vm.onBeforeExit();
+        if (!this.requested_terminate.load(.Acquire)) {
+            this.exit_code = vm.exit_handler.exit_code;
+            vm.exit_handler.dispatchOnExit();
+        }
+    }
+
+    fn stopServeServer(this: *WebWorker) void {
+        const server = this.serve_server orelse return;
+        this.serve_server = null;
+        switch (server) {
+            inline else => |s| s.stopListening(true),
+        }
+    }
+
+    /// Replaces the default handler, which would print the error and keep
+    /// going. Like Node, an uncaught error stops the worker and is reported
+    /// to the parent as an 'error' event.
+    fn onUnhandledRejection(vm: *VirtualMachine, globalThis: *JSGlobalObject, value: JSValue) void {
+        var this = vm.worker.?;
+        // Termination surfaces as an uncatchable exception; it isn't an error.
+        if (this.requested_terminate.load(.Acquire)) return;
+
+        if (this.uncaught_error == null) {
+            // Errors and primitives always clone; anything else is reported
+            // by its string form so that reporting can't itself throw.
+            var cloneable = value;
+            if (!(value.isAnyError() or (value.isPrimitive() and !value.isSymbol()))) {
+                cloneable = if (value.toStringOrNull(globalThis)) |str|
+                    str.getZigString(globalThis).toValueGC(globalThis)
+                else
+                    JSValue.jsUndefined();
+            }
+            this.uncaught_error = SerializedScriptValue.create(globalThis, cloneable, &.{}, &.{});
+        }
+
+        if (!this.exit_called) this.exit_code = 1;
+        this.requestTerminate();
+    }
+
+    /// Creates `parentPort` on the worker's side of the channel.
+    pub fn claimParentPort(this: *WebWorker, globalThis: *JSGlobalObject) JSValue {
+        if (this.child_port_claimed) return JSValue.jsNull();
+        this.child_port_claimed = true;
+        return MessagePort.create(globalThis, this.channel, 1);
+    }
+
+    pub fn takeWorkerData(this: *WebWorker, globalThis: *JSGlobalObject) JSValue {
+        const worker_data = this.worker_data orelse return JSValue.jsNull();
+        this.worker_data = null;
+        defer worker_data.deref();
+        return switch (worker_data.deserialize(globalThis, &.{})) {
+            .result => |value| value,
+            .err => |err| {
+                globalThis.throwValue(err);
+                return .zero;
+            },
+        };
+    }
+
+    fn finish(this: *WebWorker) void {
+        if (this.requested_terminate.load(.Acquire) and !this.exit_called and this.uncaught_error == null) {
+            this.exit_code = 1;
+        }
+
+        // The worker's end of the channel goes away with the thread. Closing
+        // it also lets the parent's port know.
+        this.channel.close(1);
+        if (this.child_port_claimed) this.channel.detach(1);
+
+        log("finish({d}, {d})", .{ this.id, this.exit_code });
+        this.parent.eventLoop().enqueueTaskConcurrent(this.exit_concurrent_task.from(&this.exit_task));
+    }
+};
+
+/// The native half of node:worker_threads, loaded through Bun.lazy.
+pub export fn Bun__WorkerThreads__createBinding(globalThis: *JSGlobalObject) JSValue {
+    JSC.markBinding(@src());
+    const worker = globalThis.bunVM().worker;
+    const binding = JSValue.createEmptyObject(globalThis, 8);
+
+    binding.put(globalThis, ZigString.static("isMainThread"), JSValue.jsBoolean(worker == null));
+    binding.put(globalThis, ZigString.static("threadId"), JSValue.jsNumber(if (worker) |w| w.id else 0));
+    if (worker) |w| {
+        const worker_data = w.takeWorkerData(globalThis);
+        if (worker_data == .zero) return .zero;
+        binding.put(globalThis, ZigString.static("workerData"), worker_data);
+        binding.put(globalThis, ZigString.static("parentPort"), w.claimParentPort(globalThis));
+    } else {
+        binding.put(globalThis, ZigString.static("workerData"), JSValue.jsNull());
+        binding.put(globalThis, ZigString.static("parentPort"), JSValue.jsNull());
+    }
+
+    binding.put(globalThis, ZigString.static("MessagePort"), MessagePort.getConstructor(globalThis));
+    binding.put(globalThis, ZigString.static("createWorker"), JSC.NewFunction(globalThis, ZigString.static("createWorker"), 4, WebWorker.create, false));
+    binding.put(globalThis, ZigString.static("createChannel"), JSC.NewFunction(globalThis, ZigString.static("createChannel"), 0, createChannel, false));
+    binding.put(globalThis, ZigString.static("receiveMessageOnPort"), JSC.NewFunction(globalThis, ZigString.static("receiveMessageOnPort"), 1, receiveMessageOnPort, false));
+    return binding;
+}
+
+fn createChannel(globalThis: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+    const channel = MessageChannel.create();
+    const ports = JSValue.createEmptyArray(globalThis, 2);
+    ports.putIndex(globalThis, 0, MessagePort.create(globalThis, channel, 0));
+    ports.putIndex(globalThis, 1, MessagePort.create(globalThis, channel, 1));
+    return ports;
+}
+
+fn receiveMessageOnPort(globalThis: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+    const args = callframe.arguments(1);
+    const port = if (args.len > 0) MessagePort.fromJS(args.ptr[0]) else null;
+    if (port == null) {
+        globalThis.throwInvalidArguments("The \"port\" argument must be a MessagePort instance", .{});
+        return .zero;
+    }
+    return port.?.receiveMessage();
+}
+
+comptime {
+    if (!JSC.is_bindgen) {
+        _ = Bun__WorkerThreads__createBinding;
+    }
+}
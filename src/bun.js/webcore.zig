@@ -4,6 +4,7 @@ pub usingnamespace @import("./webcore/streams.zig");
 pub usingnamespace @import("./webcore/blob.zig");
 pub usingnamespace @import("./webcore/request.zig");
 pub usingnamespace @import("./webcore/body.zig");
+pub usingnamespace @import("./webcore/message_port.zig");
 
 const JSC = @import("root").bun.JSC;
 const std = @import("std");
@@ -0,0 +1,39 @@
+import { define } from "../scripts/class-definitions";
+
+export default [
+  define({
+    name: "MessagePort",
+    construct: true,
+    finalize: true,
+    configurable: false,
+    hasPendingActivity: true,
+    klass: {},
+    JSType: "0b11101110",
+    proto: {
+      postMessage: {
+        fn: "postMessage",
+        length: 1,
+      },
+      start: {
+        fn: "start",
+        length: 0,
+      },
+      close: {
+        fn: "close",
+        length: 0,
+      },
+      ref: {
+        fn: "doRef",
+        length: 0,
+      },
+      unref: {
+        fn: "doUnref",
+        length: 0,
+      },
+      hasRef: {
+        fn: "hasRef",
+        length: 0,
+      },
+    },
+  }),
+];
@@ -0,0 +1,478 @@
+const std = @import("std");
+const bun = @import("root").bun;
+const Output = bun.Output;
+const JSC = bun.JSC;
+const JSValue = JSC.JSValue;
+const JSGlobalObject = JSC.JSGlobalObject;
+const ZigString = JSC.ZigString;
+const SerializedScriptValue = JSC.SerializedScriptValue;
+const Lock = bun.Lock;
+
+const log = Output.scoped(.MessagePort, false);
+
+/// A message on its way to the other end of a channel. Ports named in the
+/// transfer list travel as channel ends and are turned back into MessagePort
+/// objects on the receiving thread.
+pub const Message = struct {
+    value: *SerializedScriptValue,
+    ports: []Transferred = &.{},
+
+    pub const Transferred = struct {
+        channel: *MessageChannel,
+        side: u1,
+    };
+
+    /// Drops a message that will never be delivered. The ports it carried
+    /// can no longer be claimed by anyone, so they are closed.
+    pub fn deinit(this: *Message) void {
+        this.value.deref();
+        for (this.ports) |port| {
+            port.channel.close(port.side);
+            port.channel.deref();
+        }
+        bun.default_allocator.free(this.ports);
+    }
+};
+
+/// The shared state between two entangled ports. Each end may live on a
+/// different thread, so everything here is guarded by `lock`; the JavaScript
+/// objects are only ever touched from the thread that owns them.
+///
+/// One reference is held by each end's owner (a MessagePort, or a Message
+/// carrying a transferred port) and one by every scheduled wakeup.
+pub const MessageChannel = struct {
+    lock: Lock = Lock.init(),
+    ref_count: std.atomic.Atomic(u32) = std.atomic.Atomic(u32).init(2),
+    ends: [2]End = undefined,
+    closed: bool = false,
+
+    pub const End = struct {
+        channel: *MessageChannel,
+        side: u1,
+
+        /// Messages sent to this end that have not been dispatched yet.
+        inbox: std.ArrayListUnmanaged(Message) = .{},
+
+        /// Null while this end is in transit inside a Message.
+        port: ?*MessagePort = null,
+        event_loop: ?*JSC.EventLoop = null,
+
+        /// Messages queue up until the receiving port is started.
+        started: bool = false,
+        wakeup_scheduled: bool = false,
+        close_pending: bool = false,
+    };
+
+    /// Posted to the owning thread's event loop when an end has something to
+    /// dispatch. A wakeup that finds its end moved to another thread in the
+    /// meantime does nothing.
+    const Wakeup = struct {
+        end: *End,
+        event_loop: *JSC.EventLoop,
+        task: JSC.AnyTask = undefined,
+        concurrent_task: JSC.ConcurrentTask = .{},
+
+        fn run(this: *Wakeup) void {
+            const end = this.end;
+            const event_loop = this.event_loop;
+            bun.default_allocator.destroy(this);
+            end.channel.deliver(end, event_loop);
+        }
+    };
+
+    pub fn create() *MessageChannel {
+        var this = bun.default_allocator.create(MessageChannel) catch unreachable;
+        this.* = .{};
+        this.ends = .{
+            .{ .channel = this, .side = 0 },
+            .{ .channel = this, .side = 1 },
+        };
+        return this;
+    }
+
+    pub fn ref(this: *MessageChannel) void {
+        _ = this.ref_count.fetchAdd(1, .Monotonic);
+    }
+
+    pub fn deref(this: *MessageChannel) void {
+        if (this.ref_count.fetchSub(1, .AcqRel) != 1) return;
+
+        log("destroy", .{});
+        for (&this.ends) |*end| {
+            for (end.inbox.items) |*message| message.deinit();
+            end.inbox.deinit(bun.default_allocator);
+        }
+        bun.default_allocator.destroy(this);
+    }
+
+    /// Returns false when the channel has been closed; the message is dropped.
+    pub fn post(this: *MessageChannel, from: u1, message: Message) bool {
+        var msg = message;
+        this.lock.lock();
+        if (this.closed) {
+            this.lock.unlock();
+            msg.deinit();
+            return false;
+        }
+
+        var end = &this.ends[~from];
+        end.inbox.append(bun.default_allocator, msg) catch unreachable;
+        this.scheduleLocked(end);
+        this.lock.unlock();
+        return true;
+    }
+
+    /// Closing either end closes both. Each side still gets a 'close' event
+    /// on its own thread once its pending messages have been dispatched.
+    pub fn close(this: *MessageChannel, side: u1) void {
+        this.lock.lock();
+        defer this.lock.unlock();
+        if (this.closed) return;
+
+        log("close({d})", .{side});
+        this.closed = true;
+
+        // Nothing will ever read what was sent to the end being closed.
+        var closing = &this.ends[side];
+        for (closing.inbox.items) |*message| message.deinit();
+        closing.inbox.clearRetainingCapacity();
+
+        for (&this.ends) |*end| {
+            end.close_pending = true;
+            this.scheduleLocked(end);
+        }
+    }
+
+    /// Binds an end to a port on the current thread.
+    pub fn attach(this: *MessageChannel, side: u1, port: *MessagePort, event_loop: *JSC.EventLoop) void {
+        this.lock.lock();
+        defer this.lock.unlock();
+        var end = &this.ends[side];
+        end.port = port;
+        end.event_loop = event_loop;
+        end.started = false;
+        end.wakeup_scheduled = false;
+        // The peer may have closed while this end was in transit.
+        this.scheduleLocked(end);
+    }
+
+    /// Unbinds an end so it can be transferred to another thread.
+    pub fn detach(this: *MessageChannel, side: u1) void {
+        this.lock.lock();
+        defer this.lock.unlock();
+        var end = &this.ends[side];
+        end.port = null;
+        end.event_loop = null;
+        end.started = false;
+        end.wakeup_scheduled = false;
+    }
+
+    pub fn start(this: *MessageChannel, side: u1) void {
+        this.lock.lock();
+        defer this.lock.unlock();
+        var end = &this.ends[side];
+        end.started = true;
+        this.scheduleLocked(end);
+    }
+
+    /// Takes the next queued message for `side` without going through the
+    /// event loop. Used by receiveMessageOnPort().
+    pub fn takeOne(this: *MessageChannel, side: u1) ?Message {
+        this.lock.lock();
+        defer this.lock.unlock();
+        var end = &this.ends[side];
+        if (end.inbox.items.len == 0) return null;
+        return end.inbox.orderedRemove(0);
+    }
+
+    fn scheduleLocked(this: *MessageChannel, end: *End) void {
+        if (end.wakeup_scheduled) return;
+        const event_loop = end.event_loop orelse return;
+        const has_messages = end.started and end.inbox.items.len > 0;
+        if (!has_messages and !end.close_pending) return;
+
+        end.wakeup_scheduled = true;
+        this.ref();
+
+        var wakeup = bun.default_allocator.create(Wakeup) catch unreachable;
+        wakeup.* = .{ .end = end, .event_loop = event_loop };
+        wakeup.task = JSC.AnyTask.New(Wakeup, Wakeup.run).init(wakeup);
+        event_loop.enqueueTaskConcurrent(wakeup.concurrent_task.from(&wakeup.task));
+    }
+
+    /// Runs on the thread that owns `end`.
+    fn deliver(this: *MessageChannel, end: *End, event_loop: *JSC.EventLoop) void {
+        defer this.deref();
+
+        this.lock.lock();
+        if (end.event_loop != event_loop) {
+            // Transferred away after this wakeup was scheduled.
+            this.lock.unlock();
+            return;
+        }
+        end.wakeup_scheduled = false;
+        const port = end.port.?;
+        // A port that was never started only hears about the close.
+        var inbox: std.ArrayListUnmanaged(Message) = .{};
+        if (end.started) {
+            inbox = end.inbox;
+            end.inbox = .{};
+        }
+        const close_pending = end.close_pending;
+        end.close_pending = false;
+        this.lock.unlock();
+
+        port.dispatch(inbox.items, close_pending);
+        inbox.deinit(bun.default_allocator);
+    }
+};
+
+/// Node's MessagePort. The JavaScript side (src/js/node/worker_threads.ts)
+/// makes it an EventEmitter; this side calls `emit` on it.
+pub const MessagePort = struct {
+    channel: ?*MessageChannel,
+    side: u1,
+    globalThis: *JSGlobalObject,
+    this_value: JSValue = .zero,
+    poll_ref: JSC.PollRef = .{},
+    has_ref: bool = true,
+    started: bool = false,
+
+    /// While started, the port stays alive so it can keep receiving
+    /// messages even if nothing else references it.
+    has_pending_activity: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
+
+    pub usingnamespace JSC.Codegen.JSMessagePort;
+
+    /// Takes over the caller's reference on `channel`.
+    pub fn create(globalThis: *JSGlobalObject, channel: *MessageChannel, side: u1) JSValue {
+        var this = bun.default_allocator.create(MessagePort) catch unreachable;
+        this.* = .{
+            .channel = channel,
+            .side = side,
+            .globalThis = globalThis,
+        };
+        const this_value = this.toJS(globalThis);
+        this.this_value = this_value;
+        channel.attach(side, this, globalThis.bunVM().eventLoop());
+        return this_value;
+    }
+
+    pub fn constructor(globalThis: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) ?*MessagePort {
+        globalThis.throw("Illegal constructor", .{});
+        return null;
+    }
+
+    pub fn hasPendingActivity(this: *MessagePort) callconv(.C) bool {
+        @fence(.Acquire);
+        return this.has_pending_activity.load(.Acquire);
+    }
+
+    fn updateRef(this: *MessagePort) void {
+        const vm = this.globalThis.bunVM();
+        const active = this.started and this.channel != null;
+        if (active and this.has_ref) {
+            this.poll_ref.ref(vm);
+        } else {
+            this.poll_ref.unref(vm);
+        }
+        this.has_pending_activity.store(active, .Release);
+    }
+
+    pub fn postMessage(this: *MessagePort, globalThis: *JSGlobalObject, callframe: *JSC.CallFrame) callconv(.C) JSValue {
+        const args = callframe.arguments(2);
+        // Like Node, posting on a closed port silently does nothing.
+        const channel = this.channel orelse return JSValue.jsUndefined();
+
+        var stack_fallback = std.heap.stackFallback(@sizeOf(JSValue) * 16, bun.default_allocator);
+        const allocator = stack_fallback.get();
+        var transfer = std.ArrayList(JSValue).init(allocator);
+        defer transfer.deinit();
+        var ports = std.ArrayList(JSValue).init(allocator);
+        defer ports.deinit();
+
+        if (args.len > 1 and !args.ptr[1].isUndefinedOrNull()) {
+            var list = args.ptr[1];
+            // Accept both a bare array and { transfer: [...] }.
+            if (!list.jsType().isArray() and list.jsType().isObject()) {
+                list = list.get(globalThis, "transfer") orelse JSValue.jsUndefined();
+            }
+
+            if (!list.isUndefinedOrNull()) {
+                if (!list.jsType().isArray()) {
+                    globalThis.throwInvalidArguments("transferList must be an Array", .{});
+                    return .zero;
+                }
+
+                var iter = list.arrayIterator(globalThis);
+                while (iter.next()) |item| {
+                    if (MessagePort.fromJS(item)) |port| {
+                        if (port == this) {
+                            SerializedScriptValue.throwDataCloneError(globalThis, "Transfer list contains source port");
+                            return .zero;
+                        }
+                        if (port.channel == null or port.channel == channel) {
+                            SerializedScriptValue.throwDataCloneError(globalThis, "MessagePort in transfer list is already detached");
+                            return .zero;
+                        }
+                        if (std.mem.indexOfScalar(JSValue, ports.items, item) != null) {
+                            SerializedScriptValue.throwDataCloneError(globalThis, "Transfer list contains duplicate MessagePort");
+                            return .zero;
+                        }
+                        ports.append(item) catch unreachable;
+                    } else {
+                        transfer.append(item) catch unreachable;
+                    }
+                }
+            }
+        }
+
+        const value = if (args.len > 0) args.ptr[0] else JSValue.jsUndefined();
+        const serialized = SerializedScriptValue.create(globalThis, value, transfer.items, ports.items) orelse return .zero;
+
+        var message = Message{ .value = serialized };
+        if (ports.items.len > 0) {
+            message.ports = bun.default_allocator.alloc(Message.Transferred, ports.items.len) catch unreachable;
+            for (ports.items, message.ports) |item, *transferred| {
+                transferred.* = MessagePort.fromJS(item).?.detach();
+            }
+        }
+
+        _ = channel.post(this.side, message);
+        return JSValue.jsUndefined();
+    }
+
+    /// Hands this port's end of the channel, and the reference on it, to the
+    /// caller. The JavaScript object is left closed, as if close() was called
+    /// without notifying the other side.
+    fn detach(this: *MessagePort) Message.Transferred {
+        const channel = this.channel.?;
+        channel.detach(this.side);
+        this.channel = null;
+        this.updateRef();
+        return .{ .channel = channel, .side = this.side };
+    }
+
+    pub fn start(this: *MessagePort, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (this.started) return JSValue.jsUndefined();
+        const channel = this.channel orelse return JSValue.jsUndefined();
+        this.started = true;
+        this.updateRef();
+        channel.start(this.side);
+        return JSValue.jsUndefined();
+    }
+
+    pub fn close(this: *MessagePort, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        if (this.channel) |channel| channel.close(this.side);
+        return JSValue.jsUndefined();
+    }
+
+    pub fn doRef(this: *MessagePort, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        this.has_ref = true;
+        this.updateRef();
+        return JSValue.jsUndefined();
+    }
+
+    pub fn doUnref(this: *MessagePort, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        this.has_ref = false;
+        this.updateRef();
+        return JSValue.jsUndefined();
+    }
+
+    pub fn hasRef(this: *MessagePort, _: *JSGlobalObject, _: *JSC.CallFrame) callconv(.C) JSValue {
+        return JSValue.jsBoolean(this.poll_ref.isActive());
+    }
+
+    /// Turns a received message back into a value, claiming the ports that
+    /// travelled with it. Returns null after emitting 'messageerror'.
+    fn receive(this: *MessagePort, message: *Message) ?JSValue {
+        const globalThis = this.globalThis;
+        defer {
+            message.value.deref();
+            bun.default_allocator.free(message.ports);
+        }
+
+        var stack_fallback = std.heap.stackFallback(@sizeOf(JSValue) * 8, bun.default_allocator);
+        const allocator = stack_fallback.get();
+        var ports = allocator.alloc(JSValue, message.ports.len) catch unreachable;
+        defer allocator.free(ports);
+        for (message.ports, ports) |transferred, *port| {
+            port.* = MessagePort.create(globalThis, transferred.channel, transferred.side);
+        }
+
+        switch (message.value.deserialize(globalThis, ports)) {
+            .result => |value| return value,
+            .err => |err| {
+                this.emit("messageerror", err);
+                return null;
+            },
+        }
+    }
+
+    /// Returns the next message without waiting for the event loop, or
+    /// undefined when none is queued.
+    pub fn receiveMessage(this: *MessagePort) JSValue {
+        const channel = this.channel orelse return JSValue.jsUndefined();
+        var message = channel.takeOne(this.side) orelse return JSValue.jsUndefined();
+        const value = this.receive(&message) orelse return JSValue.jsUndefined();
+        var result = JSValue.createEmptyObject(this.globalThis, 1);
+        result.put(this.globalThis, ZigString.static("message"), value);
+        return result;
+    }
+
+    fn dispatch(this: *MessagePort, messages: []Message, close_pending: bool) void {
+        const event_loop = this.globalThis.bunVM().eventLoop();
+        for (messages) |*message| {
+            // A listener may have closed or transferred the port.
+            if (this.channel == null) {
+                message.deinit();
+                continue;
+            }
+
+            if (this.receive(message)) |value| {
+                this.emit("message", value);
+            }
+            event_loop.drainMicrotasks();
+        }
+
+        if (close_pending) this.onClose();
+    }
+
+    fn onClose(this: *MessagePort) void {
+        const channel = this.channel orelse return;
+        log("onClose", .{});
+        this.channel = null;
+        this.updateRef();
+        channel.detach(this.side);
+        channel.deref();
+        this.emit("close", JSValue.jsUndefined());
+    }
+
+    fn emit(this: *MessagePort, comptime event: []const u8, value: JSValue) void {
+        const globalThis = this.globalThis;
+        const this_value = this.this_value;
+        this_value.ensureStillAlive();
+        value.ensureStillAlive();
+
+        const emit_fn = this_value.get(globalThis, "emit") orelse return;
+        if (!emit_fn.isCallable(globalThis.vm())) return;
+
+        const args = [_]JSValue{ ZigString.static(event).toValue(globalThis), value };
+        const argv: []const JSValue = if (value.isUndefined()) args[0..1] else args[0..];
+        const result = emit_fn.callWithThis(globalThis, this_value, argv);
+        if (result.isAnyError()) {
+            globalThis.bunVM().onUnhandledError(globalThis, result);
+        }
+    }
+
+    pub fn finalize(this: *MessagePort) callconv(.C) void {
+        log("finalize", .{});
+        this.poll_ref.unref(this.globalThis.bunVM());
+        if (this.channel) |channel| {
+            channel.close(this.side);
+            channel.detach(this.side);
+            channel.deref();
+        }
+        bun.default_allocator.destroy(this);
+    }
+};
@@ -50,6 +50,7 @@ const assert = std.debug.assert;
 const Syscall = JSC.Node.Syscall;
 
 const AnyBlob = JSC.WebCore.AnyBlob;
+const max_request_body_preallocate_length = @import("../api/server.zig").max_request_body_preallocate_length;
 pub const ReadableStream = struct {
     value: JSValue,
     ptr: Source,
@@ -3348,7 +3349,14 @@ pub const ByteStream = struct {
                     this.offset += offset;
                 },
                 .temporary_and_done, .temporary => {
-                    this.buffer = try std.ArrayList(u8).initCapacity(bun.default_allocator, chunk.len);
+                    // When the producer told us how large the body is (e.g. Content-Length),
+                    // reserve that up front so later chunks don't reallocate and re-copy what
+                    // has already been buffered. The buffer is reused once JS drains it.
+                    const initial_capacity = if (stream == .temporary)
+                        @max(chunk.len, @min(this.size_hint, max_request_body_preallocate_length))
+                    else
+                        chunk.len;
+                    this.buffer = try std.ArrayList(u8).initCapacity(bun.default_allocator, initial_capacity);
                     this.buffer.appendSliceAssumeCapacity(chunk);
                 },
                 else => unreachable,
@@ -775,12 +775,12 @@ pub const TestCommand = struct {
             }
 
             {
-                vm.global.vm().drainMicrotasks();
+                vm.eventLoop().drainMicrotasks();
                 var count = vm.unhandled_error_counter;
                 vm.global.handleRejectedPromises();
                 while (vm.unhandled_error_counter > count) {
                     count = vm.unhandled_error_counter;
-                    vm.global.vm().drainMicrotasks();
+                    vm.eventLoop().drainMicrotasks();
                     vm.global.handleRejectedPromises();
                 }
                 vm.global.vm().doWork();
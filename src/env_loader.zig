@@ -877,6 +877,10 @@ pub const Map = struct {
         return this.map.get(key);
     }
 
+    pub inline fn remove(this: *Map, key: string) void {
+        _ = this.map.orderedRemove(key);
+    }
+
     pub inline fn putDefault(this: *Map, key: string, value: string) !void {
         _ = try this.map.getOrPutValue(key, value);
     }
@@ -30,6 +30,9 @@ pub const css_supports_fence = true;
 pub const enable_entry_cache = true;
 pub const enable_bytecode_caching = false;
 
+// Transpile ES modules on the work pool when JSC fetches them asynchronously
+pub const concurrent_transpiler = true;
+
 pub const dev_only = true;
 
 pub const verbose_fs = false;
@@ -128,6 +128,7 @@ using namespace JSC;
     macro(internalRequire) \
     macro(internalStream) \
     macro(internalWritable) \
+    macro(invalidateRequireResolution) \
     macro(isAbortSignal) \
     macro(isAbsolute) \
     macro(isDisturbed) \
@@ -181,6 +181,7 @@ export function createRequireCache() {
       moduleMap.$delete(key);
       $requireMap.$delete(key);
       Loader.registry.$delete(key);
+      $invalidateRequireResolution(key);
       return true;
     },
 
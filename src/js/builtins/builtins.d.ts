@@ -348,6 +348,8 @@ declare function $requireESM(path: string): any;
 declare const $requireMap: Map<string, NodeModule>;
 declare function $resolve(name: string, from: string): Promise<string>;
 declare function $resolveSync(name: string, from: string, isESM?: boolean): string;
+/** Forget cached require() resolutions that point at `id`. */
+declare function $invalidateRequireResolution(id: string): void;
 declare function $resume(): TODO;
 declare function $search(): TODO;
 declare function $searchParams(): TODO;
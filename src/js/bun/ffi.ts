@@ -18,7 +18,7 @@ delete ffi.closeCallback;
 
 export class JSCallback {
   constructor(cb, options) {
-    const { ctx, ptr } = nativeCallback(options, cb);
+    const { ctx, ptr } = nativeCallback(options, structCallback(cb, options?.args));
     this.#ctx = ctx;
     this.ptr = ptr;
     this.#threadsafe = !!options?.threadsafe;
@@ -238,12 +238,308 @@ ffiWrappers[FFIType.function] = function functionType(val) {
   return ptr;
 };
 
-function FFIBuilder(params, returnType, functionToCall, name) {
-  const hasReturnType = typeof FFIType[returnType] === "number" && FFIType[returnType as string] !== FFIType.void;
+// Structs are laid out the way a C compiler does on the 64-bit targets Bun
+// supports: every field is aligned to its own size (or, for a nested struct,
+// to its largest field) and the struct is padded to a multiple of its
+// alignment. The generated C wrapper asserts the same size.
+const structTypes = new WeakSet();
+
+const structScalarSizes = new Array(18).fill(8);
+structScalarSizes[FFIType.char] = 1;
+structScalarSizes[FFIType.int8_t] = 1;
+structScalarSizes[FFIType.uint8_t] = 1;
+structScalarSizes[FFIType.bool] = 1;
+structScalarSizes[FFIType.int16_t] = 2;
+structScalarSizes[FFIType.uint16_t] = 2;
+structScalarSizes[FFIType.int32_t] = 4;
+structScalarSizes[FFIType.uint32_t] = 4;
+structScalarSizes[FFIType.float] = 4;
+
+function isStructType(type) {
+  return typeof type === "function" && structTypes.has(type);
+}
+
+// Accessors read straight from a DataView at a constant offset, which the
+// JIT compiles down to a load.
+function structGetterSource(type, offset) {
+  switch (type) {
+    case FFIType.char:
+    case FFIType.int8_t:
+      return `return this.view.getInt8(${offset});`;
+    case FFIType.uint8_t:
+      return `return this.view.getUint8(${offset});`;
+    case FFIType.bool:
+      return `return this.view.getUint8(${offset}) !== 0;`;
+    case FFIType.int16_t:
+      return `return this.view.getInt16(${offset}, true);`;
+    case FFIType.uint16_t:
+      return `return this.view.getUint16(${offset}, true);`;
+    case FFIType.int32_t:
+      return `return this.view.getInt32(${offset}, true);`;
+    case FFIType.uint32_t:
+      return `return this.view.getUint32(${offset}, true);`;
+    case FFIType.float:
+      return `return this.view.getFloat32(${offset}, true);`;
+    case FFIType.double:
+      return `return this.view.getFloat64(${offset}, true);`;
+    case FFIType.int64_t:
+      return `return this.view.getBigInt64(${offset}, true);`;
+    case FFIType.uint64_t:
+      return `return this.view.getBigUint64(${offset}, true);`;
+    case FFIType.i64_fast:
+      return `const value = this.view.getBigInt64(${offset}, true);
+return value >= BigInt(Number.MIN_SAFE_INTEGER) && value <= BigInt(Number.MAX_SAFE_INTEGER) ? Number(value) : value;`;
+    case FFIType.u64_fast:
+      return `const value = this.view.getBigUint64(${offset}, true);
+return value <= BigInt(Number.MAX_SAFE_INTEGER) ? Number(value) : value;`;
+    default:
+      // pointer, cstring, function
+      return `return Number(this.view.getBigUint64(${offset}, true));`;
+  }
+}
+
+function structSetterSource(type, offset) {
+  switch (type) {
+    case FFIType.char:
+    case FFIType.int8_t:
+      return `this.view.setInt8(${offset}, value);`;
+    case FFIType.uint8_t:
+      return `this.view.setUint8(${offset}, value);`;
+    case FFIType.bool:
+      return `this.view.setUint8(${offset}, value ? 1 : 0);`;
+    case FFIType.int16_t:
+      return `this.view.setInt16(${offset}, value, true);`;
+    case FFIType.uint16_t:
+      return `this.view.setUint16(${offset}, value, true);`;
+    case FFIType.int32_t:
+      return `this.view.setInt32(${offset}, value, true);`;
+    case FFIType.uint32_t:
+      return `this.view.setUint32(${offset}, value, true);`;
+    case FFIType.float:
+      return `this.view.setFloat32(${offset}, value, true);`;
+    case FFIType.double:
+      return `this.view.setFloat64(${offset}, value, true);`;
+    case FFIType.int64_t:
+    case FFIType.i64_fast:
+      return `this.view.setBigInt64(${offset}, BigInt(value), true);`;
+    case FFIType.uint64_t:
+    case FFIType.u64_fast:
+      return `this.view.setBigUint64(${offset}, BigInt(value), true);`;
+    default:
+      return `this.view.setBigUint64(${offset}, BigInt(value == null ? 0 : typeof value === "number" || typeof value === "bigint" ? value : value.ptr), true);`;
+  }
+}
+
+function defineStructField(prototype, { name, type, offset }) {
+  var get, set;
+  if (isStructType(type)) {
+    // Nested structs are views over the same memory.
+    get = function () {
+      return new type(this.view.buffer, this.view.byteOffset + offset);
+    };
+    set = function (value) {
+      const target = new type(this.view.buffer, this.view.byteOffset + offset);
+      if (value instanceof type) {
+        new Uint8Array(target.view.buffer, target.view.byteOffset, type.byteLength).set(
+          new Uint8Array(value.view.buffer, value.view.byteOffset, type.byteLength),
+        );
+      } else {
+        assignStructFields(target, value);
+      }
+    };
+  } else {
+    get = new Function(structGetterSource(type, offset));
+    set = new Function("value", structSetterSource(type, offset));
+  }
+
+  Object.defineProperty(get, "name", { value: `get ${name}` });
+  Object.defineProperty(set, "name", { value: `set ${name}` });
+  Object.defineProperty(prototype, name, { get, set, enumerable: true, configurable: false });
+}
+
+function assignStructFields(target, values) {
+  for (const { name } of target.constructor.fields) {
+    if (name in values) target[name] = values[name];
+  }
+}
+
+export function struct(definition) {
+  if (!definition || typeof definition !== "object") {
+    throw new TypeError("Expected an object mapping field names to types");
+  }
+
+  const fields = [];
+  var offset = 0;
+  var alignment = 1;
+  for (const name of Object.keys(definition)) {
+    if (name === "view" || name === "toJSON") {
+      throw new TypeError(`"${name}" can't be used as a struct field name`);
+    }
+
+    const value = definition[name];
+    const type = isStructType(value) ? value : FFIType[value];
+    if (!isStructType(type) && (typeof type !== "number" || type === FFIType.void)) {
+      throw new TypeError(`Unsupported type ${value} for struct field "${name}"`);
+    }
+
+    const size = isStructType(type) ? type.byteLength : structScalarSizes[type];
+    const fieldAlignment = isStructType(type) ? type.alignment : size;
+    offset = Math.ceil(offset / fieldAlignment) * fieldAlignment;
+    fields.push(Object.freeze({ name, type, offset }));
+    offset += size;
+    alignment = Math.max(alignment, fieldAlignment);
+  }
+
+  if (fields.length === 0) {
+    throw new TypeError("Structs must have at least one field");
+  }
+
+  const byteLength = Math.ceil(offset / alignment) * alignment;
+
+  class Struct {
+    view;
+
+    // new Struct() zero-fills new memory, new Struct({ ...fields }) also
+    // assigns them, and new Struct(buffer, byteOffset) is a view over
+    // existing memory.
+    constructor(buffer, byteOffset = 0) {
+      if (buffer instanceof ArrayBuffer || buffer instanceof SharedArrayBuffer) {
+        this.view = new DataView(buffer, byteOffset, byteLength);
+      } else if (ArrayBuffer.isView(buffer)) {
+        this.view = new DataView(buffer.buffer, buffer.byteOffset + byteOffset, byteLength);
+      } else {
+        this.view = new DataView(new ArrayBuffer(byteLength));
+        if (buffer != null) assignStructFields(this, buffer);
+      }
+    }
+
+    static get byteLength() {
+      return byteLength;
+    }
+
+    static get alignment() {
+      return alignment;
+    }
+
+    static get fields() {
+      return fields;
+    }
+
+    toJSON() {
+      const result = {};
+      for (const { name, type } of fields) {
+        result[name] = isStructType(type) ? this[name].toJSON() : this[name];
+      }
+      return result;
+    }
+  }
+
+  Object.freeze(fields);
+  for (const field of fields) {
+    defineStructField(Struct.prototype, field);
+  }
+  structTypes.add(Struct);
+  return Struct;
+}
+
+// Structs passed by value reach the C wrapper as a pointer to their bytes.
+// Those bytes are first copied into a slot the wrapper owns: a struct built
+// from a plain object would otherwise be garbage the moment its address was
+// taken, and building the next argument could free it before the native call
+// reads it. The C wrapper copies the struct out of the slot before calling the
+// function, so reentrant calls can reuse it.
+function structArgument(type, value, slot) {
+  if (typeof value === "number") {
+    return value;
+  }
+
+  var source;
+  if (value instanceof type) {
+    source = new Uint8Array(value.view.buffer, value.view.byteOffset, type.byteLength);
+  } else if (ArrayBuffer.isView(value) || value instanceof ArrayBuffer) {
+    if (value.byteLength < type.byteLength) {
+      throw new RangeError(`Expected at least ${type.byteLength} bytes for a struct, got ${value.byteLength}`);
+    }
+    source = ArrayBuffer.isView(value)
+      ? new Uint8Array(value.buffer, value.byteOffset, type.byteLength)
+      : new Uint8Array(value, 0, type.byteLength);
+  } else if (value && typeof value === "object") {
+    slot.bytes.fill(0);
+    assignStructFields(slot.value, value);
+    return slot.address;
+  } else {
+    throw new TypeError(`Unable to convert ${value} to a struct`);
+  }
+
+  slot.bytes.set(source);
+  return slot.address;
+}
+
+function createStructSlots(params) {
+  var slots = new Array(params.length);
+  var offsets = new Array(params.length);
+  var byteLength = 0;
+  for (let i = 0; i < params.length; i++) {
+    const type = params[i];
+    if (!isStructType(type)) continue;
+    byteLength = Math.ceil(byteLength / type.alignment) * type.alignment;
+    offsets[i] = byteLength;
+    byteLength += type.byteLength;
+  }
+
+  if (byteLength === 0) {
+    return slots;
+  }
+
+  const buffer = new ArrayBuffer(byteLength);
+  const address = ptr(buffer);
+  for (let i = 0; i < params.length; i++) {
+    const type = params[i];
+    if (!isStructType(type)) continue;
+    slots[i] = {
+      value: new type(buffer, offsets[i]),
+      bytes: new Uint8Array(buffer, offsets[i], type.byteLength),
+      address: address + offsets[i],
+    };
+  }
+  return slots;
+}
+
+// A JSCallback receives structs as a pointer into the caller's frame, so
+// they're copied before the callback can hold on to them.
+function structCallback(cb, params) {
+  if (typeof cb !== "function" || !params?.some?.(isStructType)) {
+    return cb;
+  }
+
+  return function (...args) {
+    for (let i = 0; i < params.length; i++) {
+      const type = params[i];
+      if (isStructType(type)) {
+        args[i] = new type(toArrayBuffer(args[i], 0, type.byteLength).slice(0));
+      }
+    }
+    return cb.apply(this, args);
+  };
+}
+
+// `symbols` is the object the native function was created as a method of.
+// Calling it with that `this` lets the DFG/FTL use its DOMJIT signature.
+function FFIBuilder(params, returnType, functionToCall, name, symbols) {
+  const returnsStruct = isStructType(returnType);
+  const hasReturnType =
+    !returnsStruct && typeof FFIType[returnType] === "number" && FFIType[returnType as string] !== FFIType.void;
   var paramNames = new Array(params.length);
   var args = new Array(params.length);
+  var structs = new Array(params.length + 1);
   for (let i = 0; i < params.length; i++) {
     paramNames[i] = `p${i}`;
+    if (isStructType(params[i])) {
+      structs[i] = params[i];
+      args[i] = `structArgument(structs[${i}], p${i}, slots[${i}])`;
+      continue;
+    }
+
     const wrapper = ffiWrappers[FFIType[params[i]]];
     if (wrapper) {
       // doing this inline benchmarked about 4x faster than referencing
@@ -253,8 +549,13 @@ function FFIBuilder(params, returnType, functionToCall, name) {
     }
   }
 
-  var code = `functionToCall(${args.join(", ")})`;
-  if (hasReturnType) {
+  var code = `functionToCall.call(${["symbols", ...args].join(", ")})`;
+  if (returnsStruct) {
+    // The C wrapper copies the result into memory we pass as an extra argument.
+    structs[params.length] = returnType;
+    args.push("ptr(result.view)");
+    code = `const result = new structs[${params.length}](); functionToCall.call(${["symbols", ...args].join(", ")}); return result`;
+  } else if (hasReturnType) {
     if (FFIType[returnType as string] === FFIType.cstring) {
       code = `return (${cstringReturnType.toString()})(${code})`;
     } else {
@@ -262,7 +563,14 @@ function FFIBuilder(params, returnType, functionToCall, name) {
     }
   }
 
-  var func = new Function("functionToCall", ...paramNames, code);
+  var func = new Function(
+    "structArgument",
+    "structs",
+    "slots",
+    "ptr",
+    "symbols",
+    `return function (functionToCall, ${paramNames.join(", ")}) { ${code} }`,
+  )(structArgument, structs, createStructSlots(params), ptr, symbols);
   Object.defineProperty(func, "name", {
     value: name,
   });
@@ -323,12 +631,20 @@ export const native = {
   },
 };
 
+function needsFFIBuilder(definition) {
+  return (
+    definition?.args?.length ||
+    FFIType[definition?.returns as string] === FFIType.cstring ||
+    isStructType(definition?.returns)
+  );
+}
+
 export function dlopen(path, options) {
   const result = nativeDLOpen(path, options);
 
   for (let key in result.symbols) {
     var symbol = result.symbols[key];
-    if (options[key]?.args?.length || FFIType[options[key]?.returns as string] === FFIType.cstring) {
+    if (needsFFIBuilder(options[key])) {
       result.symbols[key] = FFIBuilder(
         options[key].args ?? [],
         options[key].returns ?? FFIType.void,
@@ -339,6 +655,7 @@ export function dlopen(path, options) {
         // we want
         //    "sqlite3_get_version() - sqlit3.so"
         path.includes("/") ? `${key} (${path.split("/").pop()})` : `${key} (${path})`,
+        result.symbols,
       );
     } else {
       // consistentcy
@@ -354,8 +671,14 @@ export function linkSymbols(options) {
 
   for (let key in result.symbols) {
     var symbol = result.symbols[key];
-    if (options[key]?.args?.length || FFIType[options[key]?.returns as string] === FFIType.cstring) {
-      result.symbols[key] = FFIBuilder(options[key].args ?? [], options[key].returns ?? FFIType.void, symbol, key);
+    if (needsFFIBuilder(options[key])) {
+      result.symbols[key] = FFIBuilder(
+        options[key].args ?? [],
+        options[key].returns ?? FFIType.void,
+        symbol,
+        key,
+        result.symbols,
+      );
     } else {
       // consistentcy
       result.symbols[key].native = result.symbols[key];
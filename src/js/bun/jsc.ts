@@ -9,6 +9,7 @@ export const describe = jscDescribe;
 export const describeArray = jscDescribeArray;
 export const drainMicrotasks = jsc.drainMicrotasks;
 export const edenGC = jsc.edenGC;
+export const eventLoopStats = jsc.eventLoopStats;
 export const fullGC = jsc.fullGC;
 export const gcAndSweep = jsc.gcAndSweep;
 export const getRandomSeed = jsc.getRandomSeed;
@@ -21,9 +22,11 @@ export const memoryUsage = jsc.memoryUsage;
 export const noInline = jsc.noInline;
 export const noFTL = jsc.noFTL;
 export const noOSRExitFuzzing = jsc.noOSRExitFuzzing;
+export const nextTickQueueStats = jsc.nextTickQueueStats;
 export const numberOfDFGCompiles = jsc.numberOfDFGCompiles;
 export const optimizeNextInvocation = jsc.optimizeNextInvocation;
 export const releaseWeakRefs = jsc.releaseWeakRefs;
+export const requireResolutionCacheStats = jsc.requireResolutionCacheStats;
 export const reoptimizationRetryCount = jsc.reoptimizationRetryCount;
 export const setRandomSeed = jsc.setRandomSeed;
 export const startRemoteDebugger = jsc.startRemoteDebugger;
@@ -1,52 +1,561 @@
 // Hardcoded module "node:cluster"
-// This is a stub
-// We leave it in here to provide a better error message
-// TODO: implement node cluster
+//
+// Workers are child processes started with Bun.spawn(). Each one connects back
+// to the primary over a Unix domain socket whose path is passed down in the
+// environment, and both sides exchange newline-delimited JSON messages over
+// it. Messages from cluster itself have `cmd: "NODE_CLUSTER"`, like in Node.
+//
+// Node's primary owns the listening sockets and hands accepted connections to
+// the workers. Bun.spawn() can't pass file descriptors, so instead each worker
+// listens on the port itself: Bun.serve() and Bun.listen() set SO_REUSEPORT
+// unless asked not to, and the kernel spreads connections across the workers.
 import EventEmitter from "node:events";
+import { tmpdir } from "node:os";
+import { join } from "node:path";
+import { unlinkSync } from "node:fs";
 import { throwNotImplemented } from "../shared";
 
-export var SCHED_NONE = 0,
-  SCHED_RR = 1,
+const { Bun } = globalThis[Symbol.for("Bun.lazy")]("primordials");
+
+const IPC_PATH_ENV = "BUN_CLUSTER_IPC_PATH";
+const INTERNAL = "NODE_CLUSTER";
+
+// setupWorker() removes both variables from the environment, so that
+// processes the worker spawns don't start up as cluster workers too.
+const workerId = process.env.NODE_UNIQUE_ID;
+const workerIpcPath = process.env[IPC_PATH_ENV];
+
+export var SCHED_NONE = 1,
+  SCHED_RR = 2,
+  isWorker = workerId !== undefined && workerIpcPath !== undefined,
+  isPrimary = !isWorker,
+  isMaster = isPrimary,
   Worker,
-  schedulingPolicy = 2,
-  isWorker = false,
-  isPrimary = true,
-  isMaster = true,
   cluster;
 
-Worker = function Worker() {
-  throwNotImplemented("node:cluster Worker", 2428);
+// Only SCHED_NONE is supported: see the note at the top of the file. Node's
+// round-robin default needs the primary to accept connections, so asking for
+// it throws instead of quietly behaving like SCHED_NONE.
+function policyFromEnvironment() {
+  switch (process.env.NODE_CLUSTER_SCHED_POLICY) {
+    case "rr":
+      return SCHED_RR;
+    default:
+      return SCHED_NONE;
+  }
+}
+
+function validateSchedulingPolicy(policy) {
+  if (policy === SCHED_RR) throwNotImplemented("cluster.SCHED_RR");
+  if (policy !== SCHED_NONE) {
+    const error = new TypeError(`Invalid cluster.schedulingPolicy: ${policy}`);
+    error.code = "ERR_INVALID_ARG_VALUE";
+    throw error;
+  }
+}
+
+// One end of the IPC socket. Outgoing messages are queued until the socket is
+// connected and whenever the kernel buffer is full.
+class Channel {
+  socket = null;
+  onMessage = null;
+  onClose = null;
+  #decoder = new TextDecoder();
+  #incoming = "";
+  #outgoing = [];
+  #ending = false;
+  #closed = false;
+
+  attach(socket) {
+    this.socket = socket;
+    this.flush();
+  }
+
+  get connected() {
+    return !this.#closed;
+  }
+
+  send(message) {
+    if (this.#closed) return false;
+    this.#outgoing.push(Buffer.from(JSON.stringify(message) + "\n"));
+    this.flush();
+    return true;
+  }
+
+  flush() {
+    const socket = this.socket;
+    if (!socket) return;
+
+    while (this.#outgoing.length > 0) {
+      const chunk = this.#outgoing[0];
+      const written = socket.write(chunk);
+      if (written < chunk.length) {
+        // The rest goes out on the next drain.
+        if (written > 0) this.#outgoing[0] = chunk.subarray(written);
+        return;
+      }
+      this.#outgoing.shift();
+    }
+  }
+
+  receive(data) {
+    const lines = (this.#incoming + this.#decoder.decode(data, { stream: true })).split("\n");
+    this.#incoming = lines.pop();
+
+    for (const line of lines) {
+      if (line.length === 0) continue;
+      let message;
+      try {
+        message = JSON.parse(line);
+      } catch {
+        continue;
+      }
+      this.onMessage?.(message);
+    }
+  }
+
+  // Closes the socket once everything queued has been written.
+  end() {
+    if (this.#closed) return;
+    if (this.#outgoing.length > 0 && this.socket) {
+      this.#ending = true;
+      return;
+    }
+    this.socket?.end();
+  }
+
+  drained() {
+    this.flush();
+    if (this.#ending && this.#outgoing.length === 0) this.socket.end();
+  }
+
+  closed() {
+    if (this.#closed) return;
+    this.#closed = true;
+    this.#outgoing.length = 0;
+    this.onClose?.();
+  }
+}
+
+const channelHandlers = {
+  data(socket, data) {
+    socket.data.receive(data);
+  },
+  drain(socket) {
+    socket.data.drained();
+  },
+  close(socket) {
+    socket.data.closed();
+  },
+  error(socket) {
+    socket.data.closed();
+  },
 };
 
-// TODO: is it okay for this to be a class?
-class Cluster extends EventEmitter {
-  static isWorker = false;
-  static isPrimary = true;
-  static isMaster = true;
+function isInternal(message) {
+  return message !== null && typeof message === "object" && message.cmd === INTERNAL;
+}
+
+function addressType(address) {
+  if (typeof address === "string" && address.includes(":")) return 6;
+  return 4;
+}
 
-  static Worker = Worker;
+Worker = class Worker extends EventEmitter {
+  id;
+  process;
+  state = "none";
+  exitedAfterDisconnect = undefined;
+  #channel;
 
-  fork() {
-    throwNotImplemented("node:cluster", 2428);
+  constructor(options = {}) {
+    super();
+    this.id = options.id | 0;
+    this.process = options.process;
+    this.#channel = options.channel ?? null;
+    if (options.state) this.state = options.state;
+  }
+
+  get suicide() {
+    return this.exitedAfterDisconnect;
+  }
+
+  set suicide(value) {
+    this.exitedAfterDisconnect = value;
+  }
+
+  send(message, handle, options, callback) {
+    if (typeof handle === "function") callback = handle;
+    else if (typeof options === "function") callback = options;
+
+    const sent = this.#channel ? this.#channel.send(message) : false;
+    if (typeof callback === "function") {
+      process.nextTick(callback, sent ? null : channelClosedError());
+    }
+    return sent;
   }
 
   disconnect() {
-    throwNotImplemented("node:cluster", 2428);
+    if (isPrimary) {
+      this.exitedAfterDisconnect = true;
+      if (this.isConnected()) this._sendInternal({ act: "disconnect" });
+    } else {
+      disconnectWorker(this, true);
+    }
+    return this;
+  }
+
+  kill(signal = "SIGTERM") {
+    if (!isPrimary) {
+      if (!this.isConnected()) process.exit(0);
+      this.once("disconnect", () => process.exit(0));
+      disconnectWorker(this, true);
+      return;
+    }
+
+    this.exitedAfterDisconnect = true;
+    if (this.isConnected()) {
+      this.once("disconnect", () => this.process.kill(signal));
+      this._sendInternal({ act: "disconnect" });
+      return;
+    }
+    this.process.kill(signal);
+  }
+
+  destroy(signal) {
+    this.kill(signal);
+  }
+
+  isConnected() {
+    return !!this.#channel && this.#channel.connected;
+  }
+
+  isDead() {
+    return this.state === "dead";
   }
 
-  setupMaster() {
-    throwNotImplemented("node:cluster", 2428);
+  _setChannel(channel) {
+    this.#channel = channel;
   }
 
+  _sendInternal(message) {
+    return this.#channel ? this.#channel.send({ ...message, cmd: INTERNAL }) : false;
+  }
+
+  _closeChannel() {
+    this.#channel?.end();
+  }
+};
+
+function channelClosedError() {
+  const error = new Error("Channel closed");
+  error.code = "ERR_IPC_CHANNEL_CLOSED";
+  return error;
+}
+
+class Cluster extends EventEmitter {
+  isWorker = isWorker;
+  isPrimary = isPrimary;
+  isMaster = isMaster;
+  Worker = Worker;
+  worker = undefined;
+  workers = isPrimary ? {} : undefined;
   settings = {};
-  workers = {};
-  SCHED_NONE = 0;
-  SCHED_RR = 1;
-  schedulingPolicy = 2;
+  SCHED_NONE = SCHED_NONE;
+  SCHED_RR = SCHED_RR;
+  schedulingPolicy = policyFromEnvironment();
   // @ts-expect-error
   [Symbol.for("CommonJS")] = 0;
+
+  setupPrimary(settings) {
+    setupPrimary(this, settings);
+  }
+
+  setupMaster(settings) {
+    setupPrimary(this, settings);
+  }
+
+  fork(env) {
+    if (!isPrimary) throw new Error("cluster.fork() can only be called from the primary");
+    return forkWorker(this, env);
+  }
+
+  disconnect(callback) {
+    if (isPrimary) {
+      disconnectAll(this, callback);
+    } else {
+      this.worker.disconnect();
+      if (typeof callback === "function") process.nextTick(callback);
+    }
+  }
+
+  // Called by node:http and node:net once a server in a worker is listening.
+  _onServerListening(server, address) {
+    if (isWorker) workerServerListening(server, address);
+  }
 }
 
 cluster = new Cluster();
 
+// ---- Primary ----------------------------------------------------------------
+
+var ipcServer = null;
+var ipcPath = "";
+var nextWorkerId = 0;
+
+function setupPrimary(self, settings) {
+  if (!isPrimary) throw new Error("cluster.setupPrimary() can only be called from the primary");
+
+  self.settings = {
+    args: process.argv.slice(2),
+    exec: process.argv[1],
+    execArgv: process.execArgv,
+    silent: false,
+    ...self.settings,
+    ...settings,
+  };
+
+  if (settings?.schedulingPolicy !== undefined) self.schedulingPolicy = settings.schedulingPolicy;
+  validateSchedulingPolicy(self.schedulingPolicy);
+  self.settings.schedulingPolicy = self.schedulingPolicy;
+
+  process.nextTick(() => self.emit("setup", self.settings));
+}
+
+function listenForWorkers() {
+  if (ipcServer) return;
+
+  ipcPath = join(tmpdir(), `bun-cluster-${process.pid}-${Math.random().toString(36).slice(2)}.sock`);
+  ipcServer = Bun.listen({
+    unix: ipcPath,
+    socket: {
+      ...channelHandlers,
+      open(socket) {
+        const channel = new Channel();
+        channel.onMessage = message => onWorkerHandshake(channel, message);
+        socket.data = channel;
+        socket.unref();
+        channel.attach(socket);
+      },
+    },
+  });
+
+  // Running workers keep the primary alive, the IPC socket doesn't.
+  ipcServer.unref();
+  process.once("exit", () => {
+    try {
+      unlinkSync(ipcPath);
+    } catch {}
+  });
+}
+
+function onWorkerHandshake(channel, message) {
+  if (!isInternal(message) || message.act !== "online") return;
+
+  const worker = cluster.workers[message.id];
+  if (!worker || worker.state === "dead") {
+    channel.end();
+    return;
+  }
+
+  worker._setChannel(channel);
+  channel.onMessage = message => onWorkerMessage(worker, message);
+  channel.onClose = () => onWorkerDisconnect(worker);
+
+  worker.state = "online";
+  worker.emit("online");
+  cluster.emit("online", worker);
+}
+
+function onWorkerMessage(worker, message) {
+  if (!isInternal(message)) {
+    worker.emit("message", message);
+    cluster.emit("message", worker, message);
+    return;
+  }
+
+  switch (message.act) {
+    case "listening": {
+      const address = { address: message.address, port: message.port, addressType: message.addressType };
+      worker.state = "listening";
+      worker.emit("listening", address);
+      cluster.emit("listening", worker, address);
+      break;
+    }
+    case "exitedAfterDisconnect":
+      worker.exitedAfterDisconnect = true;
+      break;
+  }
+}
+
+function onWorkerDisconnect(worker) {
+  if (worker.state !== "dead") worker.state = "disconnected";
+  worker.emit("disconnect");
+  cluster.emit("disconnect", worker);
+  if (worker.isDead()) removeWorker(worker);
+}
+
+function onWorkerExit(worker, exitCode, signalCode) {
+  worker.state = "dead";
+  worker.emit("exit", exitCode, signalCode);
+  cluster.emit("exit", worker, exitCode, signalCode);
+
+  // A worker that crashed never closes its end of the channel cleanly.
+  if (worker.isConnected()) worker._closeChannel();
+  else removeWorker(worker);
+}
+
+function removeWorker(worker) {
+  if (cluster.workers[worker.id] === worker) delete cluster.workers[worker.id];
+}
+
+function forkWorker(self, env) {
+  if (!self.settings.exec) setupPrimary(self, {});
+  validateSchedulingPolicy(self.schedulingPolicy);
+  listenForWorkers();
+
+  const settings = self.settings;
+  const id = ++nextWorkerId;
+  const worker = new Worker({ id });
+
+  worker.process = Bun.spawn({
+    cmd: [process.execPath, ...settings.execArgv, settings.exec, ...settings.args],
+    cwd: settings.cwd || process.cwd(),
+    env: {
+      ...process.env,
+      ...env,
+      NODE_UNIQUE_ID: String(id),
+      [IPC_PATH_ENV]: ipcPath,
+    },
+    stdio: ["inherit", settings.silent ? "pipe" : "inherit", settings.silent ? "pipe" : "inherit"],
+    onExit(_subprocess, exitCode, signalCode) {
+      onWorkerExit(worker, exitCode, signalCode);
+    },
+  });
+
+  self.workers[id] = worker;
+  process.nextTick(() => self.emit("fork", worker));
+  return worker;
+}
+
+function disconnectAll(self, callback) {
+  const workers = Object.values(self.workers);
+  let pending = 0;
+
+  for (const worker of workers) {
+    if (!worker.isConnected()) continue;
+    pending++;
+    worker.once("disconnect", () => {
+      if (--pending === 0) done();
+    });
+    worker.disconnect();
+  }
+
+  function done() {
+    if (ipcServer) {
+      ipcServer.stop(true);
+      ipcServer = null;
+    }
+    if (typeof callback === "function") callback();
+  }
+
+  if (pending === 0) process.nextTick(done);
+}
+
+// ---- Worker -----------------------------------------------------------------
+
+var workerServers = new Set();
+
+// The runtime loads this module before the entry point whenever
+// NODE_UNIQUE_ID and BUN_CLUSTER_IPC_PATH are set, so every worker connects
+// back to the primary even if it never imports node:cluster itself.
+function setupWorker(self) {
+  delete process.env.NODE_UNIQUE_ID;
+  delete process.env[IPC_PATH_ENV];
+
+  const channel = new Channel();
+  const worker = new Worker({ id: workerId, process, channel, state: "online" });
+  self.worker = worker;
+
+  channel.onMessage = message => {
+    if (isInternal(message)) {
+      if (message.act === "disconnect") disconnectWorker(worker, false);
+      return;
+    }
+    worker.emit("message", message);
+    process.emit("message", message);
+  };
+  channel.onClose = () => {
+    worker.state = "disconnected";
+    worker.emit("disconnect");
+    process.emit("disconnect");
+  };
+
+  if (typeof process.send !== "function") {
+    process.send = (message, handle, options, callback) => worker.send(message, handle, options, callback);
+    process.disconnect = () => worker.disconnect();
+    Object.defineProperty(process, "connected", {
+      get: () => worker.isConnected(),
+      configurable: true,
+      enumerable: true,
+    });
+  }
+
+  channel.send({ cmd: INTERNAL, act: "online", id: worker.id });
+
+  Bun.connect({
+    unix: workerIpcPath,
+    socket: {
+      ...channelHandlers,
+      open(socket) {
+        socket.data = channel;
+        // Like Node, the channel only keeps a worker alive while someone is
+        // waiting for messages on it.
+        socket.unref();
+        channel.attach(socket);
+      },
+      connectError() {
+        channel.closed();
+      },
+    },
+  }).catch(() => channel.closed());
+
+  process.on("beforeExit", () => {
+    if (channel.socket && channel.connected && (worker.listenerCount("message") > 0 || process.listenerCount("message") > 0)) {
+      channel.socket.ref();
+    }
+  });
+}
+
+function workerServerListening(server, address) {
+  // Closed again before the listening event fired.
+  if (!address) return;
+
+  workerServers.add(server);
+  server.once("close", () => workerServers.delete(server));
+
+  cluster.worker._sendInternal(
+    typeof address === "string"
+      ? { act: "listening", address, port: undefined, addressType: -1 }
+      : { act: "listening", address: address.address, port: address.port, addressType: addressType(address.address) },
+  );
+}
+
+function disconnectWorker(worker, initiatedByWorker) {
+  if (initiatedByWorker) {
+    worker.exitedAfterDisconnect = true;
+    worker._sendInternal({ act: "exitedAfterDisconnect" });
+  }
+
+  for (const server of workerServers) {
+    try {
+      server.close();
+    } catch {}
+  }
+  workerServers.clear();
+  worker._closeChannel();
+}
+
+if (isWorker) setupWorker(cluster);
+
 export { cluster as default };
@@ -305,6 +305,9 @@ function emitListeningNextTick(self, onListen, err, hostname, port) {
   if (err) {
     self.emit("error", err);
   } else {
+    // Loaded here so that importing node:http doesn't load node:cluster too.
+    const cluster = import.meta.require("node:cluster");
+    if (cluster.isWorker) cluster._onServerListening(self, { address: hostname, port });
     self.emit("listening", hostname, port);
   }
 }
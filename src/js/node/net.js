@@ -865,6 +865,9 @@ function emitListeningNextTick(self, onListen) {
       self.emit("error", err);
     }
   }
+  // Loaded here so that importing node:net doesn't load node:cluster too.
+  const cluster = import.meta.require("node:cluster");
+  if (cluster.isWorker) cluster._onServerListening(self, self.address());
   self.emit("listening");
 }
 
@@ -0,0 +1,354 @@
+// Hardcoded module "node:worker_threads"
+//
+// Each Worker runs its own VirtualMachine on a dedicated thread. Messages are
+// serialized with the structured clone algorithm and queued on a native
+// channel; the receiving thread is woken once per batch rather than once per
+// message. ArrayBuffers in the transfer list are detached and handed over
+// without copying, and SharedArrayBuffers are shared between threads.
+import { EventEmitter } from "node:events";
+import { resolve as resolvePath, isAbsolute } from "node:path";
+import { fileURLToPath } from "node:url";
+import { hideFromStack, throwNotImplemented } from "../shared";
+
+const {
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  MessagePort,
+  createWorker,
+  createChannel,
+  receiveMessageOnPort: receiveMessageOnPortNative,
+} = globalThis[Symbol.for("Bun.lazy")]("worker_threads");
+
+const SHARE_ENV = Symbol.for("nodejs.worker_threads.SHARE_ENV");
+
+function ERR_INVALID_ARG_TYPE(name, expected, actual) {
+  const err = new TypeError(`The "${name}" argument must be ${expected}. Received ${typeof actual}`);
+  err.code = "ERR_INVALID_ARG_TYPE";
+  return err;
+}
+
+function ERR_WORKER_PATH(filename) {
+  const err = new TypeError(
+    "The worker script or module filename must be an absolute path or a relative path starting with './' or '../'." +
+      ` Received "${filename}"`,
+  );
+  err.code = "ERR_WORKER_PATH";
+  return err;
+}
+
+// MessagePort is a native class; give it Node's EventEmitter interface. A port
+// only starts delivering (and only keeps the process alive) once something
+// listens for 'message', and stops keeping it alive when the last listener
+// goes away.
+const MessagePortPrototype = MessagePort.prototype;
+Object.setPrototypeOf(MessagePortPrototype, EventEmitter.prototype);
+
+const {
+  addListener: emitterAddListener,
+  prependListener: emitterPrependListener,
+  removeListener: emitterRemoveListener,
+  removeAllListeners: emitterRemoveAllListeners,
+} = EventEmitter.prototype;
+
+function startOnMessageListener(port, type) {
+  if (type === "message" && port.listenerCount("message") === 1) {
+    port.ref();
+    port.start();
+  }
+}
+
+function stopOnLastMessageListener(port, type) {
+  if ((type === undefined || type === "message") && port.listenerCount("message") === 0) {
+    port.unref();
+  }
+}
+
+MessagePortPrototype.addListener = MessagePortPrototype.on = function addListener(type, fn) {
+  emitterAddListener.call(this, type, fn);
+  startOnMessageListener(this, type);
+  return this;
+};
+
+MessagePortPrototype.prependListener = function prependListener(type, fn) {
+  emitterPrependListener.call(this, type, fn);
+  startOnMessageListener(this, type);
+  return this;
+};
+
+MessagePortPrototype.removeListener = MessagePortPrototype.off = function removeListener(type, fn) {
+  emitterRemoveListener.call(this, type, fn);
+  stopOnLastMessageListener(this, type);
+  return this;
+};
+
+MessagePortPrototype.removeAllListeners = function removeAllListeners(type) {
+  emitterRemoveAllListeners.call(this, type);
+  stopOnLastMessageListener(this, type);
+  return this;
+};
+
+// The DOM-style interface, for code written against the web MessagePort.
+const kOnMessage = Symbol("onmessage");
+const kEventListeners = Symbol("eventListeners");
+
+function wrapEventListener(port, type, listener) {
+  return function (value) {
+    const event = type === "close" ? { type, target: port } : { type, target: port, data: value };
+    if (typeof listener === "function") listener.call(port, event);
+    else listener.handleEvent(event);
+  };
+}
+
+MessagePortPrototype.addEventListener = function addEventListener(type, listener, options) {
+  if (listener == null) return;
+  const listeners = (this[kEventListeners] ??= new Map());
+  const key = `${type}`;
+  let byType = listeners.get(key);
+  if (!byType) listeners.set(key, (byType = new Map()));
+  if (byType.has(listener)) return;
+
+  const wrapped = wrapEventListener(this, key, listener);
+  byType.set(listener, wrapped);
+  if (options?.once) {
+    this.once(key, value => {
+      byType.delete(listener);
+      wrapped(value);
+    });
+  } else {
+    this.on(key, wrapped);
+  }
+};
+
+MessagePortPrototype.removeEventListener = function removeEventListener(type, listener) {
+  const byType = this[kEventListeners]?.get(`${type}`);
+  const wrapped = byType?.get(listener);
+  if (!wrapped) return;
+  byType.delete(listener);
+  this.off(`${type}`, wrapped);
+};
+
+Object.defineProperty(MessagePortPrototype, "onmessage", {
+  get() {
+    return this[kOnMessage] ?? null;
+  },
+  set(listener) {
+    if (this[kOnMessage]) this.removeEventListener("message", this[kOnMessage]);
+    this[kOnMessage] = typeof listener === "function" ? listener : null;
+    if (this[kOnMessage]) this.addEventListener("message", this[kOnMessage]);
+  },
+  configurable: true,
+  enumerable: true,
+});
+
+class MessageChannel {
+  port1;
+  port2;
+
+  constructor() {
+    [this.port1, this.port2] = createChannel();
+  }
+}
+
+function receiveMessageOnPort(port) {
+  if (!(port instanceof MessagePort)) {
+    throw ERR_INVALID_ARG_TYPE("port", "an instance of MessagePort", port);
+  }
+  return receiveMessageOnPortNative(port);
+}
+
+function resolveWorkerFilename(filename) {
+  if (filename instanceof URL) {
+    return fileURLToPath(filename);
+  }
+
+  if (typeof filename !== "string") {
+    throw ERR_INVALID_ARG_TYPE("filename", "of type string or an instance of URL", filename);
+  }
+
+  if (filename.startsWith("file:")) {
+    return fileURLToPath(filename);
+  }
+
+  if (isAbsolute(filename) || /^\.\.?[\\/]/.test(filename)) {
+    return resolvePath(filename);
+  }
+
+  throw ERR_WORKER_PATH(filename);
+}
+
+class Worker extends EventEmitter {
+  #handle;
+  #port;
+  #exitCode = null;
+  #terminating = [];
+
+  constructor(filename, options = {}) {
+    super();
+
+    if (options.eval) {
+      throwNotImplemented("worker_threads.Worker option eval");
+    }
+
+    const path = resolveWorkerFilename(filename);
+    this.#handle = createWorker(path, options.workerData, options.transferList, (event, value) => {
+      switch (event) {
+        case "online":
+          this.emit("online");
+          break;
+        case "error":
+          this.emit("error", value);
+          break;
+        case "exit":
+          this.#onExit(value);
+          break;
+      }
+    });
+
+    // The worker handle keeps the process alive; the port only forwards.
+    const port = (this.#port = this.#handle.port);
+    emitterAddListener.call(port, "message", message => this.emit("message", message));
+    emitterAddListener.call(port, "messageerror", err => this.emit("messageerror", err));
+    port.unref();
+    port.start();
+  }
+
+  #onExit(code) {
+    this.#exitCode = code;
+    this.#port.close();
+    this.emit("exit", code);
+    for (const resolve of this.#terminating.splice(0)) {
+      resolve(code);
+    }
+  }
+
+  get threadId() {
+    return this.#handle.threadId;
+  }
+
+  get resourceLimits() {
+    return {};
+  }
+
+  get stdin() {
+    return null;
+  }
+
+  get stdout() {
+    return null;
+  }
+
+  get stderr() {
+    return null;
+  }
+
+  get performance() {
+    return { eventLoopUtilization: () => ({ idle: 0, active: 0, utilization: 0 }) };
+  }
+
+  postMessage(value, transferList) {
+    this.#port.postMessage(value, transferList);
+  }
+
+  ref() {
+    this.#handle.ref();
+  }
+
+  unref() {
+    this.#handle.unref();
+  }
+
+  terminate(callback) {
+    if (typeof callback === "function") {
+      process.emitWarning(
+        "Passing a callback to worker.terminate() is deprecated. It returns a Promise instead.",
+        "DeprecationWarning",
+        "DEP0132",
+      );
+    }
+
+    const promise =
+      this.#exitCode !== null
+        ? Promise.resolve(this.#exitCode)
+        : new Promise(resolve => {
+            this.#terminating.push(resolve);
+            this.#handle.terminate();
+          });
+    if (typeof callback === "function") {
+      promise.then(code => callback(null, code), callback);
+    }
+    return promise;
+  }
+
+  getHeapSnapshot() {
+    throwNotImplemented("worker_threads.Worker.getHeapSnapshot");
+  }
+}
+
+function markAsUntransferable() {}
+
+function moveMessagePortToContext() {
+  throwNotImplemented("worker_threads.moveMessagePortToContext");
+}
+
+// Environment data is not copied into workers yet; each thread sees only
+// what it set itself.
+const environmentData = new Map();
+
+function setEnvironmentData(key, value) {
+  if (value === undefined) environmentData.delete(key);
+  else environmentData.set(key, value);
+}
+
+function getEnvironmentData(key) {
+  return environmentData.get(key);
+}
+
+class BroadcastChannel {
+  constructor() {
+    throwNotImplemented("worker_threads.BroadcastChannel");
+  }
+}
+
+const resourceLimits = {};
+
+const defaultObject = {
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  resourceLimits,
+  SHARE_ENV,
+  Worker,
+  MessageChannel,
+  MessagePort,
+  BroadcastChannel,
+  receiveMessageOnPort,
+  markAsUntransferable,
+  moveMessagePortToContext,
+  setEnvironmentData,
+  getEnvironmentData,
+  [Symbol.for("CommonJS")]: 0,
+};
+
+export {
+  defaultObject as default,
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  resourceLimits,
+  SHARE_ENV,
+  Worker,
+  MessageChannel,
+  MessagePort,
+  BroadcastChannel,
+  receiveMessageOnPort,
+  markAsUntransferable,
+  moveMessagePortToContext,
+  setEnvironmentData,
+  getEnvironmentData,
+};
+
+hideFromStack(receiveMessageOnPort, moveMessagePortToContext);
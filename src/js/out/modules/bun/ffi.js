@@ -1,109 +1,21 @@
-var cstringReturnType = function(val) {
-  return new __GlobalBunCString(val);
-}, FFIBuilder = function(params, returnType, functionToCall, name) {
-  const hasReturnType = typeof FFIType[returnType] === "number" && FFIType[returnType] !== FFIType.void;
-  var paramNames = new Array(params.length), args = new Array(params.length);
-  for (let i = 0;i < params.length; i++) {
-    paramNames[i] = `p${i}`;
-    const wrapper = ffiWrappers[FFIType[params[i]]];
-    if (wrapper)
-      args[i] = `(${wrapper.toString()})(p${i})`;
-    else
-      throw new TypeError(`Unsupported type ${params[i]}. Must be one of: ${Object.keys(FFIType).sort().join(", ")}`);
-  }
-  var code = `functionToCall(${args.join(", ")})`;
-  if (hasReturnType)
-    if (FFIType[returnType] === FFIType.cstring)
-      code = `return (${cstringReturnType.toString()})(${code})`;
-    else
-      code = `return ${code}`;
-  var func = new Function("functionToCall", ...paramNames, code);
-  Object.defineProperty(func, "name", {
-    value: name
-  });
-  var wrap;
-  switch (paramNames.length) {
-    case 0:
-      wrap = () => func(functionToCall);
-      break;
-    case 1:
-      wrap = (arg1) => func(functionToCall, arg1);
-      break;
-    case 2:
-      wrap = (arg1, arg2) => func(functionToCall, arg1, arg2);
-      break;
-    case 3:
-      wrap = (arg1, arg2, arg3) => func(functionToCall, arg1, arg2, arg3);
-      break;
-    case 4:
-      wrap = (arg1, arg2, arg3, arg4) => func(functionToCall, arg1, arg2, arg3, arg4);
-      break;
-    case 5:
-      wrap = (arg1, arg2, arg3, arg4, arg5) => func(functionToCall, arg1, arg2, arg3, arg4, arg5);
-      break;
-    case 6:
-      wrap = (arg1, arg2, arg3, arg4, arg5, arg6) => func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6);
-      break;
-    case 7:
-      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7) => func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
-      break;
-    case 8:
-      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8) => func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
-      break;
-    case 9:
-      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9) => func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
-      break;
-    default: {
-      wrap = (...args2) => func(functionToCall, ...args2);
-      break;
-    }
-  }
-  return wrap.native = functionToCall, wrap.ptr = functionToCall.ptr, wrap;
-};
-function dlopen(path, options) {
-  const result = nativeDLOpen(path, options);
-  for (let key in result.symbols) {
-    var symbol = result.symbols[key];
-    if (options[key]?.args?.length || FFIType[options[key]?.returns] === FFIType.cstring)
-      result.symbols[key] = FFIBuilder(options[key].args ?? [], options[key].returns ?? FFIType.void, symbol, path.includes("/") ? `${key} (${path.split("/").pop()})` : `${key} (${path})`);
-    else
-      result.symbols[key].native = result.symbols[key];
-  }
-  return result;
-}
-function linkSymbols(options) {
-  const result = nativeLinkSymbols(options);
-  for (let key in result.symbols) {
-    var symbol = result.symbols[key];
-    if (options[key]?.args?.length || FFIType[options[key]?.returns] === FFIType.cstring)
-      result.symbols[key] = FFIBuilder(options[key].args ?? [], options[key].returns ?? FFIType.void, symbol, key);
-    else
-      result.symbols[key].native = result.symbols[key];
-  }
-  return result;
-}
-var onCloseCFunction = function(close) {
-  close();
-};
-function CFunction(options) {
-  const identifier = `CFunction${cFunctionI++}`;
-  var result = linkSymbols({
-    [identifier]: options
-  }), hasClosed = !1, close = result.close;
-  return result.symbols[identifier].close = () => {
-    if (hasClosed || !close)
-      return;
-    hasClosed = !0, close(), close = void 0;
-  }, cFunctionRegistry ||= new FinalizationRegistry(onCloseCFunction), cFunctionRegistry.register(result.symbols[identifier], result.symbols[identifier].close), result.symbols[identifier];
-}
-var ffi = globalThis.Bun.FFI, ptr = (arg1, arg2) => typeof arg2 === "undefined" ? ffi.ptr(arg1) : ffi.ptr(arg1, arg2), toBuffer = ffi.toBuffer, toArrayBuffer = ffi.toArrayBuffer, viewSource = ffi.viewSource, BunCString = ffi.CString, nativeLinkSymbols = ffi.linkSymbols, nativeDLOpen = ffi.dlopen, nativeCallback = ffi.callback, closeCallback = ffi.closeCallback;
+var ffi = globalThis.Bun.FFI;
+var ptr = (arg1, arg2) => (typeof arg2 === "undefined" ? ffi.ptr(arg1) : ffi.ptr(arg1, arg2));
+var toBuffer = ffi.toBuffer;
+var toArrayBuffer = ffi.toArrayBuffer;
+var viewSource = ffi.viewSource;
+var BunCString = ffi.CString;
+var nativeLinkSymbols = ffi.linkSymbols;
+var nativeDLOpen = ffi.dlopen;
+var nativeCallback = ffi.callback;
+var closeCallback = ffi.closeCallback;
 delete ffi.callback;
 delete ffi.closeCallback;
-
 class JSCallback {
   constructor(cb, options) {
-    const { ctx, ptr: ptr2 } = nativeCallback(options, cb);
-    this.#ctx = ctx, this.ptr = ptr2, this.#threadsafe = !!options?.threadsafe;
+    const { ctx, ptr } = nativeCallback(options, structCallback(cb, options?.args));
+    this.#ctx = ctx;
+    this.ptr = ptr;
+    this.#threadsafe = !!options?.threadsafe;
   }
   ptr;
   #ctx;
@@ -112,34 +24,47 @@ class JSCallback {
     return this.#threadsafe;
   }
   [Symbol.toPrimitive]() {
-    const { ptr: ptr2 } = this;
-    return typeof ptr2 === "number" ? ptr2 : 0;
+    const { ptr } = this;
+    return typeof ptr === "number" ? ptr : 0;
   }
   close() {
     const ctx = this.#ctx;
-    if (this.ptr = null, this.#ctx = null, ctx)
+    this.ptr = null;
+    this.#ctx = null;
+    if (ctx) {
       closeCallback(ctx);
+    }
   }
 }
-
 class CString extends String {
-  constructor(ptr2, byteOffset, byteLength) {
-    super(ptr2 ? typeof byteLength === "number" && Number.isSafeInteger(byteLength) ? new BunCString(ptr2, byteOffset || 0, byteLength) : new BunCString(ptr2) : "");
-    if (this.ptr = typeof ptr2 === "number" ? ptr2 : 0, typeof byteOffset !== "undefined")
+  constructor(ptr, byteOffset, byteLength) {
+    super(
+      ptr
+        ? typeof byteLength === "number" && Number.isSafeInteger(byteLength)
+          ? new BunCString(ptr, byteOffset || 0, byteLength)
+          : new BunCString(ptr)
+        : ""
+    );
+    this.ptr = typeof ptr === "number" ? ptr : 0;
+    if (typeof byteOffset !== "undefined") {
       this.byteOffset = byteOffset;
-    if (typeof byteLength !== "undefined")
+    }
+    if (typeof byteLength !== "undefined") {
       this.byteLength = byteLength;
+    }
   }
   ptr;
   byteOffset;
   byteLength;
   #cachedArrayBuffer;
   get arrayBuffer() {
-    if (this.#cachedArrayBuffer)
+    if (this.#cachedArrayBuffer) {
       return this.#cachedArrayBuffer;
-    if (!this.ptr)
-      return this.#cachedArrayBuffer = new ArrayBuffer(0);
-    return this.#cachedArrayBuffer = toArrayBuffer(this.ptr, this.byteOffset, this.byteLength);
+    }
+    if (!this.ptr) {
+      return (this.#cachedArrayBuffer = new ArrayBuffer(0));
+    }
+    return (this.#cachedArrayBuffer = toArrayBuffer(this.ptr, this.byteOffset, this.byteLength));
   }
 }
 Object.defineProperty(globalThis, "__GlobalBunCString", {
@@ -147,7 +72,8 @@ Object.defineProperty(globalThis, "__GlobalBunCString", {
   enumerable: !1,
   configurable: !1
 });
-var ffiWrappers = new Array(18), char = (val) => val | 0;
+var ffiWrappers = new Array(18);
+var char = val => val | 0;
 ffiWrappers.fill(char);
 ffiWrappers[FFIType.uint8_t] = function uint8(val) {
   return val < 0 ? 0 : val >= 255 ? 255 : val | 0;
@@ -162,57 +88,64 @@ ffiWrappers[FFIType.int32_t] = function int32(val) {
   return val | 0;
 };
 ffiWrappers[FFIType.uint32_t] = function uint32(val) {
-  return val <= 0 ? 0 : val >= 4294967295 ? 4294967295 : +val || 0;
+  return val <= 0 ? 0 : val >= 0xffffffff ? 0xffffffff : +val || 0;
 };
 ffiWrappers[FFIType.i64_fast] = function int64(val) {
   if (typeof val === "bigint") {
-    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= BigInt(-Number.MAX_SAFE_INTEGER))
+    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= BigInt(-Number.MAX_SAFE_INTEGER)) {
       return Number(val).valueOf() || 0;
+    }
     return val;
   }
   return !val ? 0 : +val || 0;
 };
 ffiWrappers[FFIType.u64_fast] = function u64_fast(val) {
   if (typeof val === "bigint") {
-    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= 0)
+    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= 0) {
       return Number(val).valueOf() || 0;
+    }
     return val;
   }
   return !val ? 0 : +val || 0;
 };
-ffiWrappers[FFIType.int64_t] = function int642(val) {
-  if (typeof val === "bigint")
+ffiWrappers[FFIType.int64_t] = function int64(val) {
+  if (typeof val === "bigint") {
     return val;
-  if (typeof val === "number")
+  }
+  if (typeof val === "number") {
     return BigInt(val || 0);
+  }
   return BigInt(+val || 0);
 };
 ffiWrappers[FFIType.uint64_t] = function uint64(val) {
-  if (typeof val === "bigint")
+  if (typeof val === "bigint") {
     return val;
-  if (typeof val === "number")
+  }
+  if (typeof val === "number") {
     return val <= 0 ? BigInt(0) : BigInt(val || 0);
+  }
   return BigInt(+val || 0);
 };
-ffiWrappers[FFIType.u64_fast] = function u64_fast2(val) {
+ffiWrappers[FFIType.u64_fast] = function u64_fast(val) {
   if (typeof val === "bigint") {
-    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= BigInt(0))
-      return Number(val);
+    if (val <= BigInt(Number.MAX_SAFE_INTEGER) && val >= BigInt(0)) return Number(val);
     return val;
   }
-  return typeof val === "number" ? val <= 0 ? 0 : +val || 0 : +val || 0;
+  return typeof val === "number" ? (val <= 0 ? 0 : +val || 0) : +val || 0;
 };
-ffiWrappers[FFIType.uint16_t] = function uint162(val) {
+ffiWrappers[FFIType.uint16_t] = function uint16(val) {
   const ret = (typeof val === "bigint" ? Number(val) : val) | 0;
-  return ret <= 0 ? 0 : ret > 65535 ? 65535 : ret;
+  return ret <= 0 ? 0 : ret > 0xffff ? 0xffff : ret;
 };
 ffiWrappers[FFIType.double] = function double(val) {
   if (typeof val === "bigint") {
-    if (val.valueOf() < BigInt(Number.MAX_VALUE))
+    if (val.valueOf() < BigInt(Number.MAX_VALUE)) {
       return Math.abs(Number(val).valueOf()) + 0.00000000000001 - 0.00000000000001;
+    }
+  }
+  if (!val) {
+    return 0 + 0.00000000000001 - 0.00000000000001;
   }
-  if (!val)
-    return 0;
   return val + 0.00000000000001 - 0.00000000000001;
 };
 ffiWrappers[FFIType.float] = ffiWrappers[10] = function float(val) {
@@ -227,42 +160,442 @@ Object.defineProperty(globalThis, "__GlobalBunFFIPtrFunctionForWrapper", {
   configurable: !0
 });
 ffiWrappers[FFIType.cstring] = ffiWrappers[FFIType.pointer] = function pointer(val) {
-  if (typeof val === "number")
-    return val;
-  if (!val)
+  if (typeof val === "number") return val;
+  if (!val) {
     return null;
-  if (ArrayBuffer.isView(val) || val instanceof ArrayBuffer)
+  }
+  if (ArrayBuffer.isView(val) || val instanceof ArrayBuffer) {
     return __GlobalBunFFIPtrFunctionForWrapper(val);
-  if (typeof val === "string")
+  }
+  if (typeof val === "string") {
     throw new TypeError("To convert a string to a pointer, encode it as a buffer");
+  }
   throw new TypeError(`Unable to convert ${val} to a pointer`);
 };
+function cstringReturnType(val) {
+  return new __GlobalBunCString(val);
+}
 ffiWrappers[FFIType.function] = function functionType(val) {
-  if (typeof val === "number")
+  if (typeof val === "number") {
     return val;
-  if (typeof val === "bigint")
+  }
+  if (typeof val === "bigint") {
     return Number(val);
-  var ptr2 = val && val.ptr;
-  if (!ptr2)
+  }
+  var ptr = val && val.ptr;
+  if (!ptr) {
     throw new TypeError("Expected function to be a JSCallback or a number");
-  return ptr2;
+  }
+  return ptr;
 };
+var structTypes = new WeakSet();
+var structScalarSizes = new Array(18).fill(8);
+structScalarSizes[FFIType.char] = 1;
+structScalarSizes[FFIType.int8_t] = 1;
+structScalarSizes[FFIType.uint8_t] = 1;
+structScalarSizes[FFIType.bool] = 1;
+structScalarSizes[FFIType.int16_t] = 2;
+structScalarSizes[FFIType.uint16_t] = 2;
+structScalarSizes[FFIType.int32_t] = 4;
+structScalarSizes[FFIType.uint32_t] = 4;
+structScalarSizes[FFIType.float] = 4;
+function isStructType(type) {
+  return typeof type === "function" && structTypes.has(type);
+}
+function structGetterSource(type, offset) {
+  switch (type) {
+    case FFIType.char:
+    case FFIType.int8_t:
+      return `return this.view.getInt8(${offset});`;
+    case FFIType.uint8_t:
+      return `return this.view.getUint8(${offset});`;
+    case FFIType.bool:
+      return `return this.view.getUint8(${offset}) !== 0;`;
+    case FFIType.int16_t:
+      return `return this.view.getInt16(${offset}, true);`;
+    case FFIType.uint16_t:
+      return `return this.view.getUint16(${offset}, true);`;
+    case FFIType.int32_t:
+      return `return this.view.getInt32(${offset}, true);`;
+    case FFIType.uint32_t:
+      return `return this.view.getUint32(${offset}, true);`;
+    case FFIType.float:
+      return `return this.view.getFloat32(${offset}, true);`;
+    case FFIType.double:
+      return `return this.view.getFloat64(${offset}, true);`;
+    case FFIType.int64_t:
+      return `return this.view.getBigInt64(${offset}, true);`;
+    case FFIType.uint64_t:
+      return `return this.view.getBigUint64(${offset}, true);`;
+    case FFIType.i64_fast:
+      return `const value = this.view.getBigInt64(${offset}, true);
+return value >= BigInt(Number.MIN_SAFE_INTEGER) && value <= BigInt(Number.MAX_SAFE_INTEGER) ? Number(value) : value;`;
+    case FFIType.u64_fast:
+      return `const value = this.view.getBigUint64(${offset}, true);
+return value <= BigInt(Number.MAX_SAFE_INTEGER) ? Number(value) : value;`;
+    default:
+      return `return Number(this.view.getBigUint64(${offset}, true));`;
+  }
+}
+function structSetterSource(type, offset) {
+  switch (type) {
+    case FFIType.char:
+    case FFIType.int8_t:
+      return `this.view.setInt8(${offset}, value);`;
+    case FFIType.uint8_t:
+      return `this.view.setUint8(${offset}, value);`;
+    case FFIType.bool:
+      return `this.view.setUint8(${offset}, value ? 1 : 0);`;
+    case FFIType.int16_t:
+      return `this.view.setInt16(${offset}, value, true);`;
+    case FFIType.uint16_t:
+      return `this.view.setUint16(${offset}, value, true);`;
+    case FFIType.int32_t:
+      return `this.view.setInt32(${offset}, value, true);`;
+    case FFIType.uint32_t:
+      return `this.view.setUint32(${offset}, value, true);`;
+    case FFIType.float:
+      return `this.view.setFloat32(${offset}, value, true);`;
+    case FFIType.double:
+      return `this.view.setFloat64(${offset}, value, true);`;
+    case FFIType.int64_t:
+    case FFIType.i64_fast:
+      return `this.view.setBigInt64(${offset}, BigInt(value), true);`;
+    case FFIType.uint64_t:
+    case FFIType.u64_fast:
+      return `this.view.setBigUint64(${offset}, BigInt(value), true);`;
+    default:
+      return `this.view.setBigUint64(${offset}, BigInt(value == null ? 0 : typeof value === "number" || typeof value === "bigint" ? value : value.ptr), true);`;
+  }
+}
+function defineStructField(prototype, { name, type, offset }) {
+  var get, set;
+  if (isStructType(type)) {
+    get = function () {
+      return new type(this.view.buffer, this.view.byteOffset + offset);
+    };
+    set = function (value) {
+      const target = new type(this.view.buffer, this.view.byteOffset + offset);
+      if (value instanceof type) {
+        new Uint8Array(target.view.buffer, target.view.byteOffset, type.byteLength).set(
+          new Uint8Array(value.view.buffer, value.view.byteOffset, type.byteLength)
+        );
+      } else {
+        assignStructFields(target, value);
+      }
+    };
+  } else {
+    get = new Function(structGetterSource(type, offset));
+    set = new Function("value", structSetterSource(type, offset));
+  }
+  Object.defineProperty(get, "name", { value: `get ${name}` });
+  Object.defineProperty(set, "name", { value: `set ${name}` });
+  Object.defineProperty(prototype, name, { get, set, enumerable: !0, configurable: !1 });
+}
+function assignStructFields(target, values) {
+  for (const { name } of target.constructor.fields) {
+    if (name in values) target[name] = values[name];
+  }
+}
+function struct(definition) {
+  if (!definition || typeof definition !== "object") {
+    throw new TypeError("Expected an object mapping field names to types");
+  }
+  const fields = [];
+  var offset = 0;
+  var alignment = 1;
+  for (const name of Object.keys(definition)) {
+    if (name === "view" || name === "toJSON") {
+      throw new TypeError(`"${name}" can't be used as a struct field name`);
+    }
+    const value = definition[name];
+    const type = isStructType(value) ? value : FFIType[value];
+    if (!isStructType(type) && (typeof type !== "number" || type === FFIType.void)) {
+      throw new TypeError(`Unsupported type ${value} for struct field "${name}"`);
+    }
+    const size = isStructType(type) ? type.byteLength : structScalarSizes[type];
+    const fieldAlignment = isStructType(type) ? type.alignment : size;
+    offset = Math.ceil(offset / fieldAlignment) * fieldAlignment;
+    fields.push(Object.freeze({ name, type, offset }));
+    offset += size;
+    alignment = Math.max(alignment, fieldAlignment);
+  }
+  if (fields.length === 0) {
+    throw new TypeError("Structs must have at least one field");
+  }
+  const byteLength = Math.ceil(offset / alignment) * alignment;
+  class Struct {
+    view;
+    constructor(buffer, byteOffset = 0) {
+      if (buffer instanceof ArrayBuffer || buffer instanceof SharedArrayBuffer) {
+        this.view = new DataView(buffer, byteOffset, byteLength);
+      } else if (ArrayBuffer.isView(buffer)) {
+        this.view = new DataView(buffer.buffer, buffer.byteOffset + byteOffset, byteLength);
+      } else {
+        this.view = new DataView(new ArrayBuffer(byteLength));
+        if (buffer != null) assignStructFields(this, buffer);
+      }
+    }
+    static get byteLength() {
+      return byteLength;
+    }
+    static get alignment() {
+      return alignment;
+    }
+    static get fields() {
+      return fields;
+    }
+    toJSON() {
+      const result = {};
+      for (const { name, type } of fields) {
+        result[name] = isStructType(type) ? this[name].toJSON() : this[name];
+      }
+      return result;
+    }
+  }
+  Object.freeze(fields);
+  for (const field of fields) {
+    defineStructField(Struct.prototype, field);
+  }
+  structTypes.add(Struct);
+  return Struct;
+}
+function structArgument(type, value, slot) {
+  if (typeof value === "number") {
+    return value;
+  }
+  var source;
+  if (value instanceof type) {
+    source = new Uint8Array(value.view.buffer, value.view.byteOffset, type.byteLength);
+  } else if (ArrayBuffer.isView(value) || value instanceof ArrayBuffer) {
+    if (value.byteLength < type.byteLength) {
+      throw new RangeError(`Expected at least ${type.byteLength} bytes for a struct, got ${value.byteLength}`);
+    }
+    source = ArrayBuffer.isView(value)
+      ? new Uint8Array(value.buffer, value.byteOffset, type.byteLength)
+      : new Uint8Array(value, 0, type.byteLength);
+  } else if (value && typeof value === "object") {
+    slot.bytes.fill(0);
+    assignStructFields(slot.value, value);
+    return slot.address;
+  } else {
+    throw new TypeError(`Unable to convert ${value} to a struct`);
+  }
+  slot.bytes.set(source);
+  return slot.address;
+}
+function createStructSlots(params) {
+  var slots = new Array(params.length);
+  var offsets = new Array(params.length);
+  var byteLength = 0;
+  for (let i = 0; i < params.length; i++) {
+    const type = params[i];
+    if (!isStructType(type)) continue;
+    byteLength = Math.ceil(byteLength / type.alignment) * type.alignment;
+    offsets[i] = byteLength;
+    byteLength += type.byteLength;
+  }
+  if (byteLength === 0) {
+    return slots;
+  }
+  const buffer = new ArrayBuffer(byteLength);
+  const address = ptr(buffer);
+  for (let i = 0; i < params.length; i++) {
+    const type = params[i];
+    if (!isStructType(type)) continue;
+    slots[i] = {
+      value: new type(buffer, offsets[i]),
+      bytes: new Uint8Array(buffer, offsets[i], type.byteLength),
+      address: address + offsets[i]
+    };
+  }
+  return slots;
+}
+function structCallback(cb, params) {
+  if (typeof cb !== "function" || !params?.some?.(isStructType)) {
+    return cb;
+  }
+  return function (...args) {
+    for (let i = 0; i < params.length; i++) {
+      const type = params[i];
+      if (isStructType(type)) {
+        args[i] = new type(toArrayBuffer(args[i], 0, type.byteLength).slice(0));
+      }
+    }
+    return cb.apply(this, args);
+  };
+}
+function FFIBuilder(params, returnType, functionToCall, name, symbols) {
+  const returnsStruct = isStructType(returnType);
+  const hasReturnType =
+    !returnsStruct && typeof FFIType[returnType] === "number" && FFIType[returnType] !== FFIType.void;
+  var paramNames = new Array(params.length);
+  var args = new Array(params.length);
+  var structs = new Array(params.length + 1);
+  for (let i = 0; i < params.length; i++) {
+    paramNames[i] = `p${i}`;
+    if (isStructType(params[i])) {
+      structs[i] = params[i];
+      args[i] = `structArgument(structs[${i}], p${i}, slots[${i}])`;
+      continue;
+    }
+    const wrapper = ffiWrappers[FFIType[params[i]]];
+    if (wrapper) {
+      args[i] = `(${wrapper.toString()})(p${i})`;
+    } else {
+      throw new TypeError(`Unsupported type ${params[i]}. Must be one of: ${Object.keys(FFIType).sort().join(", ")}`);
+    }
+  }
+  var code = `functionToCall.call(${["symbols", ...args].join(", ")})`;
+  if (returnsStruct) {
+    structs[params.length] = returnType;
+    args.push("ptr(result.view)");
+    code = `const result = new structs[${params.length}](); functionToCall.call(${["symbols", ...args].join(", ")}); return result`;
+  } else if (hasReturnType) {
+    if (FFIType[returnType] === FFIType.cstring) {
+      code = `return (${cstringReturnType.toString()})(${code})`;
+    } else {
+      code = `return ${code}`;
+    }
+  }
+  var func = new Function(
+    "structArgument",
+    "structs",
+    "slots",
+    "ptr",
+    "symbols",
+    `return function (functionToCall, ${paramNames.join(", ")}) { ${code} }`
+  )(structArgument, structs, createStructSlots(params), ptr, symbols);
+  Object.defineProperty(func, "name", {
+    value: name
+  });
+  var wrap;
+  switch (paramNames.length) {
+    case 0:
+      wrap = () => func(functionToCall);
+      break;
+    case 1:
+      wrap = arg1 => func(functionToCall, arg1);
+      break;
+    case 2:
+      wrap = (arg1, arg2) => func(functionToCall, arg1, arg2);
+      break;
+    case 3:
+      wrap = (arg1, arg2, arg3) => func(functionToCall, arg1, arg2, arg3);
+      break;
+    case 4:
+      wrap = (arg1, arg2, arg3, arg4) => func(functionToCall, arg1, arg2, arg3, arg4);
+      break;
+    case 5:
+      wrap = (arg1, arg2, arg3, arg4, arg5) => func(functionToCall, arg1, arg2, arg3, arg4, arg5);
+      break;
+    case 6:
+      wrap = (arg1, arg2, arg3, arg4, arg5, arg6) => func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6);
+      break;
+    case 7:
+      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7) =>
+        func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+      break;
+    case 8:
+      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8) =>
+        func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+      break;
+    case 9:
+      wrap = (arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9) =>
+        func(functionToCall, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+      break;
+    default: {
+      wrap = (...args) => func(functionToCall, ...args);
+      break;
+    }
+  }
+  wrap.native = functionToCall;
+  wrap.ptr = functionToCall.ptr;
+  return wrap;
+}
 var native = {
   dlopen: nativeDLOpen,
   callback: () => {
     throw new Error("Deprecated. Use new JSCallback(options, fn) instead");
   }
-}, cFunctionI = 0, cFunctionRegistry, read = ffi.read;
+};
+function needsFFIBuilder(definition) {
+  return (
+    definition?.args?.length ||
+    FFIType[definition?.returns] === FFIType.cstring ||
+    isStructType(definition?.returns)
+  );
+}
+function dlopen(path, options) {
+  const result = nativeDLOpen(path, options);
+  for (let key in result.symbols) {
+    var symbol = result.symbols[key];
+    if (needsFFIBuilder(options[key])) {
+      result.symbols[key] = FFIBuilder(
+        options[key].args ?? [],
+        options[key].returns ?? FFIType.void,
+        symbol,
+        path.includes("/") ? `${key} (${path.split("/").pop()})` : `${key} (${path})`,
+        result.symbols
+      );
+    } else {
+      result.symbols[key].native = result.symbols[key];
+    }
+  }
+  return result;
+}
+function linkSymbols(options) {
+  const result = nativeLinkSymbols(options);
+  for (let key in result.symbols) {
+    var symbol = result.symbols[key];
+    if (needsFFIBuilder(options[key])) {
+      result.symbols[key] = FFIBuilder(
+        options[key].args ?? [],
+        options[key].returns ?? FFIType.void,
+        symbol,
+        key,
+        result.symbols
+      );
+    } else {
+      result.symbols[key].native = result.symbols[key];
+    }
+  }
+  return result;
+}
+var cFunctionI = 0;
+var cFunctionRegistry;
+function onCloseCFunction(close) {
+  close();
+}
+function CFunction(options) {
+  const identifier = `CFunction${cFunctionI++}`;
+  var result = linkSymbols({
+    [identifier]: options
+  });
+  var hasClosed = !1;
+  var close = result.close;
+  result.symbols[identifier].close = () => {
+    if (hasClosed || !close) return;
+    hasClosed = !0;
+    close();
+    close = void 0;
+  };
+  cFunctionRegistry ||= new FinalizationRegistry(onCloseCFunction);
+  cFunctionRegistry.register(result.symbols[identifier], result.symbols[identifier].close);
+  return result.symbols[identifier];
+}
+var read = ffi.read;
 export {
-  viewSource,
+  ptr,
   toBuffer,
   toArrayBuffer,
-  read,
-  ptr,
-  native,
-  linkSymbols,
-  dlopen,
+  viewSource,
   JSCallback,
   CString,
-  CFunction
+  struct,
+  native,
+  dlopen,
+  linkSymbols,
+  CFunction,
+  read
 };
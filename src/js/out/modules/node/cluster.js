@@ -1,4 +1,7 @@
 import EventEmitter from "node:events";
+import {tmpdir} from "node:os";
+import {join} from "node:path";
+import {unlinkSync} from "node:fs";
 
 // src/js/shared.ts
 function throwNotImplemented(feature, issue) {
@@ -20,44 +23,450 @@ class NotImplementedError extends Error {
 }
 
 // src/js/node/cluster.ts
-var SCHED_NONE = 0, SCHED_RR = 1, Worker, schedulingPolicy = 2, isWorker = !1, isPrimary = !0, isMaster = !0, cluster;
-Worker = function Worker2() {
-  throwNotImplemented("node:cluster Worker", 2428);
+var { Bun } = globalThis[Symbol.for("Bun.lazy")]("primordials");
+var IPC_PATH_ENV = "BUN_CLUSTER_IPC_PATH";
+var INTERNAL = "NODE_CLUSTER";
+var workerId = process.env.NODE_UNIQUE_ID;
+var workerIpcPath = process.env[IPC_PATH_ENV];
+var SCHED_NONE = 1,
+  SCHED_RR = 2,
+  isWorker = workerId !== void 0 && workerIpcPath !== void 0,
+  isPrimary = !isWorker,
+  isMaster = isPrimary,
+  Worker,
+  cluster;
+function policyFromEnvironment() {
+  switch (process.env.NODE_CLUSTER_SCHED_POLICY) {
+    case "rr":
+      return SCHED_RR;
+    default:
+      return SCHED_NONE;
+  }
+}
+function validateSchedulingPolicy(policy) {
+  if (policy === SCHED_RR) throwNotImplemented("cluster.SCHED_RR");
+  if (policy !== SCHED_NONE) {
+    const error = new TypeError(`Invalid cluster.schedulingPolicy: ${policy}`);
+    error.code = "ERR_INVALID_ARG_VALUE";
+    throw error;
+  }
+}
+class Channel {
+  socket = null;
+  onMessage = null;
+  onClose = null;
+  #decoder = new TextDecoder();
+  #incoming = "";
+  #outgoing = [];
+  #ending = !1;
+  #closed = !1;
+  attach(socket) {
+    this.socket = socket;
+    this.flush();
+  }
+  get connected() {
+    return !this.#closed;
+  }
+  send(message) {
+    if (this.#closed) return !1;
+    this.#outgoing.push(Buffer.from(JSON.stringify(message) + "\n"));
+    this.flush();
+    return !0;
+  }
+  flush() {
+    const socket = this.socket;
+    if (!socket) return;
+    while (this.#outgoing.length > 0) {
+      const chunk = this.#outgoing[0];
+      const written = socket.write(chunk);
+      if (written < chunk.length) {
+        if (written > 0) this.#outgoing[0] = chunk.subarray(written);
+        return;
+      }
+      this.#outgoing.shift();
+    }
+  }
+  receive(data) {
+    const lines = (this.#incoming + this.#decoder.decode(data, { stream: !0 })).split("\n");
+    this.#incoming = lines.pop();
+    for (const line of lines) {
+      if (line.length === 0) continue;
+      let message;
+      try {
+        message = JSON.parse(line);
+      } catch {
+        continue;
+      }
+      this.onMessage?.(message);
+    }
+  }
+  end() {
+    if (this.#closed) return;
+    if (this.#outgoing.length > 0 && this.socket) {
+      this.#ending = !0;
+      return;
+    }
+    this.socket?.end();
+  }
+  drained() {
+    this.flush();
+    if (this.#ending && this.#outgoing.length === 0) this.socket.end();
+  }
+  closed() {
+    if (this.#closed) return;
+    this.#closed = !0;
+    this.#outgoing.length = 0;
+    this.onClose?.();
+  }
+}
+var channelHandlers = {
+  data(socket, data) {
+    socket.data.receive(data);
+  },
+  drain(socket) {
+    socket.data.drained();
+  },
+  close(socket) {
+    socket.data.closed();
+  },
+  error(socket) {
+    socket.data.closed();
+  }
 };
-
-class Cluster extends EventEmitter {
-  constructor() {
-    super(...arguments);
+function isInternal(message) {
+  return message !== null && typeof message === "object" && message.cmd === INTERNAL;
+}
+function addressType(address) {
+  if (typeof address === "string" && address.includes(":")) return 6;
+  return 4;
+}
+Worker = class Worker extends EventEmitter {
+  id;
+  process;
+  state = "none";
+  exitedAfterDisconnect = void 0;
+  #channel;
+  constructor(options = {}) {
+    super();
+    this.id = options.id | 0;
+    this.process = options.process;
+    this.#channel = options.channel ?? null;
+    if (options.state) this.state = options.state;
+  }
+  get suicide() {
+    return this.exitedAfterDisconnect;
   }
-  static isWorker = !1;
-  static isPrimary = !0;
-  static isMaster = !0;
-  static Worker = Worker;
-  fork() {
-    throwNotImplemented("node:cluster", 2428);
+  set suicide(value) {
+    this.exitedAfterDisconnect = value;
+  }
+  send(message, handle, options, callback) {
+    if (typeof handle === "function") callback = handle;
+    else if (typeof options === "function") callback = options;
+    const sent = this.#channel ? this.#channel.send(message) : !1;
+    if (typeof callback === "function") {
+      process.nextTick(callback, sent ? null : channelClosedError());
+    }
+    return sent;
   }
   disconnect() {
-    throwNotImplemented("node:cluster", 2428);
+    if (isPrimary) {
+      this.exitedAfterDisconnect = !0;
+      if (this.isConnected()) this._sendInternal({ act: "disconnect" });
+    } else {
+      disconnectWorker(this, !0);
+    }
+    return this;
+  }
+  kill(signal = "SIGTERM") {
+    if (!isPrimary) {
+      if (!this.isConnected()) process.exit(0);
+      this.once("disconnect", () => process.exit(0));
+      disconnectWorker(this, !0);
+      return;
+    }
+    this.exitedAfterDisconnect = !0;
+    if (this.isConnected()) {
+      this.once("disconnect", () => this.process.kill(signal));
+      this._sendInternal({ act: "disconnect" });
+      return;
+    }
+    this.process.kill(signal);
+  }
+  destroy(signal) {
+    this.kill(signal);
+  }
+  isConnected() {
+    return !!this.#channel && this.#channel.connected;
   }
-  setupMaster() {
-    throwNotImplemented("node:cluster", 2428);
+  isDead() {
+    return this.state === "dead";
   }
+  _setChannel(channel) {
+    this.#channel = channel;
+  }
+  _sendInternal(message) {
+    return this.#channel ? this.#channel.send({ ...message, cmd: INTERNAL }) : !1;
+  }
+  _closeChannel() {
+    this.#channel?.end();
+  }
+};
+function channelClosedError() {
+  const error = new Error("Channel closed");
+  error.code = "ERR_IPC_CHANNEL_CLOSED";
+  return error;
+}
+class Cluster extends EventEmitter {
+  isWorker = isWorker;
+  isPrimary = isPrimary;
+  isMaster = isMaster;
+  Worker = Worker;
+  worker = void 0;
+  workers = isPrimary ? {} : void 0;
   settings = {};
-  workers = {};
-  SCHED_NONE = 0;
-  SCHED_RR = 1;
-  schedulingPolicy = 2;
+  SCHED_NONE = SCHED_NONE;
+  SCHED_RR = SCHED_RR;
+  schedulingPolicy = policyFromEnvironment();
   [Symbol.for("CommonJS")] = 0;
+  setupPrimary(settings) {
+    setupPrimary(this, settings);
+  }
+  setupMaster(settings) {
+    setupPrimary(this, settings);
+  }
+  fork(env) {
+    if (!isPrimary) throw new Error("cluster.fork() can only be called from the primary");
+    return forkWorker(this, env);
+  }
+  disconnect(callback) {
+    if (isPrimary) {
+      disconnectAll(this, callback);
+    } else {
+      this.worker.disconnect();
+      if (typeof callback === "function") process.nextTick(callback);
+    }
+  }
+  _onServerListening(server, address) {
+    if (isWorker) workerServerListening(server, address);
+  }
+}
+cluster = new Cluster();
+var ipcServer = null;
+var ipcPath = "";
+var nextWorkerId = 0;
+function setupPrimary(self, settings) {
+  if (!isPrimary) throw new Error("cluster.setupPrimary() can only be called from the primary");
+  self.settings = {
+    args: process.argv.slice(2),
+    exec: process.argv[1],
+    execArgv: process.execArgv,
+    silent: !1,
+    ...self.settings,
+    ...settings
+  };
+  if (settings?.schedulingPolicy !== void 0) self.schedulingPolicy = settings.schedulingPolicy;
+  validateSchedulingPolicy(self.schedulingPolicy);
+  self.settings.schedulingPolicy = self.schedulingPolicy;
+  process.nextTick(() => self.emit("setup", self.settings));
+}
+function listenForWorkers() {
+  if (ipcServer) return;
+  ipcPath = join(tmpdir(), `bun-cluster-${process.pid}-${Math.random().toString(36).slice(2)}.sock`);
+  ipcServer = Bun.listen({
+    unix: ipcPath,
+    socket: {
+      ...channelHandlers,
+      open(socket) {
+        const channel = new Channel();
+        channel.onMessage = message => onWorkerHandshake(channel, message);
+        socket.data = channel;
+        socket.unref();
+        channel.attach(socket);
+      }
+    }
+  });
+  ipcServer.unref();
+  process.once("exit", () => {
+    try {
+      unlinkSync(ipcPath);
+    } catch {}
+  });
+}
+function onWorkerHandshake(channel, message) {
+  if (!isInternal(message) || message.act !== "online") return;
+  const worker = cluster.workers[message.id];
+  if (!worker || worker.state === "dead") {
+    channel.end();
+    return;
+  }
+  worker._setChannel(channel);
+  channel.onMessage = message => onWorkerMessage(worker, message);
+  channel.onClose = () => onWorkerDisconnect(worker);
+  worker.state = "online";
+  worker.emit("online");
+  cluster.emit("online", worker);
+}
+function onWorkerMessage(worker, message) {
+  if (!isInternal(message)) {
+    worker.emit("message", message);
+    cluster.emit("message", worker, message);
+    return;
+  }
+  switch (message.act) {
+    case "listening": {
+      const address = { address: message.address, port: message.port, addressType: message.addressType };
+      worker.state = "listening";
+      worker.emit("listening", address);
+      cluster.emit("listening", worker, address);
+      break;
+    }
+    case "exitedAfterDisconnect":
+      worker.exitedAfterDisconnect = !0;
+      break;
+  }
+}
+function onWorkerDisconnect(worker) {
+  if (worker.state !== "dead") worker.state = "disconnected";
+  worker.emit("disconnect");
+  cluster.emit("disconnect", worker);
+  if (worker.isDead()) removeWorker(worker);
+}
+function onWorkerExit(worker, exitCode, signalCode) {
+  worker.state = "dead";
+  worker.emit("exit", exitCode, signalCode);
+  cluster.emit("exit", worker, exitCode, signalCode);
+  if (worker.isConnected()) worker._closeChannel();
+  else removeWorker(worker);
+}
+function removeWorker(worker) {
+  if (cluster.workers[worker.id] === worker) delete cluster.workers[worker.id];
+}
+function forkWorker(self, env) {
+  if (!self.settings.exec) setupPrimary(self, {});
+  validateSchedulingPolicy(self.schedulingPolicy);
+  listenForWorkers();
+  const settings = self.settings;
+  const id = ++nextWorkerId;
+  const worker = new Worker({ id });
+  worker.process = Bun.spawn({
+    cmd: [process.execPath, ...settings.execArgv, settings.exec, ...settings.args],
+    cwd: settings.cwd || process.cwd(),
+    env: {
+      ...process.env,
+      ...env,
+      NODE_UNIQUE_ID: String(id),
+      [IPC_PATH_ENV]: ipcPath
+    },
+    stdio: ["inherit", settings.silent ? "pipe" : "inherit", settings.silent ? "pipe" : "inherit"],
+    onExit(_subprocess, exitCode, signalCode) {
+      onWorkerExit(worker, exitCode, signalCode);
+    }
+  });
+  self.workers[id] = worker;
+  process.nextTick(() => self.emit("fork", worker));
+  return worker;
 }
-cluster = new Cluster;
+function disconnectAll(self, callback) {
+  const workers = Object.values(self.workers);
+  let pending = 0;
+  for (const worker of workers) {
+    if (!worker.isConnected()) continue;
+    pending++;
+    worker.once("disconnect", () => {
+      if (--pending === 0) done();
+    });
+    worker.disconnect();
+  }
+  function done() {
+    if (ipcServer) {
+      ipcServer.stop(!0);
+      ipcServer = null;
+    }
+    if (typeof callback === "function") callback();
+  }
+  if (pending === 0) process.nextTick(done);
+}
+var workerServers = new Set();
+function setupWorker(self) {
+  delete process.env.NODE_UNIQUE_ID;
+  delete process.env[IPC_PATH_ENV];
+  const channel = new Channel();
+  const worker = new Worker({ id: workerId, process, channel, state: "online" });
+  self.worker = worker;
+  channel.onMessage = message => {
+    if (isInternal(message)) {
+      if (message.act === "disconnect") disconnectWorker(worker, !1);
+      return;
+    }
+    worker.emit("message", message);
+    process.emit("message", message);
+  };
+  channel.onClose = () => {
+    worker.state = "disconnected";
+    worker.emit("disconnect");
+    process.emit("disconnect");
+  };
+  if (typeof process.send !== "function") {
+    process.send = (message, handle, options, callback) => worker.send(message, handle, options, callback);
+    process.disconnect = () => worker.disconnect();
+    Object.defineProperty(process, "connected", {
+      get: () => worker.isConnected(),
+      configurable: !0,
+      enumerable: !0
+    });
+  }
+  channel.send({ cmd: INTERNAL, act: "online", id: worker.id });
+  Bun.connect({
+    unix: workerIpcPath,
+    socket: {
+      ...channelHandlers,
+      open(socket) {
+        socket.data = channel;
+        socket.unref();
+        channel.attach(socket);
+      },
+      connectError() {
+        channel.closed();
+      }
+    }
+  }).catch(() => channel.closed());
+  process.on("beforeExit", () => {
+    if (channel.socket && channel.connected && (worker.listenerCount("message") > 0 || process.listenerCount("message") > 0)) {
+      channel.socket.ref();
+    }
+  });
+}
+function workerServerListening(server, address) {
+  if (!address) return;
+  workerServers.add(server);
+  server.once("close", () => workerServers.delete(server));
+  cluster.worker._sendInternal(
+    typeof address === "string"
+      ? { act: "listening", address, port: void 0, addressType: -1 }
+      : { act: "listening", address: address.address, port: address.port, addressType: addressType(address.address) }
+  );
+}
+function disconnectWorker(worker, initiatedByWorker) {
+  if (initiatedByWorker) {
+    worker.exitedAfterDisconnect = !0;
+    worker._sendInternal({ act: "exitedAfterDisconnect" });
+  }
+  for (const server of workerServers) {
+    try {
+      server.close();
+    } catch {}
+  }
+  workerServers.clear();
+  worker._closeChannel();
+}
+if (isWorker) setupWorker(cluster);
 export {
-  schedulingPolicy,
+  SCHED_NONE,
+  SCHED_RR,
   isWorker,
   isPrimary,
   isMaster,
-  cluster as default,
-  cluster,
   Worker,
-  SCHED_RR,
-  SCHED_NONE
+  cluster,
+  cluster as default
 };
@@ -1,3 +1,8 @@
+import {EventEmitter} from "node:events";
+import {lookup as dnsLookup} from "node:dns";
+import {isIP} from "node:net";
+
+// src/js/shared.ts
 function throwNotImplemented(feature, issue) {
   throw hideFromStack(throwNotImplemented), new NotImplementedError(feature, issue);
 }
@@ -17,22 +22,493 @@ class NotImplementedError extends Error {
 }
 
 // src/js/node/dgram.ts
-var createSocket = function() {
-  throwNotImplemented("node:dgram createSocket", 1630);
-}, Socket = function() {
-  throwNotImplemented("node:dgram Socket", 1630);
-}, _createSocketHandle = function() {
+var { Bun } = globalThis[Symbol.for("Bun.lazy")]("primordials");
+var BIND_STATE_UNBOUND = 0;
+var BIND_STATE_BINDING = 1;
+var BIND_STATE_BOUND = 2;
+var CONNECT_STATE_DISCONNECTED = 0;
+var CONNECT_STATE_CONNECTING = 1;
+var CONNECT_STATE_CONNECTED = 2;
+function ERR_SOCKET_BAD_TYPE() {
+  const err = new TypeError("Bad socket type specified. Valid types are: udp4, udp6");
+  err.code = "ERR_SOCKET_BAD_TYPE";
+  return err;
+}
+function ERR_SOCKET_ALREADY_BOUND() {
+  const err = new Error("Socket is already bound");
+  err.code = "ERR_SOCKET_ALREADY_BOUND";
+  return err;
+}
+function ERR_SOCKET_DGRAM_NOT_RUNNING() {
+  const err = new Error("Not running");
+  err.code = "ERR_SOCKET_DGRAM_NOT_RUNNING";
+  return err;
+}
+function ERR_SOCKET_DGRAM_IS_CONNECTED() {
+  const err = new Error("Already connected");
+  err.code = "ERR_SOCKET_DGRAM_IS_CONNECTED";
+  return err;
+}
+function ERR_SOCKET_DGRAM_NOT_CONNECTED() {
+  const err = new Error("Not connected");
+  err.code = "ERR_SOCKET_DGRAM_NOT_CONNECTED";
+  return err;
+}
+function ERR_SOCKET_BAD_PORT(name, port) {
+  const err = new RangeError(`${name} should be >= 0 and < 65536. Received ${port}.`);
+  err.code = "ERR_SOCKET_BAD_PORT";
+  return err;
+}
+function ERR_BUFFER_OUT_OF_BOUNDS(name) {
+  const err = new RangeError(`"${name}" is outside of buffer bounds`);
+  err.code = "ERR_BUFFER_OUT_OF_BOUNDS";
+  return err;
+}
+function ERR_INVALID_ARG_TYPE(name, type, value) {
+  const err = new TypeError(`The "${name}" argument must be of type ${type}. Received ${value}`);
+  err.code = "ERR_INVALID_ARG_TYPE";
+  return err;
+}
+function ERR_MISSING_ARGS(name) {
+  const err = new TypeError(`The "${name}" argument must be specified`);
+  err.code = "ERR_MISSING_ARGS";
+  return err;
+}
+function validatePort(port, name, allowZero) {
+  if (
+    (typeof port !== "number" && typeof port !== "string") ||
+    (typeof port === "string" && port.trim().length === 0) ||
+    +port !== +port >>> 0 ||
+    port > 0xffff ||
+    (port === 0 && !allowZero)
+  ) {
+    throw ERR_SOCKET_BAD_PORT(name, port);
+  }
+  return port | 0;
+}
+function validateString(value, name) {
+  if (typeof value !== "string") throw ERR_INVALID_ARG_TYPE(name, "string", value);
+}
+function toBuffer(value, name) {
+  if (typeof value === "string") return Buffer.from(value);
+  if (!ArrayBuffer.isView(value)) throw ERR_INVALID_ARG_TYPE(name, "Buffer, TypedArray, DataView, or string", value);
+  return value;
+}
+function sliceBuffer(buffer, offset, length) {
+  buffer = toBuffer(buffer, "buffer");
+  offset = offset >>> 0;
+  length = length >>> 0;
+  if (offset > buffer.byteLength) throw ERR_BUFFER_OUT_OF_BOUNDS("offset");
+  if (offset + length > buffer.byteLength) throw ERR_BUFFER_OUT_OF_BOUNDS("length");
+  return new Uint8Array(buffer.buffer, buffer.byteOffset + offset, length);
+}
+function toDatagram(buffer) {
+  if (!Array.isArray(buffer)) return toBuffer(buffer, "buffer");
+  if (buffer.length === 1) return toBuffer(buffer[0], "buffer list arguments");
+  return Buffer.concat(buffer.map(chunk => toBuffer(chunk, "buffer list arguments")));
+}
+class Socket extends EventEmitter {
+  type;
+  #handle = null;
+  #bindState = BIND_STATE_UNBOUND;
+  #connectState = CONNECT_STATE_DISCONNECTED;
+  #closed = !1;
+  #ref = !0;
+  #options;
+  #lookup;
+  #signal;
+  #onAbort;
+  #queue = void 0;
+  #packets = [];
+  #callbacks = [];
+  #queuedBytes = 0;
+  #flushScheduled = !1;
+  #blocked = !1;
+  constructor(type, listener) {
+    super();
+    let options;
+    if (type !== null && typeof type === "object") {
+      options = type;
+      type = options.type;
+    }
+    if (type !== "udp4" && type !== "udp6") throw ERR_SOCKET_BAD_TYPE();
+    this.type = type;
+    this.#options = options ?? {};
+    this.#lookup = this.#options.lookup ?? dnsLookup;
+    if (typeof this.#lookup !== "function") throw ERR_INVALID_ARG_TYPE("lookup", "function", this.#lookup);
+    if (typeof listener === "function") this.on("message", listener);
+    const signal = this.#options.signal;
+    if (signal !== void 0) {
+      if (signal.aborted) {
+        process.nextTick(() => this.close());
+      } else {
+        this.#signal = signal;
+        this.#onAbort = () => this.close();
+        signal.addEventListener("abort", this.#onAbort, { once: !0 });
+      }
+    }
+  }
+  #healthCheck() {
+    if (this.#closed) throw ERR_SOCKET_DGRAM_NOT_RUNNING();
+  }
+  #boundHandle() {
+    if (this.#handle === null) throw ERR_SOCKET_DGRAM_NOT_RUNNING();
+    return this.#handle;
+  }
+  #enqueue(operation) {
+    (this.#queue ??= []).push(operation);
+  }
+  #resolve(address, callback) {
+    if (!address) address = this.type === "udp4" ? "127.0.0.1" : "::1";
+    if (this.#lookup === dnsLookup && isIP(address) !== 0) {
+      callback(null, address);
+      return;
+    }
+    this.#lookup(address, this.type === "udp4" ? 4 : 6, callback);
+  }
+  bind(port_, address_ ) {
+    this.#healthCheck();
+    if (this.#bindState !== BIND_STATE_UNBOUND) throw ERR_SOCKET_ALREADY_BOUND();
+    let port = port_;
+    let address;
+    if (port !== null && typeof port === "object") {
+      if (port.fd !== void 0) throwNotImplemented("dgram.Socket.bind({ fd })");
+      address = port.address;
+      port = port.port;
+    } else {
+      address = typeof address_ === "function" ? void 0 : address_;
+    }
+    if (port === void 0 || port === null || typeof port === "function") port = 0;
+    port = validatePort(port, "Port", !0);
+    if (!address) address = this.type === "udp4" ? "0.0.0.0" : "::";
+    else validateString(address, "address");
+    const callback = arguments.length > 0 ? arguments[arguments.length - 1] : void 0;
+    if (typeof callback === "function") this.once("listening", callback);
+    this.#bindState = BIND_STATE_BINDING;
+    this.#resolve(address, (err, ip) => process.nextTick(() => this.#onBindResolved(err, ip, port)));
+    return this;
+  }
+  #onBindResolved(err, ip, port) {
+    if (this.#bindState !== BIND_STATE_BINDING) return;
+    if (!err) {
+      const options = this.#options;
+      try {
+        this.#handle = Bun.udpSocket({
+          hostname: ip,
+          port,
+          reuseAddr: !!options.reuseAddr,
+          ipv6Only: !!options.ipv6Only,
+          recvBufferSize: options.recvBufferSize,
+          sendBufferSize: options.sendBufferSize,
+          socket: {
+            binaryType: "buffer",
+            data: (handle, data, port, address) => this.#onMessage(data, port, address),
+            drain: () => this.#onDrain(),
+            error: (handle, error) => this.emit("error", error)
+          }
+        });
+      } catch (error) {
+        err = error;
+      }
+    }
+    if (err) {
+      this.#bindState = BIND_STATE_UNBOUND;
+      this.#queue = void 0;
+      this.emit("error", err);
+      return;
+    }
+    this.#bindState = BIND_STATE_BOUND;
+    if (!this.#ref) this.#handle.unref();
+    this.emit("listening");
+    const queue = this.#queue;
+    this.#queue = void 0;
+    if (queue !== void 0) {
+      for (const operation of queue) operation();
+    }
+  }
+  #onMessage(data, port, address) {
+    this.emit("message", data, {
+      address,
+      family: address.includes(":") ? "IPv6" : "IPv4",
+      port,
+      size: data.length
+    });
+  }
+  #onDrain() {
+    this.#blocked = !1;
+    this.#flush();
+  }
+  send(buffer, offset, length, port, address, callback) {
+    const connected = this.#connectState === CONNECT_STATE_CONNECTED;
+    if (!connected) {
+      if (address || (port && typeof port !== "function")) {
+        buffer = sliceBuffer(buffer, offset, length);
+      } else {
+        callback = port;
+        port = offset;
+        address = length;
+      }
+    } else {
+      if (typeof length === "number") {
+        buffer = sliceBuffer(buffer, offset, length);
+        if (typeof port === "function") {
+          callback = port;
+          port = null;
+        }
+      } else {
+        callback = offset;
+      }
+      if (port || address) throw ERR_SOCKET_DGRAM_IS_CONNECTED();
+    }
+    const data = toDatagram(buffer);
+    if (!connected) port = validatePort(port, "Port", !1);
+    if (typeof callback !== "function") callback = void 0;
+    if (typeof address === "function") {
+      callback = address;
+      address = void 0;
+    } else if (address != null) {
+      validateString(address, "address");
+    }
+    this.#healthCheck();
+    if (this.#bindState === BIND_STATE_UNBOUND) this.bind({ port: 0 });
+    if (this.#bindState !== BIND_STATE_BOUND) {
+      this.#enqueue(() => this.#send(data, connected, port, address, callback));
+      return;
+    }
+    this.#send(data, connected, port, address, callback);
+  }
+  #send(data, connected, port, address, callback) {
+    if (connected) {
+      this.#push(data, void 0, void 0, callback);
+      return;
+    }
+    this.#resolve(address, (err, ip) => {
+      if (err) {
+        this.#report(callback, err);
+        return;
+      }
+      this.#push(data, port, ip, callback);
+    });
+  }
+  #push(data, port, address, callback) {
+    if (this.#handle === null) return;
+    this.#packets.push(data, port, address);
+    this.#callbacks.push(callback);
+    this.#queuedBytes += data.byteLength;
+    if (!this.#flushScheduled && !this.#blocked) {
+      this.#flushScheduled = !0;
+      process.nextTick(() => this.#flush());
+    }
+  }
+  #report(callback, err) {
+    if (callback) process.nextTick(callback, err);
+    else process.nextTick(() => this.emit("error", err));
+  }
+  #flush() {
+    this.#flushScheduled = !1;
+    const handle = this.#handle;
+    if (handle === null || this.#blocked) return;
+    const packets = this.#packets;
+    const callbacks = this.#callbacks;
+    this.#packets = [];
+    this.#callbacks = [];
+    this.#queuedBytes = 0;
+    let done = 0;
+    while (done < callbacks.length) {
+      const sent = handle.sendMany(done === 0 ? packets : packets.slice(done * 3));
+      for (const end = done + sent; done < end; done++) {
+        const callback = callbacks[done];
+        if (callback) process.nextTick(callback, null, packets[done * 3].byteLength);
+      }
+      if (done === callbacks.length) break;
+      const data = packets[done * 3];
+      let ok;
+      try {
+        ok = handle.send(data, packets[done * 3 + 1], packets[done * 3 + 2]);
+      } catch (err) {
+        this.#report(callbacks[done++], err);
+        continue;
+      }
+      if (!ok) {
+        this.#blocked = !0;
+        this.#packets = packets.slice(done * 3);
+        this.#callbacks = callbacks.slice(done);
+        for (let i = 0; i < this.#packets.length; i += 3) this.#queuedBytes += this.#packets[i].byteLength;
+        return;
+      }
+      const callback = callbacks[done++];
+      if (callback) process.nextTick(callback, null, data.byteLength);
+    }
+  }
+  connect(port, address, callback) {
+    port = validatePort(port, "Port", !1);
+    if (typeof address === "function") {
+      callback = address;
+      address = "";
+    } else if (address === void 0) {
+      address = "";
+    }
+    validateString(address, "address");
+    this.#healthCheck();
+    if (this.#connectState !== CONNECT_STATE_DISCONNECTED) throw ERR_SOCKET_DGRAM_IS_CONNECTED();
+    this.#connectState = CONNECT_STATE_CONNECTING;
+    if (typeof callback === "function") this.once("connect", callback);
+    if (this.#bindState === BIND_STATE_UNBOUND) this.bind({ port: 0 });
+    if (this.#bindState !== BIND_STATE_BOUND) {
+      this.#enqueue(() => this.#connect(port, address, callback));
+      return;
+    }
+    this.#connect(port, address, callback);
+  }
+  #connect(port, address, callback) {
+    this.#resolve(address, (err, ip) => {
+      if (this.#connectState !== CONNECT_STATE_CONNECTING) return;
+      if (!err) {
+        try {
+          this.#flush();
+          this.#boundHandle().connect(port, ip);
+        } catch (error) {
+          err = error;
+        }
+      }
+      if (err) {
+        this.#connectState = CONNECT_STATE_DISCONNECTED;
+        process.nextTick(() => {
+          if (typeof callback === "function") {
+            this.removeListener("connect", callback);
+            callback(err);
+          } else {
+            this.emit("error", err);
+          }
+        });
+        return;
+      }
+      this.#connectState = CONNECT_STATE_CONNECTED;
+      process.nextTick(() => this.emit("connect"));
+    });
+  }
+  disconnect() {
+    this.#healthCheck();
+    if (this.#connectState !== CONNECT_STATE_CONNECTED) throw ERR_SOCKET_DGRAM_NOT_CONNECTED();
+    this.#flush();
+    this.#boundHandle().disconnect();
+    this.#connectState = CONNECT_STATE_DISCONNECTED;
+  }
+  close(callback) {
+    if (typeof callback === "function") this.on("close", callback);
+    if (this.#queue !== void 0) {
+      this.#queue.push(() => this.close());
+      return this;
+    }
+    this.#healthCheck();
+    this.#closed = !0;
+    this.#bindState = BIND_STATE_UNBOUND;
+    this.#connectState = CONNECT_STATE_DISCONNECTED;
+    const handle = this.#handle;
+    if (handle !== null) {
+      this.#flush();
+      this.#handle = null;
+      handle.close();
+    }
+    this.#packets = [];
+    this.#callbacks = [];
+    this.#queuedBytes = 0;
+    if (this.#signal !== void 0) {
+      this.#signal.removeEventListener("abort", this.#onAbort);
+      this.#signal = void 0;
+    }
+    process.nextTick(() => this.emit("close"));
+    return this;
+  }
+  address() {
+    return this.#boundHandle().address;
+  }
+  remoteAddress() {
+    this.#healthCheck();
+    if (this.#connectState !== CONNECT_STATE_CONNECTED) throw ERR_SOCKET_DGRAM_NOT_CONNECTED();
+    return this.#boundHandle().remoteAddress;
+  }
+  setBroadcast(flag) {
+    this.#boundHandle().setBroadcast(!!flag);
+  }
+  setTTL(ttl) {
+    if (typeof ttl !== "number") throw ERR_INVALID_ARG_TYPE("ttl", "number", ttl);
+    this.#boundHandle().setTTL(ttl);
+    return ttl;
+  }
+  setMulticastTTL(ttl) {
+    if (typeof ttl !== "number") throw ERR_INVALID_ARG_TYPE("ttl", "number", ttl);
+    this.#boundHandle().setMulticastTTL(ttl);
+    return ttl;
+  }
+  setMulticastLoopback(flag) {
+    this.#boundHandle().setMulticastLoopback(!!flag);
+    return flag;
+  }
+  setMulticastInterface(interfaceAddress) {
+    this.#healthCheck();
+    validateString(interfaceAddress, "interfaceAddress");
+    this.#boundHandle().setMulticastInterface(interfaceAddress);
+  }
+  addMembership(multicastAddress, interfaceAddress) {
+    if (!multicastAddress) throw ERR_MISSING_ARGS("multicastAddress");
+    this.#boundHandle().addMembership(multicastAddress, interfaceAddress);
+  }
+  dropMembership(multicastAddress, interfaceAddress) {
+    if (!multicastAddress) throw ERR_MISSING_ARGS("multicastAddress");
+    this.#boundHandle().dropMembership(multicastAddress, interfaceAddress);
+  }
+  addSourceSpecificMembership() {
+    throwNotImplemented("dgram.Socket.addSourceSpecificMembership");
+  }
+  dropSourceSpecificMembership() {
+    throwNotImplemented("dgram.Socket.dropSourceSpecificMembership");
+  }
+  getRecvBufferSize() {
+    return this.#boundHandle().getRecvBufferSize();
+  }
+  setRecvBufferSize(size) {
+    this.#boundHandle().setRecvBufferSize(size);
+  }
+  getSendBufferSize() {
+    return this.#boundHandle().getSendBufferSize();
+  }
+  setSendBufferSize(size) {
+    this.#boundHandle().setSendBufferSize(size);
+  }
+  getSendQueueSize() {
+    return this.#queuedBytes;
+  }
+  getSendQueueCount() {
+    return this.#callbacks.length;
+  }
+  ref() {
+    this.#ref = !0;
+    this.#handle?.ref();
+    return this;
+  }
+  unref() {
+    this.#ref = !1;
+    this.#handle?.unref();
+    return this;
+  }
+}
+function createSocket(type, listener) {
+  return new Socket(type, listener);
+}
+function _createSocketHandle() {
   throwNotImplemented("node:dgram _createSocketHandle", 1630);
-}, defaultObject = {
+}
+var defaultObject = {
   createSocket,
   Socket,
   _createSocketHandle,
   [Symbol.for("CommonJS")]: 0
 };
-hideFromStack(createSocket, Socket, _createSocketHandle);
+hideFromStack(createSocket, _createSocketHandle);
 export {
   defaultObject as default,
+  Socket,
   createSocket,
-  _createSocketHandle,
-  Socket
+  _createSocketHandle
 };
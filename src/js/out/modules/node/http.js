@@ -32,8 +32,12 @@ var emitListeningNextTick = function(self, onListen, err, hostname, port) {
     }
   if (self.listening = !err, err)
     self.emit("error", err);
-  else
+  else {
+    const cluster = import.meta.require("node:cluster");
+    if (cluster.isWorker)
+      cluster._onServerListening(self, { address: hostname, port });
     self.emit("listening", hostname, port);
+  }
 }, assignHeaders = function(object, req) {
   var headers = req.headers.toJSON();
   const rawHeaders = newArrayWithSize(req.headers.count * 2);
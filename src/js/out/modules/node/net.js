@@ -23,6 +23,9 @@ var isIPv4 = function(s) {
     } catch (err) {
       self.emit("error", err);
     }
+  const cluster = import.meta.require("node:cluster");
+  if (cluster.isWorker)
+    cluster._onServerListening(self, self.address());
   self.emit("listening");
 }, createServer = function(options, connectionListener) {
   return new Server(options, connectionListener);
@@ -0,0 +1,305 @@
+import {EventEmitter} from "node:events";
+import {resolve as resolvePath, isAbsolute} from "node:path";
+import {fileURLToPath} from "node:url";
+
+// src/js/shared.ts
+function throwNotImplemented(feature, issue) {
+  throw hideFromStack(throwNotImplemented), new NotImplementedError(feature, issue);
+}
+function hideFromStack(...fns) {
+  for (let fn of fns)
+    Object.defineProperty(fn, "name", {
+      value: "::bunternal::"
+    });
+}
+
+class NotImplementedError extends Error {
+  code;
+  constructor(feature, issue) {
+    super(feature + " is not yet implemented in Bun." + (issue ? " Track the status & thumbs up the issue: https://github.com/oven-sh/bun/issues/" + issue : ""));
+    this.name = "NotImplementedError", this.code = "ERR_NOT_IMPLEMENTED", hideFromStack(NotImplementedError);
+  }
+}
+
+// src/js/node/worker_threads.ts
+var {
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  MessagePort,
+  createWorker,
+  createChannel,
+  receiveMessageOnPort: receiveMessageOnPortNative
+} = globalThis[Symbol.for("Bun.lazy")]("worker_threads");
+var SHARE_ENV = Symbol.for("nodejs.worker_threads.SHARE_ENV");
+function ERR_INVALID_ARG_TYPE(name, expected, actual) {
+  const err = new TypeError(`The "${name}" argument must be ${expected}. Received ${typeof actual}`);
+  err.code = "ERR_INVALID_ARG_TYPE";
+  return err;
+}
+function ERR_WORKER_PATH(filename) {
+  const err = new TypeError(
+    "The worker script or module filename must be an absolute path or a relative path starting with './' or '../'." +
+      ` Received "${filename}"`
+  );
+  err.code = "ERR_WORKER_PATH";
+  return err;
+}
+var MessagePortPrototype = MessagePort.prototype;
+Object.setPrototypeOf(MessagePortPrototype, EventEmitter.prototype);
+var {
+  addListener: emitterAddListener,
+  prependListener: emitterPrependListener,
+  removeListener: emitterRemoveListener,
+  removeAllListeners: emitterRemoveAllListeners
+} = EventEmitter.prototype;
+function startOnMessageListener(port, type) {
+  if (type === "message" && port.listenerCount("message") === 1) {
+    port.ref();
+    port.start();
+  }
+}
+function stopOnLastMessageListener(port, type) {
+  if ((type === void 0 || type === "message") && port.listenerCount("message") === 0) {
+    port.unref();
+  }
+}
+MessagePortPrototype.addListener = MessagePortPrototype.on = function addListener(type, fn) {
+  emitterAddListener.call(this, type, fn);
+  startOnMessageListener(this, type);
+  return this;
+};
+MessagePortPrototype.prependListener = function prependListener(type, fn) {
+  emitterPrependListener.call(this, type, fn);
+  startOnMessageListener(this, type);
+  return this;
+};
+MessagePortPrototype.removeListener = MessagePortPrototype.off = function removeListener(type, fn) {
+  emitterRemoveListener.call(this, type, fn);
+  stopOnLastMessageListener(this, type);
+  return this;
+};
+MessagePortPrototype.removeAllListeners = function removeAllListeners(type) {
+  emitterRemoveAllListeners.call(this, type);
+  stopOnLastMessageListener(this, type);
+  return this;
+};
+var kOnMessage = Symbol("onmessage");
+var kEventListeners = Symbol("eventListeners");
+function wrapEventListener(port, type, listener) {
+  return function (value) {
+    const event = type === "close" ? { type, target: port } : { type, target: port, data: value };
+    if (typeof listener === "function") listener.call(port, event);
+    else listener.handleEvent(event);
+  };
+}
+MessagePortPrototype.addEventListener = function addEventListener(type, listener, options) {
+  if (listener == null) return;
+  const listeners = (this[kEventListeners] ??= new Map());
+  const key = `${type}`;
+  let byType = listeners.get(key);
+  if (!byType) listeners.set(key, (byType = new Map()));
+  if (byType.has(listener)) return;
+  const wrapped = wrapEventListener(this, key, listener);
+  byType.set(listener, wrapped);
+  if (options?.once) {
+    this.once(key, value => {
+      byType.delete(listener);
+      wrapped(value);
+    });
+  } else {
+    this.on(key, wrapped);
+  }
+};
+MessagePortPrototype.removeEventListener = function removeEventListener(type, listener) {
+  const byType = this[kEventListeners]?.get(`${type}`);
+  const wrapped = byType?.get(listener);
+  if (!wrapped) return;
+  byType.delete(listener);
+  this.off(`${type}`, wrapped);
+};
+Object.defineProperty(MessagePortPrototype, "onmessage", {
+  get() {
+    return this[kOnMessage] ?? null;
+  },
+  set(listener) {
+    if (this[kOnMessage]) this.removeEventListener("message", this[kOnMessage]);
+    this[kOnMessage] = typeof listener === "function" ? listener : null;
+    if (this[kOnMessage]) this.addEventListener("message", this[kOnMessage]);
+  },
+  configurable: !0,
+  enumerable: !0
+});
+class MessageChannel {
+  port1;
+  port2;
+  constructor() {
+    [this.port1, this.port2] = createChannel();
+  }
+}
+function receiveMessageOnPort(port) {
+  if (!(port instanceof MessagePort)) {
+    throw ERR_INVALID_ARG_TYPE("port", "an instance of MessagePort", port);
+  }
+  return receiveMessageOnPortNative(port);
+}
+function resolveWorkerFilename(filename) {
+  if (filename instanceof URL) {
+    return fileURLToPath(filename);
+  }
+  if (typeof filename !== "string") {
+    throw ERR_INVALID_ARG_TYPE("filename", "of type string or an instance of URL", filename);
+  }
+  if (filename.startsWith("file:")) {
+    return fileURLToPath(filename);
+  }
+  if (isAbsolute(filename) || /^\.\.?[\\/]/.test(filename)) {
+    return resolvePath(filename);
+  }
+  throw ERR_WORKER_PATH(filename);
+}
+class Worker extends EventEmitter {
+  #handle;
+  #port;
+  #exitCode = null;
+  #terminating = [];
+  constructor(filename, options = {}) {
+    super();
+    if (options.eval) {
+      throwNotImplemented("worker_threads.Worker option eval");
+    }
+    const path = resolveWorkerFilename(filename);
+    this.#handle = createWorker(path, options.workerData, options.transferList, (event, value) => {
+      switch (event) {
+        case "online":
+          this.emit("online");
+          break;
+        case "error":
+          this.emit("error", value);
+          break;
+        case "exit":
+          this.#onExit(value);
+          break;
+      }
+    });
+    const port = (this.#port = this.#handle.port);
+    emitterAddListener.call(port, "message", message => this.emit("message", message));
+    emitterAddListener.call(port, "messageerror", err => this.emit("messageerror", err));
+    port.unref();
+    port.start();
+  }
+  #onExit(code) {
+    this.#exitCode = code;
+    this.#port.close();
+    this.emit("exit", code);
+    for (const resolve of this.#terminating.splice(0)) {
+      resolve(code);
+    }
+  }
+  get threadId() {
+    return this.#handle.threadId;
+  }
+  get resourceLimits() {
+    return {};
+  }
+  get stdin() {
+    return null;
+  }
+  get stdout() {
+    return null;
+  }
+  get stderr() {
+    return null;
+  }
+  get performance() {
+    return { eventLoopUtilization: () => ({ idle: 0, active: 0, utilization: 0 }) };
+  }
+  postMessage(value, transferList) {
+    this.#port.postMessage(value, transferList);
+  }
+  ref() {
+    this.#handle.ref();
+  }
+  unref() {
+    this.#handle.unref();
+  }
+  terminate(callback) {
+    if (typeof callback === "function") {
+      process.emitWarning(
+        "Passing a callback to worker.terminate() is deprecated. It returns a Promise instead.",
+        "DeprecationWarning",
+        "DEP0132"
+      );
+    }
+    const promise =
+      this.#exitCode !== null
+        ? Promise.resolve(this.#exitCode)
+        : new Promise(resolve => {
+            this.#terminating.push(resolve);
+            this.#handle.terminate();
+          });
+    if (typeof callback === "function") {
+      promise.then(code => callback(null, code), callback);
+    }
+    return promise;
+  }
+  getHeapSnapshot() {
+    throwNotImplemented("worker_threads.Worker.getHeapSnapshot");
+  }
+}
+function markAsUntransferable() {}
+function moveMessagePortToContext() {
+  throwNotImplemented("worker_threads.moveMessagePortToContext");
+}
+var environmentData = new Map();
+function setEnvironmentData(key, value) {
+  if (value === void 0) environmentData.delete(key);
+  else environmentData.set(key, value);
+}
+function getEnvironmentData(key) {
+  return environmentData.get(key);
+}
+class BroadcastChannel {
+  constructor() {
+    throwNotImplemented("worker_threads.BroadcastChannel");
+  }
+}
+var resourceLimits = {};
+var defaultObject = {
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  resourceLimits,
+  SHARE_ENV,
+  Worker,
+  MessageChannel,
+  MessagePort,
+  BroadcastChannel,
+  receiveMessageOnPort,
+  markAsUntransferable,
+  moveMessagePortToContext,
+  setEnvironmentData,
+  getEnvironmentData,
+  [Symbol.for("CommonJS")]: 0
+};
+hideFromStack(receiveMessageOnPort, moveMessagePortToContext);
+export {
+  defaultObject as default,
+  isMainThread,
+  threadId,
+  workerData,
+  parentPort,
+  resourceLimits,
+  SHARE_ENV,
+  Worker,
+  MessageChannel,
+  MessagePort,
+  BroadcastChannel,
+  receiveMessageOnPort,
+  markAsUntransferable,
+  moveMessagePortToContext,
+  setEnvironmentData,
+  getEnvironmentData
+};
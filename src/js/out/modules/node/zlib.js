@@ -1 +1 @@
-import{default as R0} from"node:assert";import*as t0 from"node:assert";import*as o0 from"node:buffer";import*as s0 from"node:stream";import*as W1 from"node:util";var j1,J1,Y1,G1,q1,X1,U1,P1,K1,F1,H1,z1,Z1,L1,C1,N1,I1,O1,B1,D1,M1,k1,v1,R1,A1,g1,w1,T1,S1;var y1=Object.getOwnPropertyNames;var A0=(Y,g)=>function b(){return g||(0,Y[y1(Y)[0]])((g={exports:{}}).exports,g),g.exports};var E1=A0({"node_modules/pako/lib/zlib/zstream.js"(Y,g){function b(){this.input=null,this.next_in=0,this.avail_in=0,this.total_in=0,this.output=null,this.next_out=0,this.avail_out=0,this.total_out=0,this.msg="",this.state=null,this.data_type=2,this.adler=0}g.exports=b}}),r0=A0({"node_modules/pako/lib/utils/common.js"(Y){var g=typeof Uint8Array!=="undefined"&&typeof Uint16Array!=="undefined"&&typeof Int32Array!=="undefined";function b(C,w){return Object.prototype.hasOwnProperty.call(C,w)}Y.assign=function(C){var w=Array.prototype.slice.call(arguments,1);while(w.length){var v=w.shift();if(!v)continue;if(typeof v!=="object")throw new TypeError(v+"must be non-object");for(var k in v)if(b(v,k))C[k]=v[k]}return C},Y.shrinkBuf=function(C,w){if(C.length===w)return C;if(C.subarray)return C.subarray(0,w);return C.length=w,C};var L={arraySet:function(C,w,v,k,B){if(w.subarray&&C.subarray){C.set(w.subarray(v,v+k),B);return}for(var N=0;N<k;N++)C[B+N]=w[v+N]},flattenChunks:function(C){var w,v,k,B,N,y;k=0;for(w=0,v=C.length;w<v;w++)k+=C[w].length;y=new Uint8Array(k),B=0;for(w=0,v=C.length;w<v;w++)N=C[w],y.set(N,B),B+=N.length;return y}},n={arraySet:function(C,w,v,k,B){for(var N=0;N<k;N++)C[B+N]=w[v+N]},flattenChunks:function(C){return[].concat.apply([],C)}};Y.setTyped=function(C){if(C)Y.Buf8=Uint8Array,Y.Buf16=Uint16Array,Y.Buf32=Int32Array,Y.assign(Y,L);else Y.Buf8=Array,Y.Buf16=Array,Y.Buf32=Array,Y.assign(Y,n)},Y.setTyped(g)}}),x1=A0({"node_modules/pako/lib/zlib/trees.js"(Y){var g=r0(),b=4,L=0,n=1,C=2;function w(W){var F=W.length;while(--F>=0)W[F]=0}var v=0,k=1,B=2,N=3,y=258,m=29,p=256,t=p+1+m,u=30,s=19,W0=2*t+1,E=15,S=16,J0=7,G0=256,F0=16,f=17,d=18,z=[0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0],h=[0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13],V0=[0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,3,7],j=[16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15],K=512,O=new Array((t+2)*2);w(O);var I=new Array(u*2);w(I);var c=new Array(K);w(c);var l=new Array(y-N+1);w(l);var D=new Array(m);w(D);var Q0=new Array(u);w(Q0);function i(W,F,Z,R,G){this.static_tree=W,this.extra_bits=F,this.extra_base=Z,this.elems=R,this.max_length=G,this.has_stree=W&&W.length}var H0,N0,I0;function K0(W,F){this.dyn_tree=W,this.max_code=0,this.stat_desc=F}function X0(W){return W<256?c[W]:c[256+(W>>>7)]}function U0(W,F){W.pending_buf[W.pending++]=F&255,W.pending_buf[W.pending++]=F>>>8&255}function a(W,F,Z){if(W.bi_valid>S-Z)W.bi_buf|=F<<W.bi_valid&65535,U0(W,W.bi_buf),W.bi_buf=F>>S-W.bi_valid,W.bi_valid+=Z-S;else W.bi_buf|=F<<W.bi_valid&65535,W.bi_valid+=Z}function Y0(W,F,Z){a(W,Z[F*2],Z[F*2+1])}function r(W,F){var Z=0;do Z|=W&1,W>>>=1,Z<<=1;while(--F>0);return Z>>>1}function z0(W){if(W.bi_valid===16)U0(W,W.bi_buf),W.bi_buf=0,W.bi_valid=0;else if(W.bi_valid>=8)W.pending_buf[W.pending++]=W.bi_buf&255,W.bi_buf>>=8,W.bi_valid-=8}function Z0(W,F){var{dyn_tree:Z,max_code:R}=F,G=F.stat_desc.static_tree,P=F.stat_desc.has_stree,$=F.stat_desc.extra_bits,H=F.stat_desc.extra_base,x=F.stat_desc.max_length,Q,X,U,V,J,q,T=0;for(V=0;V<=E;V++)W.bl_count[V]=0;Z[W.heap[W.heap_max]*2+1]=0;for(Q=W.heap_max+1;Q<W0;Q++){if(X=W.heap[Q],V=Z[Z[X*2+1]*2+1]+1,V>x)V=x,T++;if(Z[X*2+1]=V,X>R)continue;if(W.bl_count[V]++,J=0,X>=H)J=$[X-H];if(q=Z[X*2],W.opt_len+=q*(V+J),P)W.static_len+=q*(G[X*2+1]+J)}if(T===0)return;do{V=x-1;while(W.bl_count[V]===0)V--;W.bl_count[V]--,W.bl_count[V+1]+=2,W.bl_count[x]--,T-=2}while(T>0);for(V=x;V!==0;V--){X=W.bl_count[V];while(X!==0){if(U=W.heap[--Q],U>R)continue;if(Z[U*2+1]!==V)W.opt_len+=(V-Z[U*2+1])*Z[U*2],Z[U*2+1]=V;X--}}}function g0(W,F,Z){var R=new Array(E+1),G=0,P,$;for(P=1;P<=E;P++)R[P]=G=G+Z[P-1]<<1;for($=0;$<=F;$++){var H=W[$*2+1];if(H===0)continue;W[$*2]=r(R[H]++,H)}}function j0(){var W,F,Z,R,G,P=new Array(E+1);Z=0;for(R=0;R<m-1;R++){D[R]=Z;for(W=0;W<1<<z[R];W++)l[Z++]=R}l[Z-1]=R,G=0;for(R=0;R<16;R++){Q0[R]=G;for(W=0;W<1<<h[R];W++)c[G++]=R}G>>=7;for(;R<u;R++){Q0[R]=G<<7;for(W=0;W<1<<h[R]-7;W++)c[256+G++]=R}for(F=0;F<=E;F++)P[F]=0;W=0;while(W<=143)O[W*2+1]=8,W++,P[8]++;while(W<=255)O[W*2+1]=9,W++,P[9]++;while(W<=279)O[W*2+1]=7,W++,P[7]++;while(W<=287)O[W*2+1]=8,W++,P[8]++;g0(O,t+1,P);for(W=0;W<u;W++)I[W*2+1]=5,I[W*2]=r(W,5);H0=new i(O,z,p+1,t,E),N0=new i(I,h,0,u,E),I0=new i(new Array(0),V0,0,s,J0)}function M0(W){var F;for(F=0;F<t;F++)W.dyn_ltree[F*2]=0;for(F=0;F<u;F++)W.dyn_dtree[F*2]=0;for(F=0;F<s;F++)W.bl_tree[F*2]=0;W.dyn_ltree[G0*2]=1,W.opt_len=W.static_len=0,W.last_lit=W.matches=0}function c0(W){if(W.bi_valid>8)U0(W,W.bi_buf);else if(W.bi_valid>0)W.pending_buf[W.pending++]=W.bi_buf;W.bi_buf=0,W.bi_valid=0}function w0(W,F,Z,R){if(c0(W),R)U0(W,Z),U0(W,~Z);g.arraySet(W.pending_buf,W.window,F,Z,W.pending),W.pending+=Z}function v0(W,F,Z,R){var G=F*2,P=Z*2;return W[G]<W[P]||W[G]===W[P]&&R[F]<=R[Z]}function q0(W,F,Z){var R=W.heap[Z],G=Z<<1;while(G<=W.heap_len){if(G<W.heap_len&&v0(F,W.heap[G+1],W.heap[G],W.depth))G++;if(v0(F,R,W.heap[G],W.depth))break;W.heap[Z]=W.heap[G],Z=G,G<<=1}W.heap[Z]=R}function _(W,F,Z){var R,G,P=0,$,H;if(W.last_lit!==0)do if(R=W.pending_buf[W.d_buf+P*2]<<8|W.pending_buf[W.d_buf+P*2+1],G=W.pending_buf[W.l_buf+P],P++,R===0)Y0(W,G,F);else{if($=l[G],Y0(W,$+p+1,F),H=z[$],H!==0)G-=D[$],a(W,G,H);if(R--,$=X0(R),Y0(W,$,Z),H=h[$],H!==0)R-=Q0[$],a(W,R,H)}while(P<W.last_lit);Y0(W,G0,F)}function T0(W,F){var Z=F.dyn_tree,R=F.stat_desc.static_tree,G=F.stat_desc.has_stree,P=F.stat_desc.elems,$,H,x=-1,Q;W.heap_len=0,W.heap_max=W0;for($=0;$<P;$++)if(Z[$*2]!==0)W.heap[++W.heap_len]=x=$,W.depth[$]=0;else Z[$*2+1]=0;while(W.heap_len<2)if(Q=W.heap[++W.heap_len]=x<2?++x:0,Z[Q*2]=1,W.depth[Q]=0,W.opt_len--,G)W.static_len-=R[Q*2+1];F.max_code=x;for($=W.heap_len>>1;$>=1;$--)q0(W,Z,$);Q=P;do $=W.heap[1],W.heap[1]=W.heap[W.heap_len--],q0(W,Z,1),H=W.heap[1],W.heap[--W.heap_max]=$,W.heap[--W.heap_max]=H,Z[Q*2]=Z[$*2]+Z[H*2],W.depth[Q]=(W.depth[$]>=W.depth[H]?W.depth[$]:W.depth[H])+1,Z[$*2+1]=Z[H*2+1]=Q,W.heap[1]=Q++,q0(W,Z,1);while(W.heap_len>=2);W.heap[--W.heap_max]=W.heap[1],Z0(W,F),g0(Z,x,W.bl_count)}function p0(W,F,Z){var R,G=-1,P,$=F[1],H=0,x=7,Q=4;if($===0)x=138,Q=3;F[(Z+1)*2+1]=65535;for(R=0;R<=Z;R++){if(P=$,$=F[(R+1)*2+1],++H<x&&P===$)continue;else if(H<Q)W.bl_tree[P*2]+=H;else if(P!==0){if(P!==G)W.bl_tree[P*2]++;W.bl_tree[F0*2]++}else if(H<=10)W.bl_tree[f*2]++;else W.bl_tree[d*2]++;if(H=0,G=P,$===0)x=138,Q=3;else if(P===$)x=6,Q=3;else x=7,Q=4}}function b0(W,F,Z){var R,G=-1,P,$=F[1],H=0,x=7,Q=4;if($===0)x=138,Q=3;for(R=0;R<=Z;R++){if(P=$,$=F[(R+1)*2+1],++H<x&&P===$)continue;else if(H<Q)do Y0(W,P,W.bl_tree);while(--H!==0);else if(P!==0){if(P!==G)Y0(W,P,W.bl_tree),H--;Y0(W,F0,W.bl_tree),a(W,H-3,2)}else if(H<=10)Y0(W,f,W.bl_tree),a(W,H-3,3);else Y0(W,d,W.bl_tree),a(W,H-11,7);if(H=0,G=P,$===0)x=138,Q=3;else if(P===$)x=6,Q=3;else x=7,Q=4}}function S0(W){var F;p0(W,W.dyn_ltree,W.l_desc.max_code),p0(W,W.dyn_dtree,W.d_desc.max_code),T0(W,W.bl_desc);for(F=s-1;F>=3;F--)if(W.bl_tree[j[F]*2+1]!==0)break;return W.opt_len+=3*(F+1)+5+5+4,F}function i0(W,F,Z,R){var G;a(W,F-257,5),a(W,Z-1,5),a(W,R-4,4);for(G=0;G<R;G++)a(W,W.bl_tree[j[G]*2+1],3);b0(W,W.dyn_ltree,F-1),b0(W,W.dyn_dtree,Z-1)}function d0(W){var F=4093624447,Z;for(Z=0;Z<=31;Z++,F>>>=1)if(F&1&&W.dyn_ltree[Z*2]!==0)return L;if(W.dyn_ltree[18]!==0||W.dyn_ltree[20]!==0||W.dyn_ltree[26]!==0)return n;for(Z=32;Z<p;Z++)if(W.dyn_ltree[Z*2]!==0)return n;return L}var E0=!1;function _0(W){if(!E0)j0(),E0=!0;W.l_desc=new K0(W.dyn_ltree,H0),W.d_desc=new K0(W.dyn_dtree,N0),W.bl_desc=new K0(W.bl_tree,I0),W.bi_buf=0,W.bi_valid=0,M0(W)}function m0(W,F,Z,R){a(W,(v<<1)+(R?1:0),3),w0(W,F,Z,!0)}function B0(W){a(W,k<<1,3),Y0(W,G0,O),z0(W)}function h0(W,F,Z,R){var G,P,$=0;if(W.level>0){if(W.strm.data_type===C)W.strm.data_type=d0(W);if(T0(W,W.l_desc),T0(W,W.d_desc),$=S0(W),G=W.opt_len+3+7>>>3,P=W.static_len+3+7>>>3,P<=G)G=P}else G=P=Z+5;if(Z+4<=G&&F!==-1)m0(W,F,Z,R);else if(W.strategy===b||P===G)a(W,(k<<1)+(R?1:0),3),_(W,O,I);else a(W,(B<<1)+(R?1:0),3),i0(W,W.l_desc.max_code+1,W.d_desc.max_code+1,$+1),_(W,W.dyn_ltree,W.dyn_dtree);if(M0(W),R)c0(W)}function n0(W,F,Z){if(W.pending_buf[W.d_buf+W.last_lit*2]=F>>>8&255,W.pending_buf[W.d_buf+W.last_lit*2+1]=F&255,W.pending_buf[W.l_buf+W.last_lit]=Z&255,W.last_lit++,F===0)W.dyn_ltree[Z*2]++;else W.matches++,F--,W.dyn_ltree[(l[Z]+p+1)*2]++,W.dyn_dtree[X0(F)*2]++;return W.last_lit===W.lit_bufsize-1}Y._tr_init=_0,Y._tr_stored_block=m0,Y._tr_flush_block=h0,Y._tr_tally=n0,Y._tr_align=B0}}),Q1=A0({"node_modules/pako/lib/zlib/adler32.js"(Y,g){function b(L,n,C,w){var v=L&65535|0,k=L>>>16&65535|0,B=0;while(C!==0){B=C>2000?2000:C,C-=B;do v=v+n[w++]|0,k=k+v|0;while(--B);v%=65521,k%=65521}return v|k<<16|0}g.exports=b}}),$1=A0({"node_modules/pako/lib/zlib/crc32.js"(Y,g){function b(){var C,w=[];for(var v=0;v<256;v++){C=v;for(var k=0;k<8;k++)C=C&1?3988292384^C>>>1:C>>>1;w[v]=C}return w}var L=b();function n(C,w,v,k){var B=L,N=k+v;C^=-1;for(var y=k;y<N;y++)C=C>>>8^B[(C^w[y])&255];return C^-1}g.exports=n}}),h1=A0({"node_modules/pako/lib/zlib/messages.js"(Y,g){g.exports={2:"need dictionary",1:"stream end",0:"","-1":"file error","-2":"stream error","-3":"data error","-4":"insufficient memory","-5":"buffer error","-6":"incompatible version"}}}),f1=A0({"node_modules/pako/lib/zlib/deflate.js"(Y){var g=r0(),b=x1(),L=Q1(),n=$1(),C=h1(),w=0,v=1,k=3,B=4,N=5,y=0,m=1,p=-2,t=-3,u=-5,s=-1,W0=1,E=2,S=3,J0=4,G0=0,F0=2,f=8,d=9,z=15,h=8,V0=29,j=256,K=j+1+V0,O=30,I=19,c=2*K+1,l=15,D=3,Q0=258,i=Q0+D+1,H0=32,N0=42,I0=69,K0=73,X0=91,U0=103,a=113,Y0=666,r=1,z0=2,Z0=3,g0=4,j0=3;function M0(Q,X){return Q.msg=C[X],X}function c0(Q){return(Q<<1)-(Q>4?9:0)}function w0(Q){var X=Q.length;while(--X>=0)Q[X]=0}function v0(Q){var X=Q.state,U=X.pending;if(U>Q.avail_out)U=Q.avail_out;if(U===0)return;if(g.arraySet(Q.output,X.pending_buf,X.pending_out,U,Q.next_out),Q.next_out+=U,X.pending_out+=U,Q.total_out+=U,Q.avail_out-=U,X.pending-=U,X.pending===0)X.pending_out=0}function q0(Q,X){b._tr_flush_block(Q,Q.block_start>=0?Q.block_start:-1,Q.strstart-Q.block_start,X),Q.block_start=Q.strstart,v0(Q.strm)}function _(Q,X){Q.pending_buf[Q.pending++]=X}function T0(Q,X){Q.pending_buf[Q.pending++]=X>>>8&255,Q.pending_buf[Q.pending++]=X&255}function p0(Q,X,U,V){var J=Q.avail_in;if(J>V)J=V;if(J===0)return 0;if(Q.avail_in-=J,g.arraySet(X,Q.input,Q.next_in,J,U),Q.state.wrap===1)Q.adler=L(Q.adler,X,J,U);else if(Q.state.wrap===2)Q.adler=n(Q.adler,X,J,U);return Q.next_in+=J,Q.total_in+=J,J}function b0(Q,X){var{max_chain_length:U,strstart:V}=Q,J,q,T=Q.prev_length,M=Q.nice_match,A=Q.strstart>Q.w_size-i?Q.strstart-(Q.w_size-i):0,o=Q.window,f0=Q.w_mask,P0=Q.prev,e=Q.strstart+Q0,C0=o[V+T-1],D0=o[V+T];if(Q.prev_length>=Q.good_match)U>>=2;if(M>Q.lookahead)M=Q.lookahead;do{if(J=X,o[J+T]!==D0||o[J+T-1]!==C0||o[J]!==o[V]||o[++J]!==o[V+1])continue;V+=2,J++;do;while(o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&o[++V]===o[++J]&&V<e);if(q=Q0-(e-V),V=e-Q0,q>T){if(Q.match_start=X,T=q,q>=M)break;C0=o[V+T-1],D0=o[V+T]}}while((X=P0[X&f0])>A&&--U!==0);if(T<=Q.lookahead)return T;return Q.lookahead}function S0(Q){var X=Q.w_size,U,V,J,q,T;do{if(q=Q.window_size-Q.lookahead-Q.strstart,Q.strstart>=X+(X-i)){g.arraySet(Q.window,Q.window,X,X,0),Q.match_start-=X,Q.strstart-=X,Q.block_start-=X,V=Q.hash_size,U=V;do J=Q.head[--U],Q.head[U]=J>=X?J-X:0;while(--V);V=X,U=V;do J=Q.prev[--U],Q.prev[U]=J>=X?J-X:0;while(--V);q+=X}if(Q.strm.avail_in===0)break;if(V=p0(Q.strm,Q.window,Q.strstart+Q.lookahead,q),Q.lookahead+=V,Q.lookahead+Q.insert>=D){T=Q.strstart-Q.insert,Q.ins_h=Q.window[T],Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[T+1])&Q.hash_mask;while(Q.insert)if(Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[T+D-1])&Q.hash_mask,Q.prev[T&Q.w_mask]=Q.head[Q.ins_h],Q.head[Q.ins_h]=T,T++,Q.insert--,Q.lookahead+Q.insert<D)break}}while(Q.lookahead<i&&Q.strm.avail_in!==0)}function i0(Q,X){var U=65535;if(U>Q.pending_buf_size-5)U=Q.pending_buf_size-5;for(;;){if(Q.lookahead<=1){if(S0(Q),Q.lookahead===0&&X===w)return r;if(Q.lookahead===0)break}Q.strstart+=Q.lookahead,Q.lookahead=0;var V=Q.block_start+U;if(Q.strstart===0||Q.strstart>=V){if(Q.lookahead=Q.strstart-V,Q.strstart=V,q0(Q,!1),Q.strm.avail_out===0)return r}if(Q.strstart-Q.block_start>=Q.w_size-i){if(q0(Q,!1),Q.strm.avail_out===0)return r}}if(Q.insert=0,X===B){if(q0(Q,!0),Q.strm.avail_out===0)return Z0;return g0}if(Q.strstart>Q.block_start){if(q0(Q,!1),Q.strm.avail_out===0)return r}return r}function d0(Q,X){var U,V;for(;;){if(Q.lookahead<i){if(S0(Q),Q.lookahead<i&&X===w)return r;if(Q.lookahead===0)break}if(U=0,Q.lookahead>=D)Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[Q.strstart+D-1])&Q.hash_mask,U=Q.prev[Q.strstart&Q.w_mask]=Q.head[Q.ins_h],Q.head[Q.ins_h]=Q.strstart;if(U!==0&&Q.strstart-U<=Q.w_size-i)Q.match_length=b0(Q,U);if(Q.match_length>=D)if(V=b._tr_tally(Q,Q.strstart-Q.match_start,Q.match_length-D),Q.lookahead-=Q.match_length,Q.match_length<=Q.max_lazy_match&&Q.lookahead>=D){Q.match_length--;do Q.strstart++,Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[Q.strstart+D-1])&Q.hash_mask,U=Q.prev[Q.strstart&Q.w_mask]=Q.head[Q.ins_h],Q.head[Q.ins_h]=Q.strstart;while(--Q.match_length!==0);Q.strstart++}else Q.strstart+=Q.match_length,Q.match_length=0,Q.ins_h=Q.window[Q.strstart],Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[Q.strstart+1])&Q.hash_mask;else V=b._tr_tally(Q,0,Q.window[Q.strstart]),Q.lookahead--,Q.strstart++;if(V){if(q0(Q,!1),Q.strm.avail_out===0)return r}}if(Q.insert=Q.strstart<D-1?Q.strstart:D-1,X===B){if(q0(Q,!0),Q.strm.avail_out===0)return Z0;return g0}if(Q.last_lit){if(q0(Q,!1),Q.strm.avail_out===0)return r}return z0}function E0(Q,X){var U,V,J;for(;;){if(Q.lookahead<i){if(S0(Q),Q.lookahead<i&&X===w)return r;if(Q.lookahead===0)break}if(U=0,Q.lookahead>=D)Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[Q.strstart+D-1])&Q.hash_mask,U=Q.prev[Q.strstart&Q.w_mask]=Q.head[Q.ins_h],Q.head[Q.ins_h]=Q.strstart;if(Q.prev_length=Q.match_length,Q.prev_match=Q.match_start,Q.match_length=D-1,U!==0&&Q.prev_length<Q.max_lazy_match&&Q.strstart-U<=Q.w_size-i){if(Q.match_length=b0(Q,U),Q.match_length<=5&&(Q.strategy===W0||Q.match_length===D&&Q.strstart-Q.match_start>4096))Q.match_length=D-1}if(Q.prev_length>=D&&Q.match_length<=Q.prev_length){J=Q.strstart+Q.lookahead-D,V=b._tr_tally(Q,Q.strstart-1-Q.prev_match,Q.prev_length-D),Q.lookahead-=Q.prev_length-1,Q.prev_length-=2;do if(++Q.strstart<=J)Q.ins_h=(Q.ins_h<<Q.hash_shift^Q.window[Q.strstart+D-1])&Q.hash_mask,U=Q.prev[Q.strstart&Q.w_mask]=Q.head[Q.ins_h],Q.head[Q.ins_h]=Q.strstart;while(--Q.prev_length!==0);if(Q.match_available=0,Q.match_length=D-1,Q.strstart++,V){if(q0(Q,!1),Q.strm.avail_out===0)return r}}else if(Q.match_available){if(V=b._tr_tally(Q,0,Q.window[Q.strstart-1]),V)q0(Q,!1);if(Q.strstart++,Q.lookahead--,Q.strm.avail_out===0)return r}else Q.match_available=1,Q.strstart++,Q.lookahead--}if(Q.match_available)V=b._tr_tally(Q,0,Q.window[Q.strstart-1]),Q.match_available=0;if(Q.insert=Q.strstart<D-1?Q.strstart:D-1,X===B){if(q0(Q,!0),Q.strm.avail_out===0)return Z0;return g0}if(Q.last_lit){if(q0(Q,!1),Q.strm.avail_out===0)return r}return z0}function _0(Q,X){var U,V,J,q,T=Q.window;for(;;){if(Q.lookahead<=Q0){if(S0(Q),Q.lookahead<=Q0&&X===w)return r;if(Q.lookahead===0)break}if(Q.match_length=0,Q.lookahead>=D&&Q.strstart>0){if(J=Q.strstart-1,V=T[J],V===T[++J]&&V===T[++J]&&V===T[++J]){q=Q.strstart+Q0;do;while(V===T[++J]&&V===T[++J]&&V===T[++J]&&V===T[++J]&&V===T[++J]&&V===T[++J]&&V===T[++J]&&V===T[++J]&&J<q);if(Q.match_length=Q0-(q-J),Q.match_length>Q.lookahead)Q.match_length=Q.lookahead}}if(Q.match_length>=D)U=b._tr_tally(Q,1,Q.match_length-D),Q.lookahead-=Q.match_length,Q.strstart+=Q.match_length,Q.match_length=0;else U=b._tr_tally(Q,0,Q.window[Q.strstart]),Q.lookahead--,Q.strstart++;if(U){if(q0(Q,!1),Q.strm.avail_out===0)return r}}if(Q.insert=0,X===B){if(q0(Q,!0),Q.strm.avail_out===0)return Z0;return g0}if(Q.last_lit){if(q0(Q,!1),Q.strm.avail_out===0)return r}return z0}function m0(Q,X){var U;for(;;){if(Q.lookahead===0){if(S0(Q),Q.lookahead===0){if(X===w)return r;break}}if(Q.match_length=0,U=b._tr_tally(Q,0,Q.window[Q.strstart]),Q.lookahead--,Q.strstart++,U){if(q0(Q,!1),Q.strm.avail_out===0)return r}}if(Q.insert=0,X===B){if(q0(Q,!0),Q.strm.avail_out===0)return Z0;return g0}if(Q.last_lit){if(q0(Q,!1),Q.strm.avail_out===0)return r}return z0}function B0(Q,X,U,V,J){this.good_length=Q,this.max_lazy=X,this.nice_length=U,this.max_chain=V,this.func=J}var h0=[new B0(0,0,0,0,i0),new B0(4,4,8,4,d0),new B0(4,5,16,8,d0),new B0(4,6,32,32,d0),new B0(4,4,16,16,E0),new B0(8,16,32,32,E0),new B0(8,16,128,128,E0),new B0(8,32,128,256,E0),new B0(32,128,258,1024,E0),new B0(32,258,258,4096,E0)];function n0(Q){Q.window_size=2*Q.w_size,w0(Q.head),Q.max_lazy_match=h0[Q.level].max_lazy,Q.good_match=h0[Q.level].good_length,Q.nice_match=h0[Q.level].nice_length,Q.max_chain_length=h0[Q.level].max_chain,Q.strstart=0,Q.block_start=0,Q.lookahead=0,Q.insert=0,Q.match_length=Q.prev_length=D-1,Q.match_available=0,Q.ins_h=0}function W(){this.strm=null,this.status=0,this.pending_buf=null,this.pending_buf_size=0,this.pending_out=0,this.pending=0,this.wrap=0,this.gzhead=null,this.gzindex=0,this.method=f,this.last_flush=-1,this.w_size=0,this.w_bits=0,this.w_mask=0,this.window=null,this.window_size=0,this.prev=null,this.head=null,this.ins_h=0,this.hash_size=0,this.hash_bits=0,this.hash_mask=0,this.hash_shift=0,this.block_start=0,this.match_length=0,this.prev_match=0,this.match_available=0,this.strstart=0,this.match_start=0,this.lookahead=0,this.prev_length=0,this.max_chain_length=0,this.max_lazy_match=0,this.level=0,this.strategy=0,this.good_match=0,this.nice_match=0,this.dyn_ltree=new g.Buf16(c*2),this.dyn_dtree=new g.Buf16((2*O+1)*2),this.bl_tree=new g.Buf16((2*I+1)*2),w0(this.dyn_ltree),w0(this.dyn_dtree),w0(this.bl_tree),this.l_desc=null,this.d_desc=null,this.bl_desc=null,this.bl_count=new g.Buf16(l+1),this.heap=new g.Buf16(2*K+1),w0(this.heap),this.heap_len=0,this.heap_max=0,this.depth=new g.Buf16(2*K+1),w0(this.depth),this.l_buf=0,this.lit_bufsize=0,this.last_lit=0,this.d_buf=0,this.opt_len=0,this.static_len=0,this.matches=0,this.insert=0,this.bi_buf=0,this.bi_valid=0}function F(Q){var X;if(!Q||!Q.state)return M0(Q,p);if(Q.total_in=Q.total_out=0,Q.data_type=F0,X=Q.state,X.pending=0,X.pending_out=0,X.wrap<0)X.wrap=-X.wrap;return X.status=X.wrap?N0:a,Q.adler=X.wrap===2?0:1,X.last_flush=w,b._tr_init(X),y}function Z(Q){var X=F(Q);if(X===y)n0(Q.state);return X}function R(Q,X){if(!Q||!Q.state)return p;if(Q.state.wrap!==2)return p;return Q.state.gzhead=X,y}function G(Q,X,U,V,J,q){if(!Q)return p;var T=1;if(X===s)X=6;if(V<0)T=0,V=-V;else if(V>15)T=2,V-=16;if(J<1||J>d||U!==f||V<8||V>15||X<0||X>9||q<0||q>J0)return M0(Q,p);if(V===8)V=9;var M=new W;return Q.state=M,M.strm=Q,M.wrap=T,M.gzhead=null,M.w_bits=V,M.w_size=1<<M.w_bits,M.w_mask=M.w_size-1,M.hash_bits=J+7,M.hash_size=1<<M.hash_bits,M.hash_mask=M.hash_size-1,M.hash_shift=~~((M.hash_bits+D-1)/D),M.window=new g.Buf8(M.w_size*2),M.head=new g.Buf16(M.hash_size),M.prev=new g.Buf16(M.w_size),M.lit_bufsize=1<<J+6,M.pending_buf_size=M.lit_bufsize*4,M.pending_buf=new g.Buf8(M.pending_buf_size),M.d_buf=1*M.lit_bufsize,M.l_buf=3*M.lit_bufsize,M.level=X,M.strategy=q,M.method=U,Z(Q)}function P(Q,X){return G(Q,X,f,z,h,G0)}function $(Q,X){var U,V,J,q;if(!Q||!Q.state||X>N||X<0)return Q?M0(Q,p):p;if(V=Q.state,!Q.output||!Q.input&&Q.avail_in!==0||V.status===Y0&&X!==B)return M0(Q,Q.avail_out===0?u:p);if(V.strm=Q,U=V.last_flush,V.last_flush=X,V.status===N0)if(V.wrap===2)if(Q.adler=0,_(V,31),_(V,139),_(V,8),!V.gzhead)_(V,0),_(V,0),_(V,0),_(V,0),_(V,0),_(V,V.level===9?2:V.strategy>=E||V.level<2?4:0),_(V,j0),V.status=a;else{if(_(V,(V.gzhead.text?1:0)+(V.gzhead.hcrc?2:0)+(!V.gzhead.extra?0:4)+(!V.gzhead.name?0:8)+(!V.gzhead.comment?0:16)),_(V,V.gzhead.time&255),_(V,V.gzhead.time>>8&255),_(V,V.gzhead.time>>16&255),_(V,V.gzhead.time>>24&255),_(V,V.level===9?2:V.strategy>=E||V.level<2?4:0),_(V,V.gzhead.os&255),V.gzhead.extra&&V.gzhead.extra.length)_(V,V.gzhead.extra.length&255),_(V,V.gzhead.extra.length>>8&255);if(V.gzhead.hcrc)Q.adler=n(Q.adler,V.pending_buf,V.pending,0);V.gzindex=0,V.status=I0}else{var T=f+(V.w_bits-8<<4)<<8,M=-1;if(V.strategy>=E||V.level<2)M=0;else if(V.level<6)M=1;else if(V.level===6)M=2;else M=3;if(T|=M<<6,V.strstart!==0)T|=H0;if(T+=31-T%31,V.status=a,T0(V,T),V.strstart!==0)T0(V,Q.adler>>>16),T0(V,Q.adler&65535);Q.adler=1}if(V.status===I0)if(V.gzhead.extra){J=V.pending;while(V.gzindex<(V.gzhead.extra.length&65535)){if(V.pending===V.pending_buf_size){if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(v0(Q),J=V.pending,V.pending===V.pending_buf_size)break}_(V,V.gzhead.extra[V.gzindex]&255),V.gzindex++}if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(V.gzindex===V.gzhead.extra.length)V.gzindex=0,V.status=K0}else V.status=K0;if(V.status===K0)if(V.gzhead.name){J=V.pending;do{if(V.pending===V.pending_buf_size){if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(v0(Q),J=V.pending,V.pending===V.pending_buf_size){q=1;break}}if(V.gzindex<V.gzhead.name.length)q=V.gzhead.name.charCodeAt(V.gzindex++)&255;else q=0;_(V,q)}while(q!==0);if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(q===0)V.gzindex=0,V.status=X0}else V.status=X0;if(V.status===X0)if(V.gzhead.comment){J=V.pending;do{if(V.pending===V.pending_buf_size){if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(v0(Q),J=V.pending,V.pending===V.pending_buf_size){q=1;break}}if(V.gzindex<V.gzhead.comment.length)q=V.gzhead.comment.charCodeAt(V.gzindex++)&255;else q=0;_(V,q)}while(q!==0);if(V.gzhead.hcrc&&V.pending>J)Q.adler=n(Q.adler,V.pending_buf,V.pending-J,J);if(q===0)V.status=U0}else V.status=U0;if(V.status===U0)if(V.gzhead.hcrc){if(V.pending+2>V.pending_buf_size)v0(Q);if(V.pending+2<=V.pending_buf_size)_(V,Q.adler&255),_(V,Q.adler>>8&255),Q.adler=0,V.status=a}else V.status=a;if(V.pending!==0){if(v0(Q),Q.avail_out===0)return V.last_flush=-1,y}else if(Q.avail_in===0&&c0(X)<=c0(U)&&X!==B)return M0(Q,u);if(V.status===Y0&&Q.avail_in!==0)return M0(Q,u);if(Q.avail_in!==0||V.lookahead!==0||X!==w&&V.status!==Y0){var A=V.strategy===E?m0(V,X):V.strategy===S?_0(V,X):h0[V.level].func(V,X);if(A===Z0||A===g0)V.status=Y0;if(A===r||A===Z0){if(Q.avail_out===0)V.last_flush=-1;return y}if(A===z0){if(X===v)b._tr_align(V);else if(X!==N){if(b._tr_stored_block(V,0,0,!1),X===k){if(w0(V.head),V.lookahead===0)V.strstart=0,V.block_start=0,V.insert=0}}if(v0(Q),Q.avail_out===0)return V.last_flush=-1,y}}if(X!==B)return y;if(V.wrap<=0)return m;if(V.wrap===2)_(V,Q.adler&255),_(V,Q.adler>>8&255),_(V,Q.adler>>16&255),_(V,Q.adler>>24&255),_(V,Q.total_in&255),_(V,Q.total_in>>8&255),_(V,Q.total_in>>16&255),_(V,Q.total_in>>24&255);else T0(V,Q.adler>>>16),T0(V,Q.adler&65535);if(v0(Q),V.wrap>0)V.wrap=-V.wrap;return V.pending!==0?y:m}function H(Q){var X;if(!Q||!Q.state)return p;if(X=Q.state.status,X!==N0&&X!==I0&&X!==K0&&X!==X0&&X!==U0&&X!==a&&X!==Y0)return M0(Q,p);return Q.state=null,X===a?M0(Q,t):y}function x(Q,X){var U=X.length,V,J,q,T,M,A,o,f0;if(!Q||!Q.state)return p;if(V=Q.state,T=V.wrap,T===2||T===1&&V.status!==N0||V.lookahead)return p;if(T===1)Q.adler=L(Q.adler,X,U,0);if(V.wrap=0,U>=V.w_size){if(T===0)w0(V.head),V.strstart=0,V.block_start=0,V.insert=0;f0=new g.Buf8(V.w_size),g.arraySet(f0,X,U-V.w_size,V.w_size,0),X=f0,U=V.w_size}M=Q.avail_in,A=Q.next_in,o=Q.input,Q.avail_in=U,Q.next_in=0,Q.input=X,S0(V);while(V.lookahead>=D){J=V.strstart,q=V.lookahead-(D-1);do V.ins_h=(V.ins_h<<V.hash_shift^V.window[J+D-1])&V.hash_mask,V.prev[J&V.w_mask]=V.head[V.ins_h],V.head[V.ins_h]=J,J++;while(--q);V.strstart=J,V.lookahead=D-1,S0(V)}return V.strstart+=V.lookahead,V.block_start=V.strstart,V.insert=V.lookahead,V.lookahead=0,V.match_length=V.prev_length=D-1,V.match_available=0,Q.next_in=A,Q.input=o,Q.avail_in=M,V.wrap=T,y}Y.deflateInit=P,Y.deflateInit2=G,Y.deflateReset=Z,Y.deflateResetKeep=F,Y.deflateSetHeader=R,Y.deflate=$,Y.deflateEnd=H,Y.deflateSetDictionary=x,Y.deflateInfo="pako deflate (from Nodeca project)"}}),u1=A0({"node_modules/pako/lib/zlib/inffast.js"(Y,g){var b=30,L=12;g.exports=function n(C,w){var v,k,B,N,y,m,p,t,u,s,W0,E,S,J0,G0,F0,f,d,z,h,V0,j,K,O,I;v=C.state,k=C.next_in,O=C.input,B=k+(C.avail_in-5),N=C.next_out,I=C.output,y=N-(w-C.avail_out),m=N+(C.avail_out-257),p=v.dmax,t=v.wsize,u=v.whave,s=v.wnext,W0=v.window,E=v.hold,S=v.bits,J0=v.lencode,G0=v.distcode,F0=(1<<v.lenbits)-1,f=(1<<v.distbits)-1;Q:do{if(S<15)E+=O[k++]<<S,S+=8,E+=O[k++]<<S,S+=8;d=J0[E&F0];$:for(;;){if(z=d>>>24,E>>>=z,S-=z,z=d>>>16&255,z===0)I[N++]=d&65535;else if(z&16){if(h=d&65535,z&=15,z){if(S<z)E+=O[k++]<<S,S+=8;h+=E&(1<<z)-1,E>>>=z,S-=z}if(S<15)E+=O[k++]<<S,S+=8,E+=O[k++]<<S,S+=8;d=G0[E&f];V:for(;;){if(z=d>>>24,E>>>=z,S-=z,z=d>>>16&255,z&16){if(V0=d&65535,z&=15,S<z){if(E+=O[k++]<<S,S+=8,S<z)E+=O[k++]<<S,S+=8}if(V0+=E&(1<<z)-1,V0>p){C.msg="invalid distance too far back",v.mode=b;break Q}if(E>>>=z,S-=z,z=N-y,V0>z){if(z=V0-z,z>u){if(v.sane){C.msg="invalid distance too far back",v.mode=b;break Q}}if(j=0,K=W0,s===0){if(j+=t-z,z<h){h-=z;do I[N++]=W0[j++];while(--z);j=N-V0,K=I}}else if(s<z){if(j+=t+s-z,z-=s,z<h){h-=z;do I[N++]=W0[j++];while(--z);if(j=0,s<h){z=s,h-=z;do I[N++]=W0[j++];while(--z);j=N-V0,K=I}}}else if(j+=s-z,z<h){h-=z;do I[N++]=W0[j++];while(--z);j=N-V0,K=I}while(h>2)I[N++]=K[j++],I[N++]=K[j++],I[N++]=K[j++],h-=3;if(h){if(I[N++]=K[j++],h>1)I[N++]=K[j++]}}else{j=N-V0;do I[N++]=I[j++],I[N++]=I[j++],I[N++]=I[j++],h-=3;while(h>2);if(h){if(I[N++]=I[j++],h>1)I[N++]=I[j++]}}}else if((z&64)===0){d=G0[(d&65535)+(E&(1<<z)-1)];continue V}else{C.msg="invalid distance code",v.mode=b;break Q}break}}else if((z&64)===0){d=J0[(d&65535)+(E&(1<<z)-1)];continue $}else if(z&32){v.mode=L;break Q}else{C.msg="invalid literal/length code",v.mode=b;break Q}break}}while(k<B&&N<m);h=S>>3,k-=h,S-=h<<3,E&=(1<<S)-1,C.next_in=k,C.next_out=N,C.avail_in=k<B?5+(B-k):5-(k-B),C.avail_out=N<m?257+(m-N):257-(N-m),v.hold=E,v.bits=S;return}}}),b1=A0({"node_modules/pako/lib/zlib/inftrees.js"(Y,g){var b=r0(),L=15,n=852,C=592,w=0,v=1,k=2,B=[3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258,0,0],N=[16,16,16,16,16,16,16,16,17,17,17,17,18,18,18,18,19,19,19,19,20,20,20,20,21,21,21,21,16,72,78],y=[1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0],m=[16,16,16,16,17,17,18,18,19,19,20,20,21,21,22,22,23,23,24,24,25,25,26,26,27,27,28,28,29,29,64,64];g.exports=function p(t,u,s,W0,E,S,J0,G0){var F0=G0.bits,f=0,d=0,z=0,h=0,V0=0,j=0,K=0,O=0,I=0,c=0,l,D,Q0,i,H0,N0=null,I0=0,K0,X0=new b.Buf16(L+1),U0=new b.Buf16(L+1),a=null,Y0=0,r,z0,Z0;for(f=0;f<=L;f++)X0[f]=0;for(d=0;d<W0;d++)X0[u[s+d]]++;V0=F0;for(h=L;h>=1;h--)if(X0[h]!==0)break;if(V0>h)V0=h;if(h===0)return E[S++]=1<<24|64<<16|0,E[S++]=1<<24|64<<16|0,G0.bits=1,0;for(z=1;z<h;z++)if(X0[z]!==0)break;if(V0<z)V0=z;O=1;for(f=1;f<=L;f++)if(O<<=1,O-=X0[f],O<0)return-1;if(O>0&&(t===w||h!==1))return-1;U0[1]=0;for(f=1;f<L;f++)U0[f+1]=U0[f]+X0[f];for(d=0;d<W0;d++)if(u[s+d]!==0)J0[U0[u[s+d]]++]=d;if(t===w)N0=a=J0,K0=19;else if(t===v)N0=B,I0-=257,a=N,Y0-=257,K0=256;else N0=y,a=m,K0=-1;if(c=0,d=0,f=z,H0=S,j=V0,K=0,Q0=-1,I=1<<V0,i=I-1,t===v&&I>n||t===k&&I>C)return 1;for(;;){if(r=f-K,J0[d]<K0)z0=0,Z0=J0[d];else if(J0[d]>K0)z0=a[Y0+J0[d]],Z0=N0[I0+J0[d]];else z0=96,Z0=0;l=1<<f-K,D=1<<j,z=D;do D-=l,E[H0+(c>>K)+D]=r<<24|z0<<16|Z0|0;while(D!==0);l=1<<f-1;while(c&l)l>>=1;if(l!==0)c&=l-1,c+=l;else c=0;if(d++,--X0[f]===0){if(f===h)break;f=u[s+J0[d]]}if(f>V0&&(c&i)!==Q0){if(K===0)K=V0;H0+=z,j=f-K,O=1<<j;while(j+K<h){if(O-=X0[j+K],O<=0)break;j++,O<<=1}if(I+=1<<j,t===v&&I>n||t===k&&I>C)return 1;Q0=c&i,E[Q0]=V0<<24|j<<16|H0-S|0}}if(c!==0)E[H0+c]=f-K<<24|64<<16|0;return G0.bits=V0,0}}}),d1=A0({"node_modules/pako/lib/zlib/inflate.js"(Y){var g=r0(),b=Q1(),L=$1(),n=u1(),C=b1(),w=0,v=1,k=2,B=4,N=5,y=6,m=0,p=1,t=2,u=-2,s=-3,W0=-4,E=-5,S=8,J0=1,G0=2,F0=3,f=4,d=5,z=6,h=7,V0=8,j=9,K=10,O=11,I=12,c=13,l=14,D=15,Q0=16,i=17,H0=18,N0=19,I0=20,K0=21,X0=22,U0=23,a=24,Y0=25,r=26,z0=27,Z0=28,g0=29,j0=30,M0=31,c0=32,w0=852,v0=592,q0=15,_=q0;function T0(G){return(G>>>24&255)+(G>>>8&65280)+((G&65280)<<8)+((G&255)<<24)}function p0(){this.mode=0,this.last=!1,this.wrap=0,this.havedict=!1,this.flags=0,this.dmax=0,this.check=0,this.total=0,this.head=null,this.wbits=0,this.wsize=0,this.whave=0,this.wnext=0,this.window=null,this.hold=0,this.bits=0,this.length=0,this.offset=0,this.extra=0,this.lencode=null,this.distcode=null,this.lenbits=0,this.distbits=0,this.ncode=0,this.nlen=0,this.ndist=0,this.have=0,this.next=null,this.lens=new g.Buf16(320),this.work=new g.Buf16(288),this.lendyn=null,this.distdyn=null,this.sane=0,this.back=0,this.was=0}function b0(G){var P;if(!G||!G.state)return u;if(P=G.state,G.total_in=G.total_out=P.total=0,G.msg="",P.wrap)G.adler=P.wrap&1;return P.mode=J0,P.last=0,P.havedict=0,P.dmax=32768,P.head=null,P.hold=0,P.bits=0,P.lencode=P.lendyn=new g.Buf32(w0),P.distcode=P.distdyn=new g.Buf32(v0),P.sane=1,P.back=-1,m}function S0(G){var P;if(!G||!G.state)return u;return P=G.state,P.wsize=0,P.whave=0,P.wnext=0,b0(G)}function i0(G,P){var $,H;if(!G||!G.state)return u;if(H=G.state,P<0)$=0,P=-P;else if($=(P>>4)+1,P<48)P&=15;if(P&&(P<8||P>15))return u;if(H.window!==null&&H.wbits!==P)H.window=null;return H.wrap=$,H.wbits=P,S0(G)}function d0(G,P){var $,H;if(!G)return u;if(H=new p0,G.state=H,H.window=null,$=i0(G,P),$!==m)G.state=null;return $}function E0(G){return d0(G,_)}var _0=!0,m0,B0;function h0(G){if(_0){var P;m0=new g.Buf32(512),B0=new g.Buf32(32),P=0;while(P<144)G.lens[P++]=8;while(P<256)G.lens[P++]=9;while(P<280)G.lens[P++]=7;while(P<288)G.lens[P++]=8;C(v,G.lens,0,288,m0,0,G.work,{bits:9}),P=0;while(P<32)G.lens[P++]=5;C(k,G.lens,0,32,B0,0,G.work,{bits:5}),_0=!1}G.lencode=m0,G.lenbits=9,G.distcode=B0,G.distbits=5}function n0(G,P,$,H){var x,Q=G.state;if(Q.window===null)Q.wsize=1<<Q.wbits,Q.wnext=0,Q.whave=0,Q.window=new g.Buf8(Q.wsize);if(H>=Q.wsize)g.arraySet(Q.window,P,$-Q.wsize,Q.wsize,0),Q.wnext=0,Q.whave=Q.wsize;else{if(x=Q.wsize-Q.wnext,x>H)x=H;if(g.arraySet(Q.window,P,$-H,x,Q.wnext),H-=x,H)g.arraySet(Q.window,P,$-H,H,0),Q.wnext=H,Q.whave=Q.wsize;else{if(Q.wnext+=x,Q.wnext===Q.wsize)Q.wnext=0;if(Q.whave<Q.wsize)Q.whave+=x}}return 0}function W(G,P){var $,H,x,Q,X,U,V,J,q,T,M,A,o,f0,P0=0,e,C0,D0,k0,a0,l0,L0,y0,O0=new g.Buf8(4),u0,x0,e0=[16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15];if(!G||!G.state||!G.output||!G.input&&G.avail_in!==0)return u;if($=G.state,$.mode===I)$.mode=c;X=G.next_out,x=G.output,V=G.avail_out,Q=G.next_in,H=G.input,U=G.avail_in,J=$.hold,q=$.bits,T=U,M=V,y0=m;Q:for(;;)switch($.mode){case J0:if($.wrap===0){$.mode=c;break}while(q<16){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.wrap&2&&J===35615){$.check=0,O0[0]=J&255,O0[1]=J>>>8&255,$.check=L($.check,O0,2,0),J=0,q=0,$.mode=G0;break}if($.flags=0,$.head)$.head.done=!1;if(!($.wrap&1)||(((J&255)<<8)+(J>>8))%31){G.msg="incorrect header check",$.mode=j0;break}if((J&15)!==S){G.msg="unknown compression method",$.mode=j0;break}if(J>>>=4,q-=4,L0=(J&15)+8,$.wbits===0)$.wbits=L0;else if(L0>$.wbits){G.msg="invalid window size",$.mode=j0;break}$.dmax=1<<L0,G.adler=$.check=1,$.mode=J&512?K:I,J=0,q=0;break;case G0:while(q<16){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.flags=J,($.flags&255)!==S){G.msg="unknown compression method",$.mode=j0;break}if($.flags&57344){G.msg="unknown header flags set",$.mode=j0;break}if($.head)$.head.text=J>>8&1;if($.flags&512)O0[0]=J&255,O0[1]=J>>>8&255,$.check=L($.check,O0,2,0);J=0,q=0,$.mode=F0;case F0:while(q<32){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.head)$.head.time=J;if($.flags&512)O0[0]=J&255,O0[1]=J>>>8&255,O0[2]=J>>>16&255,O0[3]=J>>>24&255,$.check=L($.check,O0,4,0);J=0,q=0,$.mode=f;case f:while(q<16){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.head)$.head.xflags=J&255,$.head.os=J>>8;if($.flags&512)O0[0]=J&255,O0[1]=J>>>8&255,$.check=L($.check,O0,2,0);J=0,q=0,$.mode=d;case d:if($.flags&1024){while(q<16){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.length=J,$.head)$.head.extra_len=J;if($.flags&512)O0[0]=J&255,O0[1]=J>>>8&255,$.check=L($.check,O0,2,0);J=0,q=0}else if($.head)$.head.extra=null;$.mode=z;case z:if($.flags&1024){if(A=$.length,A>U)A=U;if(A){if($.head){if(L0=$.head.extra_len-$.length,!$.head.extra)$.head.extra=new Array($.head.extra_len);g.arraySet($.head.extra,H,Q,A,L0)}if($.flags&512)$.check=L($.check,H,A,Q);U-=A,Q+=A,$.length-=A}if($.length)break Q}$.length=0,$.mode=h;case h:if($.flags&2048){if(U===0)break Q;A=0;do if(L0=H[Q+A++],$.head&&L0&&$.length<65536)$.head.name+=String.fromCharCode(L0);while(L0&&A<U);if($.flags&512)$.check=L($.check,H,A,Q);if(U-=A,Q+=A,L0)break Q}else if($.head)$.head.name=null;$.length=0,$.mode=V0;case V0:if($.flags&4096){if(U===0)break Q;A=0;do if(L0=H[Q+A++],$.head&&L0&&$.length<65536)$.head.comment+=String.fromCharCode(L0);while(L0&&A<U);if($.flags&512)$.check=L($.check,H,A,Q);if(U-=A,Q+=A,L0)break Q}else if($.head)$.head.comment=null;$.mode=j;case j:if($.flags&512){while(q<16){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if(J!==($.check&65535)){G.msg="header crc mismatch",$.mode=j0;break}J=0,q=0}if($.head)$.head.hcrc=$.flags>>9&1,$.head.done=!0;G.adler=$.check=0,$.mode=I;break;case K:while(q<32){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}G.adler=$.check=T0(J),J=0,q=0,$.mode=O;case O:if($.havedict===0)return G.next_out=X,G.avail_out=V,G.next_in=Q,G.avail_in=U,$.hold=J,$.bits=q,t;G.adler=$.check=1,$.mode=I;case I:if(P===N||P===y)break Q;case c:if($.last){J>>>=q&7,q-=q&7,$.mode=z0;break}while(q<3){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}switch($.last=J&1,J>>>=1,q-=1,J&3){case 0:$.mode=l;break;case 1:if(h0($),$.mode=I0,P===y){J>>>=2,q-=2;break Q}break;case 2:$.mode=i;break;case 3:G.msg="invalid block type",$.mode=j0}J>>>=2,q-=2;break;case l:J>>>=q&7,q-=q&7;while(q<32){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if((J&65535)!==(J>>>16^65535)){G.msg="invalid stored block lengths",$.mode=j0;break}if($.length=J&65535,J=0,q=0,$.mode=D,P===y)break Q;case D:$.mode=Q0;case Q0:if(A=$.length,A){if(A>U)A=U;if(A>V)A=V;if(A===0)break Q;g.arraySet(x,H,Q,A,X),U-=A,Q+=A,V-=A,X+=A,$.length-=A;break}$.mode=I;break;case i:while(q<14){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if($.nlen=(J&31)+257,J>>>=5,q-=5,$.ndist=(J&31)+1,J>>>=5,q-=5,$.ncode=(J&15)+4,J>>>=4,q-=4,$.nlen>286||$.ndist>30){G.msg="too many length or distance symbols",$.mode=j0;break}$.have=0,$.mode=H0;case H0:while($.have<$.ncode){while(q<3){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}$.lens[e0[$.have++]]=J&7,J>>>=3,q-=3}while($.have<19)$.lens[e0[$.have++]]=0;if($.lencode=$.lendyn,$.lenbits=7,u0={bits:$.lenbits},y0=C(w,$.lens,0,19,$.lencode,0,$.work,u0),$.lenbits=u0.bits,y0){G.msg="invalid code lengths set",$.mode=j0;break}$.have=0,$.mode=N0;case N0:while($.have<$.nlen+$.ndist){for(;;){if(P0=$.lencode[J&(1<<$.lenbits)-1],e=P0>>>24,C0=P0>>>16&255,D0=P0&65535,e<=q)break;if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if(D0<16)J>>>=e,q-=e,$.lens[$.have++]=D0;else{if(D0===16){x0=e+2;while(q<x0){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if(J>>>=e,q-=e,$.have===0){G.msg="invalid bit length repeat",$.mode=j0;break}L0=$.lens[$.have-1],A=3+(J&3),J>>>=2,q-=2}else if(D0===17){x0=e+3;while(q<x0){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}J>>>=e,q-=e,L0=0,A=3+(J&7),J>>>=3,q-=3}else{x0=e+7;while(q<x0){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}J>>>=e,q-=e,L0=0,A=11+(J&127),J>>>=7,q-=7}if($.have+A>$.nlen+$.ndist){G.msg="invalid bit length repeat",$.mode=j0;break}while(A--)$.lens[$.have++]=L0}}if($.mode===j0)break;if($.lens[256]===0){G.msg="invalid code -- missing end-of-block",$.mode=j0;break}if($.lenbits=9,u0={bits:$.lenbits},y0=C(v,$.lens,0,$.nlen,$.lencode,0,$.work,u0),$.lenbits=u0.bits,y0){G.msg="invalid literal/lengths set",$.mode=j0;break}if($.distbits=6,$.distcode=$.distdyn,u0={bits:$.distbits},y0=C(k,$.lens,$.nlen,$.ndist,$.distcode,0,$.work,u0),$.distbits=u0.bits,y0){G.msg="invalid distances set",$.mode=j0;break}if($.mode=I0,P===y)break Q;case I0:$.mode=K0;case K0:if(U>=6&&V>=258){if(G.next_out=X,G.avail_out=V,G.next_in=Q,G.avail_in=U,$.hold=J,$.bits=q,n(G,M),X=G.next_out,x=G.output,V=G.avail_out,Q=G.next_in,H=G.input,U=G.avail_in,J=$.hold,q=$.bits,$.mode===I)$.back=-1;break}$.back=0;for(;;){if(P0=$.lencode[J&(1<<$.lenbits)-1],e=P0>>>24,C0=P0>>>16&255,D0=P0&65535,e<=q)break;if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if(C0&&(C0&240)===0){k0=e,a0=C0,l0=D0;for(;;){if(P0=$.lencode[l0+((J&(1<<k0+a0)-1)>>k0)],e=P0>>>24,C0=P0>>>16&255,D0=P0&65535,k0+e<=q)break;if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}J>>>=k0,q-=k0,$.back+=k0}if(J>>>=e,q-=e,$.back+=e,$.length=D0,C0===0){$.mode=r;break}if(C0&32){$.back=-1,$.mode=I;break}if(C0&64){G.msg="invalid literal/length code",$.mode=j0;break}$.extra=C0&15,$.mode=X0;case X0:if($.extra){x0=$.extra;while(q<x0){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}$.length+=J&(1<<$.extra)-1,J>>>=$.extra,q-=$.extra,$.back+=$.extra}$.was=$.length,$.mode=U0;case U0:for(;;){if(P0=$.distcode[J&(1<<$.distbits)-1],e=P0>>>24,C0=P0>>>16&255,D0=P0&65535,e<=q)break;if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if((C0&240)===0){k0=e,a0=C0,l0=D0;for(;;){if(P0=$.distcode[l0+((J&(1<<k0+a0)-1)>>k0)],e=P0>>>24,C0=P0>>>16&255,D0=P0&65535,k0+e<=q)break;if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}J>>>=k0,q-=k0,$.back+=k0}if(J>>>=e,q-=e,$.back+=e,C0&64){G.msg="invalid distance code",$.mode=j0;break}$.offset=D0,$.extra=C0&15,$.mode=a;case a:if($.extra){x0=$.extra;while(q<x0){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}$.offset+=J&(1<<$.extra)-1,J>>>=$.extra,q-=$.extra,$.back+=$.extra}if($.offset>$.dmax){G.msg="invalid distance too far back",$.mode=j0;break}$.mode=Y0;case Y0:if(V===0)break Q;if(A=M-V,$.offset>A){if(A=$.offset-A,A>$.whave){if($.sane){G.msg="invalid distance too far back",$.mode=j0;break}}if(A>$.wnext)A-=$.wnext,o=$.wsize-A;else o=$.wnext-A;if(A>$.length)A=$.length;f0=$.window}else f0=x,o=X-$.offset,A=$.length;if(A>V)A=V;V-=A,$.length-=A;do x[X++]=f0[o++];while(--A);if($.length===0)$.mode=K0;break;case r:if(V===0)break Q;x[X++]=$.length,V--,$.mode=K0;break;case z0:if($.wrap){while(q<32){if(U===0)break Q;U--,J|=H[Q++]<<q,q+=8}if(M-=V,G.total_out+=M,$.total+=M,M)G.adler=$.check=$.flags?L($.check,x,M,X-M):b($.check,x,M,X-M);if(M=V,($.flags?J:T0(J))!==$.check){G.msg="incorrect data check",$.mode=j0;break}J=0,q=0}$.mode=Z0;case Z0:if($.wrap&&$.flags){while(q<32){if(U===0)break Q;U--,J+=H[Q++]<<q,q+=8}if(J!==($.total&4294967295)){G.msg="incorrect length check",$.mode=j0;break}J=0,q=0}$.mode=g0;case g0:y0=p;break Q;case j0:y0=s;break Q;case M0:return W0;case c0:default:return u}if(G.next_out=X,G.avail_out=V,G.next_in=Q,G.avail_in=U,$.hold=J,$.bits=q,$.wsize||M!==G.avail_out&&$.mode<j0&&($.mode<z0||P!==B)){if(n0(G,G.output,G.next_out,M-G.avail_out))return $.mode=M0,W0}if(T-=G.avail_in,M-=G.avail_out,G.total_in+=T,G.total_out+=M,$.total+=M,$.wrap&&M)G.adler=$.check=$.flags?L($.check,x,M,G.next_out-M):b($.check,x,M,G.next_out-M);if(G.data_type=$.bits+($.last?64:0)+($.mode===I?128:0)+($.mode===I0||$.mode===D?256:0),(T===0&&M===0||P===B)&&y0===m)y0=E;return y0}function F(G){if(!G||!G.state)return u;var P=G.state;if(P.window)P.window=null;return G.state=null,m}function Z(G,P){var $;if(!G||!G.state)return u;if($=G.state,($.wrap&2)===0)return u;return $.head=P,P.done=!1,m}function R(G,P){var $=P.length,H,x,Q;if(!G||!G.state)return u;if(H=G.state,H.wrap!==0&&H.mode!==O)return u;if(H.mode===O){if(x=1,x=b(x,P,$,0),x!==H.check)return s}if(Q=n0(G,P,$,$),Q)return H.mode=M0,W0;return H.havedict=1,m}Y.inflateReset=S0,Y.inflateReset2=i0,Y.inflateResetKeep=b0,Y.inflateInit=E0,Y.inflateInit2=d0,Y.inflate=W,Y.inflateEnd=F,Y.inflateGetHeader=Z,Y.inflateSetDictionary=R,Y.inflateInfo="pako inflate (from Nodeca project)"}}),V1=A0({"node_modules/pako/lib/zlib/constants.js"(Y,g){g.exports={Z_NO_FLUSH:0,Z_PARTIAL_FLUSH:1,Z_SYNC_FLUSH:2,Z_FULL_FLUSH:3,Z_FINISH:4,Z_BLOCK:5,Z_TREES:6,Z_OK:0,Z_STREAM_END:1,Z_NEED_DICT:2,Z_ERRNO:-1,Z_STREAM_ERROR:-2,Z_DATA_ERROR:-3,Z_BUF_ERROR:-5,Z_NO_COMPRESSION:0,Z_BEST_SPEED:1,Z_BEST_COMPRESSION:9,Z_DEFAULT_COMPRESSION:-1,Z_FILTERED:1,Z_HUFFMAN_ONLY:2,Z_RLE:3,Z_FIXED:4,Z_DEFAULT_STRATEGY:0,Z_BINARY:0,Z_TEXT:1,Z_UNKNOWN:2,Z_DEFLATED:8}}}),m1=A0({"node_modules/browserify-zlib/lib/binding.js"(Y){var g=E1(),b=f1(),L=d1(),n=V1();for(C in n)Y[C]=n[C];var C;Y.NONE=0,Y.DEFLATE=1,Y.INFLATE=2,Y.GZIP=3,Y.GUNZIP=4,Y.DEFLATERAW=5,Y.INFLATERAW=6,Y.UNZIP=7;var w=31,v=139;function k(B){if(typeof B!=="number"||B<Y.DEFLATE||B>Y.UNZIP)throw new TypeError("Bad argument");this.dictionary=null,this.err=0,this.flush=0,this.init_done=!1,this.level=0,this.memLevel=0,this.mode=B,this.strategy=0,this.windowBits=0,this.write_in_progress=!1,this.pending_close=!1,this.gzip_id_bytes_read=0}k.prototype.close=function(){if(this.write_in_progress){this.pending_close=!0;return}if(this.pending_close=!1,R0(this.init_done,"close before init"),R0(this.mode<=Y.UNZIP),this.mode===Y.DEFLATE||this.mode===Y.GZIP||this.mode===Y.DEFLATERAW)b.deflateEnd(this.strm);else if(this.mode===Y.INFLATE||this.mode===Y.GUNZIP||this.mode===Y.INFLATERAW||this.mode===Y.UNZIP)L.inflateEnd(this.strm);this.mode=Y.NONE,this.dictionary=null},k.prototype.write=function(B,N,y,m,p,t,u){return this._write(!0,B,N,y,m,p,t,u)},k.prototype.writeSync=function(B,N,y,m,p,t,u){return this._write(!1,B,N,y,m,p,t,u)},k.prototype._write=function(B,N,y,m,p,t,u,s){if(R0.equal(arguments.length,8),R0(this.init_done,"write before init"),R0(this.mode!==Y.NONE,"already finalized"),R0.equal(!1,this.write_in_progress,"write already in progress"),R0.equal(!1,this.pending_close,"close is pending"),this.write_in_progress=!0,R0.equal(!1,N===void 0,"must provide flush value"),this.write_in_progress=!0,N!==Y.Z_NO_FLUSH&&N!==Y.Z_PARTIAL_FLUSH&&N!==Y.Z_SYNC_FLUSH&&N!==Y.Z_FULL_FLUSH&&N!==Y.Z_FINISH&&N!==Y.Z_BLOCK)throw new Error("Invalid flush value");if(y==null)y=Buffer.alloc(0),p=0,m=0;if(this.strm.avail_in=p,this.strm.input=y,this.strm.next_in=m,this.strm.avail_out=s,this.strm.output=t,this.strm.next_out=u,this.flush=N,!B){if(this._process(),this._checkError())return this._afterSync();return}var W0=this;return process.nextTick(function(){W0._process(),W0._after()}),this},k.prototype._afterSync=function(){var B=this.strm.avail_out,N=this.strm.avail_in;return this.write_in_progress=!1,[N,B]},k.prototype._process=function(){var B=null;switch(this.mode){case Y.DEFLATE:case Y.GZIP:case Y.DEFLATERAW:this.err=b.deflate(this.strm,this.flush);break;case Y.UNZIP:if(this.strm.avail_in>0)B=this.strm.next_in;switch(this.gzip_id_bytes_read){case 0:if(B===null)break;if(this.strm.input[B]===w){if(this.gzip_id_bytes_read=1,B++,this.strm.avail_in===1)break}else{this.mode=Y.INFLATE;break}case 1:if(B===null)break;if(this.strm.input[B]===v)this.gzip_id_bytes_read=2,this.mode=Y.GUNZIP;else this.mode=Y.INFLATE;break;default:throw new Error("invalid number of gzip magic number bytes read")}case Y.INFLATE:case Y.GUNZIP:case Y.INFLATERAW:if(this.err=L.inflate(this.strm,this.flush),this.err===Y.Z_NEED_DICT&&this.dictionary){if(this.err=L.inflateSetDictionary(this.strm,this.dictionary),this.err===Y.Z_OK)this.err=L.inflate(this.strm,this.flush);else if(this.err===Y.Z_DATA_ERROR)this.err=Y.Z_NEED_DICT}while(this.strm.avail_in>0&&this.mode===Y.GUNZIP&&this.err===Y.Z_STREAM_END&&this.strm.next_in[0]!==0)this.reset(),this.err=L.inflate(this.strm,this.flush);break;default:throw new Error("Unknown mode "+this.mode)}},k.prototype._checkError=function(){switch(this.err){case Y.Z_OK:case Y.Z_BUF_ERROR:if(this.strm.avail_out!==0&&this.flush===Y.Z_FINISH)return this._error("unexpected end of file"),!1;break;case Y.Z_STREAM_END:break;case Y.Z_NEED_DICT:if(this.dictionary==null)this._error("Missing dictionary");else this._error("Bad dictionary");return!1;default:return this._error("Zlib error"),!1}return!0},k.prototype._after=function(){if(!this._checkError())return;var B=this.strm.avail_out,N=this.strm.avail_in;if(this.write_in_progress=!1,this.callback(N,B),this.pending_close)this.close()},k.prototype._error=function(B){if(this.strm.msg)B=this.strm.msg;if(this.onerror(B,this.err),this.write_in_progress=!1,this.pending_close)this.close()},k.prototype.init=function(B,N,y,m,p){R0(arguments.length===4||arguments.length===5,"init(windowBits, level, memLevel, strategy, [dictionary])"),R0(B>=8&&B<=15,"invalid windowBits"),R0(N>=-1&&N<=9,"invalid compression level"),R0(y>=1&&y<=9,"invalid memlevel"),R0(m===Y.Z_FILTERED||m===Y.Z_HUFFMAN_ONLY||m===Y.Z_RLE||m===Y.Z_FIXED||m===Y.Z_DEFAULT_STRATEGY,"invalid strategy"),this._init(N,B,y,m,p),this._setDictionary()},k.prototype.params=function(){throw new Error("deflateParams Not supported")},k.prototype.reset=function(){this._reset(),this._setDictionary()},k.prototype._init=function(B,N,y,m,p){if(this.level=B,this.windowBits=N,this.memLevel=y,this.strategy=m,this.flush=Y.Z_NO_FLUSH,this.err=Y.Z_OK,this.mode===Y.GZIP||this.mode===Y.GUNZIP)this.windowBits+=16;if(this.mode===Y.UNZIP)this.windowBits+=32;if(this.mode===Y.DEFLATERAW||this.mode===Y.INFLATERAW)this.windowBits=-1*this.windowBits;switch(this.strm=new g,this.mode){case Y.DEFLATE:case Y.GZIP:case Y.DEFLATERAW:this.err=b.deflateInit2(this.strm,this.level,Y.Z_DEFLATED,this.windowBits,this.memLevel,this.strategy);break;case Y.INFLATE:case Y.GUNZIP:case Y.INFLATERAW:case Y.UNZIP:this.err=L.inflateInit2(this.strm,this.windowBits);break;default:throw new Error("Unknown mode "+this.mode)}if(this.err!==Y.Z_OK)this._error("Init error");this.dictionary=p,this.write_in_progress=!1,this.init_done=!0},k.prototype._setDictionary=function(){if(this.dictionary==null)return;switch(this.err=Y.Z_OK,this.mode){case Y.DEFLATE:case Y.DEFLATERAW:this.err=b.deflateSetDictionary(this.strm,this.dictionary);break;default:break}if(this.err!==Y.Z_OK)this._error("Failed to set dictionary")},k.prototype._reset=function(){switch(this.err=Y.Z_OK,this.mode){case Y.DEFLATE:case Y.DEFLATERAW:case Y.GZIP:this.err=b.deflateReset(this.strm);break;case Y.INFLATE:case Y.INFLATERAW:case Y.GUNZIP:this.err=L.inflateReset(this.strm);break;default:break}if(this.err!==Y.Z_OK)this._error("Failed to reset stream")},Y.Zlib=k}}),c1=A0({"node_modules/browserify-zlib/lib/index.js"(Y){var g=o0.Buffer,b=s0.Transform,L=m1(),n=W1,C=t0.ok,w=o0.kMaxLength,v="Cannot create final Buffer. It would be larger than 0x"+w.toString(16)+" bytes";L.Z_MIN_WINDOWBITS=8,L.Z_MAX_WINDOWBITS=15,L.Z_DEFAULT_WINDOWBITS=15,L.Z_MIN_CHUNK=64,L.Z_MAX_CHUNK=Infinity,L.Z_DEFAULT_CHUNK=16384,L.Z_MIN_MEMLEVEL=1,L.Z_MAX_MEMLEVEL=9,L.Z_DEFAULT_MEMLEVEL=8,L.Z_MIN_LEVEL=-1,L.Z_MAX_LEVEL=9,L.Z_DEFAULT_LEVEL=L.Z_DEFAULT_COMPRESSION;var k=Object.keys(L);for(N=0;N<k.length;N++)if(B=k[N],B.match(/^Z/))Object.defineProperty(Y,B,{enumerable:!0,value:L[B],writable:!1});var B,N,y={Z_OK:L.Z_OK,Z_STREAM_END:L.Z_STREAM_END,Z_NEED_DICT:L.Z_NEED_DICT,Z_ERRNO:L.Z_ERRNO,Z_STREAM_ERROR:L.Z_STREAM_ERROR,Z_DATA_ERROR:L.Z_DATA_ERROR,Z_MEM_ERROR:L.Z_MEM_ERROR,Z_BUF_ERROR:L.Z_BUF_ERROR,Z_VERSION_ERROR:L.Z_VERSION_ERROR},m=Object.keys(y);for(t=0;t<m.length;t++)p=m[t],y[y[p]]=p;var p,t;Object.defineProperty(Y,"codes",{enumerable:!0,value:Object.freeze(y),writable:!1}),Y.constants=V1(),Y.Deflate=W0,Y.Inflate=E,Y.Gzip=S,Y.Gunzip=J0,Y.DeflateRaw=G0,Y.InflateRaw=F0,Y.Unzip=f,Y.createDeflate=function(j){return new W0(j)},Y.createInflate=function(j){return new E(j)},Y.createDeflateRaw=function(j){return new G0(j)},Y.createInflateRaw=function(j){return new F0(j)},Y.createGzip=function(j){return new S(j)},Y.createGunzip=function(j){return new J0(j)},Y.createUnzip=function(j){return new f(j)},Y.deflate=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new W0(K),j,O)},Y.deflateSync=function(j,K){return s(new W0(K),j)},Y.gzip=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new S(K),j,O)},Y.gzipSync=function(j,K){return s(new S(K),j)},Y.deflateRaw=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new G0(K),j,O)},Y.deflateRawSync=function(j,K){return s(new G0(K),j)},Y.unzip=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new f(K),j,O)},Y.unzipSync=function(j,K){return s(new f(K),j)},Y.inflate=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new E(K),j,O)},Y.inflateSync=function(j,K){return s(new E(K),j)},Y.gunzip=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new J0(K),j,O)},Y.gunzipSync=function(j,K){return s(new J0(K),j)},Y.inflateRaw=function(j,K,O){if(typeof K==="function")O=K,K={};return u(new F0(K),j,O)},Y.inflateRawSync=function(j,K){return s(new F0(K),j)};function u(j,K,O){var I=[],c=0;j.on("error",D),j.on("end",Q0),j.end(K),l();function l(){var i;while((i=j.read())!==null)I.push(i),c+=i.length;j.once("readable",l)}function D(i){j.removeListener("end",Q0),j.removeListener("readable",l),O(i)}function Q0(){var i,H0=null;if(c>=w)H0=new RangeError(v);else i=g.concat(I,c);I=[],j.close(),O(H0,i)}}function s(j,K){if(typeof K==="string")K=g.from(K);if(!g.isBuffer(K))throw new TypeError("Not a string or buffer");var O=j._finishFlushFlag;return j._processChunk(K,O)}function W0(j){if(!(this instanceof W0))return new W0(j);z.call(this,j,L.DEFLATE)}function E(j){if(!(this instanceof E))return new E(j);z.call(this,j,L.INFLATE)}function S(j){if(!(this instanceof S))return new S(j);z.call(this,j,L.GZIP)}function J0(j){if(!(this instanceof J0))return new J0(j);z.call(this,j,L.GUNZIP)}function G0(j){if(!(this instanceof G0))return new G0(j);z.call(this,j,L.DEFLATERAW)}function F0(j){if(!(this instanceof F0))return new F0(j);z.call(this,j,L.INFLATERAW)}function f(j){if(!(this instanceof f))return new f(j);z.call(this,j,L.UNZIP)}function d(j){return j===L.Z_NO_FLUSH||j===L.Z_PARTIAL_FLUSH||j===L.Z_SYNC_FLUSH||j===L.Z_FULL_FLUSH||j===L.Z_FINISH||j===L.Z_BLOCK}function z(j,K){var O=this;if(this._opts=j=j||{},this._chunkSize=j.chunkSize||Y.Z_DEFAULT_CHUNK,b.call(this,j),j.flush&&!d(j.flush))throw new Error("Invalid flush flag: "+j.flush);if(j.finishFlush&&!d(j.finishFlush))throw new Error("Invalid flush flag: "+j.finishFlush);if(this._flushFlag=j.flush||L.Z_NO_FLUSH,this._finishFlushFlag=typeof j.finishFlush!=="undefined"?j.finishFlush:L.Z_FINISH,j.chunkSize){if(j.chunkSize<Y.Z_MIN_CHUNK||j.chunkSize>Y.Z_MAX_CHUNK)throw new Error("Invalid chunk size: "+j.chunkSize)}if(j.windowBits){if(j.windowBits<Y.Z_MIN_WINDOWBITS||j.windowBits>Y.Z_MAX_WINDOWBITS)throw new Error("Invalid windowBits: "+j.windowBits)}if(j.level){if(j.level<Y.Z_MIN_LEVEL||j.level>Y.Z_MAX_LEVEL)throw new Error("Invalid compression level: "+j.level)}if(j.memLevel){if(j.memLevel<Y.Z_MIN_MEMLEVEL||j.memLevel>Y.Z_MAX_MEMLEVEL)throw new Error("Invalid memLevel: "+j.memLevel)}if(j.strategy){if(j.strategy!=Y.Z_FILTERED&&j.strategy!=Y.Z_HUFFMAN_ONLY&&j.strategy!=Y.Z_RLE&&j.strategy!=Y.Z_FIXED&&j.strategy!=Y.Z_DEFAULT_STRATEGY)throw new Error("Invalid strategy: "+j.strategy)}if(j.dictionary){if(!g.isBuffer(j.dictionary))throw new Error("Invalid dictionary: it should be a Buffer instance")}this._handle=new L.Zlib(K);var I=this;this._hadError=!1,this._handle.onerror=function(D,Q0){h(I),I._hadError=!0;var i=new Error(D);i.errno=Q0,i.code=Y.codes[Q0],I.emit("error",i)};var c=Y.Z_DEFAULT_COMPRESSION;if(typeof j.level==="number")c=j.level;var l=Y.Z_DEFAULT_STRATEGY;if(typeof j.strategy==="number")l=j.strategy;this._handle.init(j.windowBits||Y.Z_DEFAULT_WINDOWBITS,c,j.memLevel||Y.Z_DEFAULT_MEMLEVEL,l,j.dictionary),this._buffer=g.allocUnsafe(this._chunkSize),this._offset=0,this._level=c,this._strategy=l,this.once("end",this.close),Object.defineProperty(this,"_closed",{get:function(){return!O._handle},configurable:!0,enumerable:!0})}n.inherits(z,b),z.prototype.params=function(j,K,O){if(j<Y.Z_MIN_LEVEL||j>Y.Z_MAX_LEVEL)throw new RangeError("Invalid compression level: "+j);if(K!=Y.Z_FILTERED&&K!=Y.Z_HUFFMAN_ONLY&&K!=Y.Z_RLE&&K!=Y.Z_FIXED&&K!=Y.Z_DEFAULT_STRATEGY)throw new TypeError("Invalid strategy: "+K);if(this._level!==j||this._strategy!==K){var I=this;this.flush(L.Z_SYNC_FLUSH,function(){if(C(I._handle,"zlib binding closed"),I._handle.params(j,K),!I._hadError){if(I._level=j,I._strategy=K,O)O()}})}else process.nextTick(O)},z.prototype.reset=function(){return C(this._handle,"zlib binding closed"),this._handle.reset()},z.prototype._flush=function(j){this._transform(g.alloc(0),"",j)},z.prototype.flush=function(j,K){var O=this,I=this._writableState;if(typeof j==="function"||j===void 0&&!K)K=j,j=L.Z_FULL_FLUSH;if(I.ended){if(K)process.nextTick(K)}else if(I.ending){if(K)this.once("end",K)}else if(I.needDrain){if(K)this.once("drain",function(){return O.flush(j,K)})}else this._flushFlag=j,this.write(g.alloc(0),"",K)},z.prototype.close=function(j){h(this,j),process.nextTick(V0,this)};function h(j,K){if(K)process.nextTick(K);if(!j._handle)return;j._handle.close(),j._handle=null}function V0(j){j.emit("close")}z.prototype._transform=function(j,K,O){var I,c=this._writableState,l=c.ending||c.ended,D=l&&(!j||c.length===j.length);if(j!==null&&!g.isBuffer(j))return O(new Error("invalid input"));if(!this._handle)return O(new Error("zlib binding closed"));if(D)I=this._finishFlushFlag;else if(I=this._flushFlag,j.length>=c.length)this._flushFlag=this._opts.flush||L.Z_NO_FLUSH;this._processChunk(j,I,O)},z.prototype._processChunk=function(j,K,O){var I=j&&j.length,c=this._chunkSize-this._offset,l=0,D=this,Q0=typeof O==="function";if(!Q0){var i=[],H0=0,N0;this.on("error",function(a){N0=a}),C(this._handle,"zlib binding closed");do var I0=this._handle.writeSync(K,j,l,I,this._buffer,this._offset,c);while(!this._hadError&&U0(I0[0],I0[1]));if(this._hadError)throw N0;if(H0>=w)throw h(this),new RangeError(v);var K0=g.concat(i,H0);return h(this),K0}C(this._handle,"zlib binding closed");var X0=this._handle.write(K,j,l,I,this._buffer,this._offset,c);X0.buffer=j,X0.callback=U0;function U0(a,Y0){if(this)this.buffer=null,this.callback=null;if(D._hadError)return;var r=c-Y0;if(C(r>=0,"have should not go down"),r>0){var z0=D._buffer.slice(D._offset,D._offset+r);if(D._offset+=r,Q0)D.push(z0);else i.push(z0),H0+=z0.length}if(Y0===0||D._offset>=D._chunkSize)c=D._chunkSize,D._offset=0,D._buffer=g.allocUnsafe(D._chunkSize);if(Y0===0){if(l+=I-a,I=a,!Q0)return!0;var Z0=D._handle.write(K,j,l,I,D._buffer,D._offset,D._chunkSize);Z0.callback=U0,Z0.buffer=j;return}if(!Q0)return!1;O()}},n.inherits(W0,z),n.inherits(E,z),n.inherits(S,z),n.inherits(J0,z),n.inherits(G0,z),n.inherits(F0,z),n.inherits(f,z)}}),$0=c1();$0[Symbol.for("CommonJS")]=0;var _1=$0;j1=$0.Deflate;J1=$0.Inflate;Y1=$0.Gzip;G1=$0.Gunzip;q1=$0.DeflateRaw;X1=$0.InflateRaw;U1=$0.Unzip;P1=$0.createDeflate;K1=$0.createInflate;F1=$0.createDeflateRaw;H1=$0.createInflateRaw;z1=$0.createGzip;Z1=$0.createGunzip;L1=$0.createUnzip;C1=$0.deflate;N1=$0.deflateSync;I1=$0.gzip;O1=$0.gzipSync;B1=$0.deflateRaw;D1=$0.deflateRawSync;M1=$0.unzip;k1=$0.unzipSync;v1=$0.inflate;R1=$0.inflateSync;A1=$0.gunzip;g1=$0.gunzipSync;w1=$0.inflateRaw;T1=$0.inflateRawSync;S1=$0.constants;export{k1 as unzipSync,M1 as unzip,R1 as inflateSync,T1 as inflateRawSync,w1 as inflateRaw,v1 as inflate,O1 as gzipSync,I1 as gzip,g1 as gunzipSync,A1 as gunzip,N1 as deflateSync,D1 as deflateRawSync,B1 as deflateRaw,C1 as deflate,_1 as default,L1 as createUnzip,H1 as createInflateRaw,K1 as createInflate,z1 as createGzip,Z1 as createGunzip,F1 as createDeflateRaw,P1 as createDeflate,S1 as constants,U1 as Unzip,X1 as InflateRaw,J1 as Inflate,Y1 as Gzip,G1 as Gunzip,q1 as DeflateRaw,j1 as Deflate};
+import*as AssertModule from"node:assert";import*as BufferModule from"node:buffer";import*as StreamModule from"node:stream";import*as Util from"node:util";var lazy=globalThis[Symbol.for("Bun.lazy")];var Deflate,Inflate,Gzip,Gunzip,DeflateRaw,InflateRaw,Unzip,createDeflate,createInflate,createDeflateRaw,createInflateRaw,createGzip,createGunzip,createUnzip,deflate,deflateSync,gzip,gzipSync,deflateRaw,deflateRawSync,unzip,unzipSync,inflate,inflateSync,gunzip,gunzipSync,inflateRaw,inflateRawSync,constants;var __create=Object.create;var __defProp=Object.defineProperty;var __getOwnPropDesc=Object.getOwnPropertyDescriptor;var __getOwnPropNames=Object.getOwnPropertyNames;var __getProtoOf=Object.getPrototypeOf;var __hasOwnProp=Object.prototype.hasOwnProperty;var __commonJS=(cb,mod)=>function __require(){return mod||(0,cb[__getOwnPropNames(cb)[0]])((mod={exports:{}}).exports,mod),mod.exports;};var __copyProps=(to,from,except,desc)=>{if((from&&typeof from==="object")||typeof from==="function"){for(let key of __getOwnPropNames(from))if(!__hasOwnProp.call(to,key)&&key!==except)__defProp(to,key,{get:()=>from[key],enumerable:!(desc=__getOwnPropDesc(from,key))||desc.enumerable});}return to;};var __reExport=(target,mod,secondTarget)=>(__copyProps(target,mod,"default"),secondTarget&&__copyProps(secondTarget,mod,"default"));var __toESM=(mod,isNodeMode,target)=>((target=mod!=null?__create(__getProtoOf(mod)):{}),__copyProps(isNodeMode||!mod||!mod.__esModule?__defProp(target,"default",{value:mod,enumerable:!0}):target,mod));var __toCommonJS=mod=>__copyProps(__defProp({},"__esModule",{value:!0}),mod);var require_constants=__commonJS({"node_modules/pako/lib/zlib/constants.js"(exports,module2){"use strict";module2.exports={Z_NO_FLUSH:0,Z_PARTIAL_FLUSH:1,Z_SYNC_FLUSH:2,Z_FULL_FLUSH:3,Z_FINISH:4,Z_BLOCK:5,Z_TREES:6,Z_OK:0,Z_STREAM_END:1,Z_NEED_DICT:2,Z_ERRNO:-1,Z_STREAM_ERROR:-2,Z_DATA_ERROR:-3,Z_MEM_ERROR:-4,Z_BUF_ERROR:-5,Z_VERSION_ERROR:-6,Z_NO_COMPRESSION:0,Z_BEST_SPEED:1,Z_BEST_COMPRESSION:9,Z_DEFAULT_COMPRESSION:-1,Z_FILTERED:1,Z_HUFFMAN_ONLY:2,Z_RLE:3,Z_FIXED:4,Z_DEFAULT_STRATEGY:0,Z_BINARY:0,Z_TEXT:1,Z_UNKNOWN:2,Z_DEFLATED:8};}});var require_binding=__commonJS({"node_modules/browserify-zlib/lib/binding.js"(exports){"use strict";var constants=require_constants();for(var key in constants){exports[key]=constants[key];}exports.NONE=0;exports.DEFLATE=1;exports.INFLATE=2;exports.GZIP=3;exports.GUNZIP=4;exports.DEFLATERAW=5;exports.INFLATERAW=6;exports.UNZIP=7;exports.Zlib=lazy("zlib").Zlib;}});var require_lib=__commonJS({"node_modules/browserify-zlib/lib/index.js"(exports){"use strict";var Buffer2=BufferModule.Buffer;var Transform=StreamModule.Transform;var binding=require_binding();var util=Util;var assert=AssertModule.ok;var kMaxLength=BufferModule.kMaxLength;var kRangeErrorMessage="Cannot create final Buffer. It would be larger than 0x"+kMaxLength.toString(16)+" bytes";binding.Z_MIN_WINDOWBITS=8;binding.Z_MAX_WINDOWBITS=15;binding.Z_DEFAULT_WINDOWBITS=15;binding.Z_MIN_CHUNK=64;binding.Z_MAX_CHUNK=Infinity;binding.Z_DEFAULT_CHUNK=16*1024;binding.Z_MIN_MEMLEVEL=1;binding.Z_MAX_MEMLEVEL=9;binding.Z_DEFAULT_MEMLEVEL=8;binding.Z_MIN_LEVEL=-1;binding.Z_MAX_LEVEL=9;binding.Z_DEFAULT_LEVEL=binding.Z_DEFAULT_COMPRESSION;var bkeys=Object.keys(binding);for(bk=0;bk<bkeys.length;bk++){bkey=bkeys[bk];if(bkey.match(/^Z/)){Object.defineProperty(exports,bkey,{enumerable:!0,value:binding[bkey],writable:!1});}}var bkey;var bk;var codes={Z_OK:binding.Z_OK,Z_STREAM_END:binding.Z_STREAM_END,Z_NEED_DICT:binding.Z_NEED_DICT,Z_ERRNO:binding.Z_ERRNO,Z_STREAM_ERROR:binding.Z_STREAM_ERROR,Z_DATA_ERROR:binding.Z_DATA_ERROR,Z_MEM_ERROR:binding.Z_MEM_ERROR,Z_BUF_ERROR:binding.Z_BUF_ERROR,Z_VERSION_ERROR:binding.Z_VERSION_ERROR};var ckeys=Object.keys(codes);for(ck=0;ck<ckeys.length;ck++){ckey=ckeys[ck];codes[codes[ckey]]=ckey;}var ckey;var ck;Object.defineProperty(exports,"codes",{enumerable:!0,value:Object.freeze(codes),writable:!1});exports.constants=require_constants();exports.Deflate=Deflate;exports.Inflate=Inflate;exports.Gzip=Gzip;exports.Gunzip=Gunzip;exports.DeflateRaw=DeflateRaw;exports.InflateRaw=InflateRaw;exports.Unzip=Unzip;exports.createDeflate=function(o){return new Deflate(o);};exports.createInflate=function(o){return new Inflate(o);};exports.createDeflateRaw=function(o){return new DeflateRaw(o);};exports.createInflateRaw=function(o){return new InflateRaw(o);};exports.createGzip=function(o){return new Gzip(o);};exports.createGunzip=function(o){return new Gunzip(o);};exports.createUnzip=function(o){return new Unzip(o);};exports.deflate=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new Deflate(opts),buffer,callback);};exports.deflateSync=function(buffer,opts){return zlibBufferSync(new Deflate(opts),buffer);};exports.gzip=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new Gzip(opts),buffer,callback);};exports.gzipSync=function(buffer,opts){return zlibBufferSync(new Gzip(opts),buffer);};exports.deflateRaw=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new DeflateRaw(opts),buffer,callback);};exports.deflateRawSync=function(buffer,opts){return zlibBufferSync(new DeflateRaw(opts),buffer);};exports.unzip=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new Unzip(opts),buffer,callback);};exports.unzipSync=function(buffer,opts){return zlibBufferSync(new Unzip(opts),buffer);};exports.inflate=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new Inflate(opts),buffer,callback);};exports.inflateSync=function(buffer,opts){return zlibBufferSync(new Inflate(opts),buffer);};exports.gunzip=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new Gunzip(opts),buffer,callback);};exports.gunzipSync=function(buffer,opts){return zlibBufferSync(new Gunzip(opts),buffer);};exports.inflateRaw=function(buffer,opts,callback){if(typeof opts==="function"){callback=opts;opts={};}return zlibBuffer(new InflateRaw(opts),buffer,callback);};exports.inflateRawSync=function(buffer,opts){return zlibBufferSync(new InflateRaw(opts),buffer);};function zlibBuffer(engine,buffer,callback){var buffers=[];var nread=0;engine.on("error",onError);engine.on("end",onEnd);engine.end(buffer);flow();function flow(){var chunk;while(null!==(chunk=engine.read())){buffers.push(chunk);nread+=chunk.length;}engine.once("readable",flow);}function onError(err){engine.removeListener("end",onEnd);engine.removeListener("readable",flow);callback(err);}function onEnd(){var buf;var err=null;if(nread>=kMaxLength){err=new RangeError(kRangeErrorMessage);}else{buf=Buffer2.concat(buffers,nread);}buffers=[];engine.close();callback(err,buf);}}function zlibBufferSync(engine,buffer){if(typeof buffer==="string")buffer=Buffer2.from(buffer);if(!Buffer2.isBuffer(buffer))throw new TypeError("Not a string or buffer");var flushFlag=engine._finishFlushFlag;return engine._processChunk(buffer,flushFlag);}function Deflate(opts){if(!(this instanceof Deflate))return new Deflate(opts);Zlib.call(this,opts,binding.DEFLATE);}function Inflate(opts){if(!(this instanceof Inflate))return new Inflate(opts);Zlib.call(this,opts,binding.INFLATE);}function Gzip(opts){if(!(this instanceof Gzip))return new Gzip(opts);Zlib.call(this,opts,binding.GZIP);}function Gunzip(opts){if(!(this instanceof Gunzip))return new Gunzip(opts);Zlib.call(this,opts,binding.GUNZIP);}function DeflateRaw(opts){if(!(this instanceof DeflateRaw))return new DeflateRaw(opts);Zlib.call(this,opts,binding.DEFLATERAW);}function InflateRaw(opts){if(!(this instanceof InflateRaw))return new InflateRaw(opts);Zlib.call(this,opts,binding.INFLATERAW);}function Unzip(opts){if(!(this instanceof Unzip))return new Unzip(opts);Zlib.call(this,opts,binding.UNZIP);}function isValidFlushFlag(flag){return(flag===binding.Z_NO_FLUSH||flag===binding.Z_PARTIAL_FLUSH||flag===binding.Z_SYNC_FLUSH||flag===binding.Z_FULL_FLUSH||flag===binding.Z_FINISH||flag===binding.Z_BLOCK);}function Zlib(opts,mode){var _this=this;this._opts=opts=opts||{};this._chunkSize=opts.chunkSize||exports.Z_DEFAULT_CHUNK;Transform.call(this,opts);if(opts.flush&&!isValidFlushFlag(opts.flush)){throw new Error("Invalid flush flag: "+opts.flush);}if(opts.finishFlush&&!isValidFlushFlag(opts.finishFlush)){throw new Error("Invalid flush flag: "+opts.finishFlush);}this._flushFlag=opts.flush||binding.Z_NO_FLUSH;this._finishFlushFlag=typeof opts.finishFlush!=="undefined"?opts.finishFlush:binding.Z_FINISH;if(opts.chunkSize){if(opts.chunkSize<exports.Z_MIN_CHUNK||opts.chunkSize>exports.Z_MAX_CHUNK){throw new Error("Invalid chunk size: "+opts.chunkSize);}}if(opts.windowBits){if(opts.windowBits<exports.Z_MIN_WINDOWBITS||opts.windowBits>exports.Z_MAX_WINDOWBITS){throw new Error("Invalid windowBits: "+opts.windowBits);}}if(opts.level){if(opts.level<exports.Z_MIN_LEVEL||opts.level>exports.Z_MAX_LEVEL){throw new Error("Invalid compression level: "+opts.level);}}if(opts.memLevel){if(opts.memLevel<exports.Z_MIN_MEMLEVEL||opts.memLevel>exports.Z_MAX_MEMLEVEL){throw new Error("Invalid memLevel: "+opts.memLevel);}}if(opts.strategy){if(opts.strategy!=exports.Z_FILTERED&&opts.strategy!=exports.Z_HUFFMAN_ONLY&&opts.strategy!=exports.Z_RLE&&opts.strategy!=exports.Z_FIXED&&opts.strategy!=exports.Z_DEFAULT_STRATEGY){throw new Error("Invalid strategy: "+opts.strategy);}}if(opts.dictionary){if(!Buffer2.isBuffer(opts.dictionary)){throw new Error("Invalid dictionary: it should be a Buffer instance");}}this._handle=new binding.Zlib(mode);var self=this;this._hadError=!1;this._handle.onerror=function(message,errno){_close(self);self._hadError=!0;var error=new Error(message);error.errno=errno;error.code=exports.codes[errno];self.emit("error",error);};var level=exports.Z_DEFAULT_COMPRESSION;if(typeof opts.level==="number")level=opts.level;var strategy=exports.Z_DEFAULT_STRATEGY;if(typeof opts.strategy==="number")strategy=opts.strategy;this._handle.init(opts.windowBits||exports.Z_DEFAULT_WINDOWBITS,level,opts.memLevel||exports.Z_DEFAULT_MEMLEVEL,strategy,opts.dictionary);this._buffer=Buffer2.allocUnsafe(this._chunkSize);this._offset=0;this._level=level;this._strategy=strategy;this.once("end",this.close);Object.defineProperty(this,"_closed",{get:function(){return!_this._handle;},configurable:!0,enumerable:!0});}util.inherits(Zlib,Transform);Zlib.prototype.params=function(level,strategy,callback){if(level<exports.Z_MIN_LEVEL||level>exports.Z_MAX_LEVEL){throw new RangeError("Invalid compression level: "+level);}if(strategy!=exports.Z_FILTERED&&strategy!=exports.Z_HUFFMAN_ONLY&&strategy!=exports.Z_RLE&&strategy!=exports.Z_FIXED&&strategy!=exports.Z_DEFAULT_STRATEGY){throw new TypeError("Invalid strategy: "+strategy);}if(this._level!==level||this._strategy!==strategy){var self=this;this.flush(binding.Z_SYNC_FLUSH,function(){assert(self._handle,"zlib binding closed");self._handle.params(level,strategy);if(!self._hadError){self._level=level;self._strategy=strategy;if(callback)callback();}});}else{process.nextTick(callback);}};Zlib.prototype.reset=function(){assert(this._handle,"zlib binding closed");return this._handle.reset();};Zlib.prototype._flush=function(callback){this._transform(Buffer2.alloc(0),"",callback);};Zlib.prototype.flush=function(kind,callback){var _this2=this;var ws=this._writableState;if(typeof kind==="function"||(kind===void 0&&!callback)){callback=kind;kind=binding.Z_FULL_FLUSH;}if(ws.ended){if(callback)process.nextTick(callback);}else if(ws.ending){if(callback)this.once("end",callback);}else if(ws.needDrain){if(callback){this.once("drain",function(){return _this2.flush(kind,callback);});}}else{this._flushFlag=kind;this.write(Buffer2.alloc(0),"",callback);}};Zlib.prototype.close=function(callback){_close(this,callback);process.nextTick(emitCloseNT,this);};function _close(engine,callback){if(callback)process.nextTick(callback);if(!engine._handle)return;engine._handle.close();engine._handle=null;}function emitCloseNT(self){self.emit("close");}Zlib.prototype._transform=function(chunk,encoding,cb){var flushFlag;var ws=this._writableState;var ending=ws.ending||ws.ended;var last=ending&&(!chunk||ws.length===chunk.length);if(chunk!==null&&!Buffer2.isBuffer(chunk))return cb(new Error("invalid input"));if(!this._handle)return cb(new Error("zlib binding closed"));if(last)flushFlag=this._finishFlushFlag;else{flushFlag=this._flushFlag;if(chunk.length>=ws.length){this._flushFlag=this._opts.flush||binding.Z_NO_FLUSH;}}this._processChunk(chunk,flushFlag,cb);};Zlib.prototype._processChunk=function(chunk,flushFlag,cb){var availInBefore=chunk&&chunk.length;var availOutBefore=this._chunkSize-this._offset;var inOff=0;var self=this;var async=typeof cb==="function";if(!async){var buffers=[];var nread=0;var error;this.on("error",function(er){error=er;});assert(this._handle,"zlib binding closed");do{var res=this._handle.writeSync(flushFlag,chunk,inOff,availInBefore,this._buffer,this._offset,availOutBefore);}while(!this._hadError&&callback(res[0],res[1]));if(this._hadError){throw error;}if(nread>=kMaxLength){_close(this);throw new RangeError(kRangeErrorMessage);}var buf=Buffer2.concat(buffers,nread);_close(this);return buf;}assert(this._handle,"zlib binding closed");var req=this._handle.write(flushFlag,chunk,inOff,availInBefore,this._buffer,this._offset,availOutBefore);req.buffer=chunk;req.callback=callback;function callback(availInAfter,availOutAfter){if(this){this.buffer=null;this.callback=null;}if(self._hadError)return;var have=availOutBefore-availOutAfter;assert(have>=0,"have should not go down");if(have>0){var out=self._buffer.slice(self._offset,self._offset+have);self._offset+=have;if(async){self.push(out);}else{buffers.push(out);nread+=out.length;}}if(availOutAfter===0||self._offset>=self._chunkSize){availOutBefore=self._chunkSize;self._offset=0;self._buffer=Buffer2.allocUnsafe(self._chunkSize);}if(availOutAfter===0){inOff+=availInBefore-availInAfter;availInBefore=availInAfter;if(!async)return!0;var newReq=self._handle.write(flushFlag,chunk,inOff,availInBefore,self._buffer,self._offset,self._chunkSize);newReq.callback=callback;newReq.buffer=chunk;return;}if(!async)return!1;cb();}};util.inherits(Deflate,Zlib);util.inherits(Inflate,Zlib);util.inherits(Gzip,Zlib);util.inherits(Gunzip,Zlib);util.inherits(DeflateRaw,Zlib);util.inherits(InflateRaw,Zlib);util.inherits(Unzip,Zlib);}});var zlib_exports=require_lib();zlib_exports[Symbol.for("CommonJS")]=0;Deflate=zlib_exports.Deflate;Inflate=zlib_exports.Inflate;Gzip=zlib_exports.Gzip;Gunzip=zlib_exports.Gunzip;DeflateRaw=zlib_exports.DeflateRaw;InflateRaw=zlib_exports.InflateRaw;Unzip=zlib_exports.Unzip;createDeflate=zlib_exports.createDeflate;createInflate=zlib_exports.createInflate;createDeflateRaw=zlib_exports.createDeflateRaw;createInflateRaw=zlib_exports.createInflateRaw;createGzip=zlib_exports.createGzip;createGunzip=zlib_exports.createGunzip;createUnzip=zlib_exports.createUnzip;deflate=zlib_exports.deflate;deflateSync=zlib_exports.deflateSync;gzip=zlib_exports.gzip;gzipSync=zlib_exports.gzipSync;deflateRaw=zlib_exports.deflateRaw;deflateRawSync=zlib_exports.deflateRawSync;unzip=zlib_exports.unzip;unzipSync=zlib_exports.unzipSync;inflate=zlib_exports.inflate;inflateSync=zlib_exports.inflateSync;gunzip=zlib_exports.gunzip;gunzipSync=zlib_exports.gunzipSync;inflateRaw=zlib_exports.inflateRaw;inflateRawSync=zlib_exports.inflateRawSync;constants=zlib_exports.constants;export{Deflate,Inflate,Gzip,Gunzip,DeflateRaw,InflateRaw,Unzip,createDeflate,createInflate,createDeflateRaw,createInflateRaw,createGzip,createGunzip,createUnzip,deflate,deflateSync,gzip,gzipSync,deflateRaw,deflateRawSync,unzip,unzipSync,inflate,inflateSync,gunzip,gunzipSync,inflateRaw,inflateRawSync,constants,zlib_exports as default};
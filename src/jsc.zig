@@ -14,6 +14,7 @@ pub const C = @import("./bun.js/javascript_core_c_api.zig");
 pub const WebCore = @import("./bun.js/webcore.zig");
 pub const BuildMessage = @import("./bun.js/BuildMessage.zig").BuildMessage;
 pub const ResolveMessage = @import("./bun.js/ResolveMessage.zig").ResolveMessage;
+pub const WebWorker = @import("./bun.js/web_worker.zig").WebWorker;
 pub const Cloudflare = struct {
     pub const HTMLRewriter = @import("./bun.js/api/html_rewriter.zig").HTMLRewriter;
     pub const ContentOptions = @import("./bun.js/api/html_rewriter.zig").ContentOptions;
@@ -38,12 +39,14 @@ pub const API = struct {
     pub const SSLServer = @import("./bun.js/api/server.zig").SSLServer;
     pub const DebugServer = @import("./bun.js/api/server.zig").DebugServer;
     pub const DebugSSLServer = @import("./bun.js/api/server.zig").DebugSSLServer;
+    pub const AnyServer = @import("./bun.js/api/server.zig").AnyServer;
     pub const Bun = @import("./bun.js/api/bun.zig");
     pub const FileSystemRouter = @import("./bun.js/api/filesystem_router.zig").FileSystemRouter;
     pub const MatchedRoute = @import("./bun.js/api/filesystem_router.zig").MatchedRoute;
     pub const TCPSocket = @import("./bun.js/api/bun/socket.zig").TCPSocket;
     pub const TLSSocket = @import("./bun.js/api/bun/socket.zig").TLSSocket;
     pub const Listener = @import("./bun.js/api/bun/socket.zig").Listener;
+    pub const UDPSocket = @import("./bun.js/api/bun/udp_socket.zig").UDPSocket;
 };
 pub const DNS = @import("./bun.js/api/bun/dns_resolver.zig");
 pub const FFI = @import("./bun.js/api/ffi.zig").FFI;
@@ -1232,6 +1232,10 @@ pub const ThreadSafeFunction = struct {
     event_loop: *JSC.EventLoop,
     concurrent_task: JSC.ConcurrentTask = .{},
     concurrent_finalizer_task: JSC.ConcurrentTask = .{},
+    /// Set while `concurrent_task` is queued on the event loop. Producers only
+    /// post a new task when they flip it, so a burst of calls from other
+    /// threads costs one wakeup instead of one task per item.
+    dispatch_pending: std.atomic.Atomic(bool) = std.atomic.Atomic(bool).init(false),
 
     env: napi_env,
 
@@ -1311,8 +1315,38 @@ pub const ThreadSafeFunction = struct {
         }
     };
 
+    /// How long one wakeup may spend draining the queue before yielding back
+    /// to the event loop, so a producer that never stops cannot starve
+    /// timers and I/O.
+    const drain_budget_ns = 4 * std.time.ns_per_ms;
+    /// Checking the clock on every item would cost more than most callbacks.
+    const drain_clock_interval = 64;
+
+    /// Drains every queued item, up to the time budget.
     pub fn call(this: *ThreadSafeFunction) void {
-        var task = this.channel.tryReadItem() catch null orelse return;
+        // Clear before reading: an item written after this point either gets
+        // drained below or posts a fresh task.
+        this.dispatch_pending.store(false, .Release);
+
+        var timer = std.time.Timer.start() catch null;
+        var count: usize = 0;
+        while (this.channel.tryReadItem() catch null) |task| {
+            this.callOne(task);
+            count += 1;
+
+            if (count % drain_clock_interval != 0) continue;
+            if (timer) |*t| {
+                if (t.read() >= drain_budget_ns) {
+                    // Out of time. Leave the rest for the next tick.
+                    this.scheduleDispatch();
+                    break;
+                }
+            }
+        }
+        log("ThreadSafeFunction.call: {d} items", .{count});
+    }
+
+    fn callOne(this: *ThreadSafeFunction, task: ?*anyopaque) void {
         switch (this.callback) {
             .js => |js_function| {
                 if (js_function.isEmptyOrUndefinedOrNull()) {
@@ -1329,6 +1363,11 @@ pub const ThreadSafeFunction = struct {
         }
     }
 
+    fn scheduleDispatch(this: *ThreadSafeFunction) void {
+        if (this.dispatch_pending.swap(true, .AcqRel)) return;
+        this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(this));
+    }
+
     pub fn enqueue(this: *ThreadSafeFunction, ctx: ?*anyopaque, block: bool) !void {
         if (block) {
             try this.channel.writeItem(ctx);
@@ -1338,11 +1377,18 @@ pub const ThreadSafeFunction = struct {
             }
         }
 
-        this.event_loop.enqueueTaskConcurrent(this.concurrent_task.from(this));
+        this.scheduleDispatch();
     }
 
     pub fn finalize(opaq: *anyopaque) void {
         var this = bun.cast(*ThreadSafeFunction, opaq);
+        // A drain that ran out of budget re-posted itself after we were
+        // queued. Let it run first so it doesn't touch freed memory.
+        if (this.dispatch_pending.load(.Acquire)) {
+            this.event_loop.enqueueTaskConcurrent(this.concurrent_finalizer_task.from(&this.finalizer_task));
+            return;
+        }
+
         if (this.finalizer.fun) |fun| {
             fun(this.event_loop.global, opaq, this.finalizer.ctx);
         }
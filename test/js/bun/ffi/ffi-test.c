@@ -1,3 +1,4 @@
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -140,4 +141,101 @@ uint32_t cb_identity_42_uint32_t(uint32_t (*cb)()) { return cb(); }
 uint64_t cb_identity_42_uint64_t(uint64_t (*cb)()) { return cb(); }
 int16_t cb_identity_neg_42_int16_t(int16_t (*cb)()) { return cb(); }
 int32_t cb_identity_neg_42_int32_t(int32_t (*cb)()) { return cb(); }
-int64_t cb_identity_neg_42_int64_t(int64_t (*cb)()) { return cb(); }
\ No newline at end of file
+int64_t cb_identity_neg_42_int64_t(int64_t (*cb)()) { return cb(); }
+typedef struct {
+  double x;
+  double y;
+} vec2;
+
+typedef struct {
+  int32_t a;
+  int8_t b;
+  int64_t c;
+} mixed;
+
+typedef struct {
+  vec2 origin;
+  float width;
+  float height;
+  uint8_t flags;
+} rect;
+
+vec2 vec2_add(vec2 a, vec2 b) { return (vec2){a.x + b.x, a.y + b.y}; }
+double vec2_dot(vec2 a, vec2 b) { return a.x * b.x + a.y * b.y; }
+mixed mixed_make(int32_t a, int8_t b, int64_t c) { return (mixed){a, b, c}; }
+int64_t mixed_sum(mixed m) { return m.a + m.b + m.c; }
+rect rect_grow(rect r, float by) {
+  r.origin.x -= by;
+  r.origin.y -= by;
+  r.width += 2 * by;
+  r.height += 2 * by;
+  r.flags |= 1;
+  return r;
+}
+float rect_area(rect r) { return r.width * r.height; }
+double cb_vec2_length_squared(double (*cb)(vec2), double x, double y) {
+  return cb((vec2){x, y});
+}
+
+#define THREADSAFE_MAX_THREADS 16
+
+typedef struct {
+  void *cb;
+  int32_t thread;
+  int32_t count;
+  int64_t sum;
+} threadsafe_job;
+
+static pthread_t threadsafe_threads[THREADSAFE_MAX_THREADS];
+static threadsafe_job threadsafe_jobs[THREADSAFE_MAX_THREADS];
+static int32_t threadsafe_thread_count = 0;
+static int32_t threadsafe_entered_count = 0;
+
+static void *threadsafe_notify(void *arg) {
+  threadsafe_job *job = arg;
+  void (*cb)(int32_t, int32_t) = job->cb;
+  for (int32_t i = 0; i < job->count; i++)
+    cb(job->thread, i);
+  return NULL;
+}
+
+static void *threadsafe_ask(void *arg) {
+  threadsafe_job *job = arg;
+  int32_t (*cb)(int32_t) = job->cb;
+  for (int32_t i = 0; i < job->count; i++) {
+    __atomic_fetch_add(&threadsafe_entered_count, 1, __ATOMIC_SEQ_CST);
+    job->sum += cb(job->thread * job->count + i);
+  }
+  return NULL;
+}
+
+// Starts `threads` threads that each call `cb` `count` times, without waiting
+// for them. `blocking` picks int32_t cb(int32_t) over void cb(int32_t, int32_t).
+void threadsafe_start(void *cb, bool blocking, int32_t threads, int32_t count) {
+  if (threads > THREADSAFE_MAX_THREADS)
+    threads = THREADSAFE_MAX_THREADS;
+  threadsafe_thread_count = threads;
+  threadsafe_entered_count = 0;
+  for (int32_t i = 0; i < threads; i++) {
+    threadsafe_jobs[i] = (threadsafe_job){cb, i, count, 0};
+    pthread_create(&threadsafe_threads[i], NULL,
+                   blocking ? threadsafe_ask : threadsafe_notify,
+                   &threadsafe_jobs[i]);
+  }
+}
+
+// Returns how many blocking calls the threads have started so far.
+int32_t threadsafe_entered() {
+  return __atomic_load_n(&threadsafe_entered_count, __ATOMIC_SEQ_CST);
+}
+
+// Joins the threads and returns the sum of what blocking callbacks returned.
+int64_t threadsafe_join() {
+  int64_t sum = 0;
+  for (int32_t i = 0; i < threadsafe_thread_count; i++) {
+    pthread_join(threadsafe_threads[i], NULL);
+    sum += threadsafe_jobs[i].sum;
+  }
+  threadsafe_thread_count = 0;
+  return sum;
+}
@@ -7,6 +7,7 @@ import {
   JSCallback,
   ptr,
   read,
+  struct,
   toArrayBuffer,
   toBuffer,
   viewSource,
@@ -375,6 +376,34 @@ function ffiRunner(fast) {
       },
       close,
     } = dlopen("/tmp/bun-ffi-test.dylib", types);
+    it("symbols return the same results once the caller is optimized", () => {
+      const { numberOfDFGCompiles, optimizeNextInvocation } = require("bun:jsc");
+      const { symbols } = dlopen("/tmp/bun-ffi-test.dylib", {
+        add_int32_t: types.add_int32_t,
+        add_uint32_t: types.add_uint32_t,
+        identity_bool: types.identity_bool,
+        is_null: types.is_null,
+      });
+      // Called as methods of `symbols`, like the DOMJIT signature expects.
+      function run(i) {
+        return [symbols.add_int32_t(i, 7), symbols.add_uint32_t(i, 3), symbols.identity_bool((i & 1) === 0), symbols.is_null(null)];
+      }
+
+      for (let i = 0; i < 1000; i++) run(i);
+      optimizeNextInvocation(run);
+      for (let i = 0; i < 200_000; i++) {
+        const [sum, unsigned, even, isNull] = run(i);
+        if (sum !== i + 7 || unsigned !== i + 3 || even !== ((i & 1) === 0) || isNull !== true) {
+          throw new Error(`wrong result for ${i}: ${[sum, unsigned, even, isNull]}`);
+        }
+      }
+      expect(numberOfDFGCompiles(run)).toBeGreaterThan(0);
+
+      // Values at the edges of the unboxed types, from optimized code.
+      expect(run(2147483647)).toEqual([-2147483642, 2147483650, false, true]);
+      expect(run(-8)).toEqual([-1, 4294967291, true, true]);
+    });
+
     it("primitives", () => {
       Bun.gc(true);
       expect(returns_true()).toBe(true);
@@ -608,6 +637,225 @@ it("read", () => {
   }
 });
 
+describe("struct", () => {
+  const Vec2 = struct({ x: "f64", y: "f64" });
+  const Mixed = struct({ a: "i32", b: "i8", c: "i64" });
+  const Rect = struct({ origin: Vec2, width: "f32", height: "f32", flags: "u8" });
+
+  it("is laid out like C", () => {
+    expect([Vec2.byteLength, Vec2.alignment]).toEqual([16, 8]);
+    expect(Mixed.fields.map(({ offset }) => offset)).toEqual([0, 4, 8]);
+    expect(Mixed.byteLength).toBe(16);
+    expect(Rect.fields.map(({ offset }) => offset)).toEqual([0, 16, 20, 24]);
+    expect(Rect.byteLength).toBe(32);
+    expect(struct({ a: "u8", b: "u16", c: "u8" }).byteLength).toBe(6);
+  });
+
+  it("reads and writes fields in place", () => {
+    const buffer = new ArrayBuffer(Mixed.byteLength * 2);
+    const second = new Mixed(buffer, Mixed.byteLength);
+    second.a = -7;
+    second.b = 300;
+    second.c = 2n ** 40n;
+    const view = new DataView(buffer);
+    expect(view.getInt32(16, true)).toBe(-7);
+    expect(view.getInt8(20)).toBe(44);
+    expect(view.getBigInt64(24, true)).toBe(2n ** 40n);
+    expect(new Mixed(new Uint8Array(buffer, 16)).toJSON()).toEqual({ a: -7, b: 44, c: 2n ** 40n });
+  });
+
+  it("nested structs share memory", () => {
+    const rect = new Rect({ origin: { x: 1, y: 2 }, width: 3 });
+    rect.origin.y = 5;
+    expect(rect.toJSON()).toEqual({ origin: { x: 1, y: 5 }, width: 3, height: 0, flags: 0 });
+    rect.origin = new Vec2({ x: 9, y: 8 });
+    expect(rect.origin.toJSON()).toEqual({ x: 9, y: 8 });
+  });
+
+  it("rejects invalid fields", () => {
+    expect(() => struct({})).toThrow();
+    expect(() => struct({ a: "void" })).toThrow();
+    expect(() => struct({ a: "nope" })).toThrow();
+    expect(() => struct({ view: "i32" })).toThrow();
+  });
+
+  if (ok) {
+    it("passes and returns structs by value", () => {
+      const {
+        symbols: { vec2_add, vec2_dot, mixed_make, mixed_sum, rect_grow, rect_area },
+        close,
+      } = dlopen("/tmp/bun-ffi-test.dylib", {
+        vec2_add: { args: [Vec2, Vec2], returns: Vec2 },
+        vec2_dot: { args: [Vec2, Vec2], returns: "f64" },
+        mixed_make: { args: ["i32", "i8", "i64"], returns: Mixed },
+        mixed_sum: { args: [Mixed], returns: "i64" },
+        rect_grow: { args: [Rect, "f32"], returns: Rect },
+        rect_area: { args: [Rect], returns: "f32" },
+      });
+
+      const sum = vec2_add(new Vec2({ x: 1.5, y: -2 }), { x: 0.5, y: 4 });
+      expect(sum).toBeInstanceOf(Vec2);
+      expect(sum.toJSON()).toEqual({ x: 2, y: 2 });
+      expect(vec2_dot(sum, { x: 3, y: 4 })).toBe(14);
+
+      const mixed = mixed_make(-1, 2, 2 ** 40);
+      expect(mixed.toJSON()).toEqual({ a: -1, b: 2, c: 2n ** 40n });
+      expect(mixed_sum(mixed)).toBe(2n ** 40n + 1n);
+
+      const grown = rect_grow({ origin: { x: 10, y: 10 }, width: 4, height: 2 }, 1);
+      expect(grown.toJSON()).toEqual({ origin: { x: 9, y: 9 }, width: 6, height: 4, flags: 1 });
+      expect(rect_area(grown)).toBe(24);
+
+      close();
+    });
+
+    it("keeps converted struct arguments alive across collections", () => {
+      const {
+        symbols: { vec2_dot },
+        close,
+      } = dlopen("/tmp/bun-ffi-test.dylib", {
+        vec2_dot: { args: [Vec2, Vec2], returns: "f64" },
+      });
+
+      for (let i = 0; i < 10_000; i++) {
+        if (i % 1000 === 0) Bun.gc(true);
+        expect(vec2_dot({ x: i, y: 1 }, new Float64Array([2, i]))).toBe(3 * i);
+      }
+
+      close();
+    });
+
+    it("passes structs by value to callbacks", () => {
+      const {
+        symbols: { cb_vec2_length_squared },
+        close,
+      } = dlopen("/tmp/bun-ffi-test.dylib", {
+        cb_vec2_length_squared: { args: ["function", "f64", "f64"], returns: "f64" },
+      });
+
+      let received;
+      const callback = new JSCallback(
+        v => {
+          received = v;
+          return v.x * v.x + v.y * v.y;
+        },
+        { args: [Vec2], returns: "f64" },
+      );
+      expect(cb_vec2_length_squared(callback, 3, 4)).toBe(25);
+      // the callback's copy outlives the C stack frame
+      expect(received.toJSON()).toEqual({ x: 3, y: 4 });
+
+      callback.close();
+      close();
+    });
+  }
+});
+
+if (ok) {
+  describe("threadsafe JSCallback from 16 threads", () => {
+    const threads = 16;
+    const count = 1000;
+    const {
+      symbols: { threadsafe_start, threadsafe_entered, threadsafe_join },
+      close,
+    } = dlopen("/tmp/bun-ffi-test.dylib", {
+      threadsafe_start: { args: ["function", "bool", "i32", "i32"], returns: "void" },
+      threadsafe_entered: { args: [], returns: "i32" },
+      threadsafe_join: { args: [], returns: "i64" },
+    });
+
+    afterAll(() => close());
+
+    it("queues every call", async () => {
+      const seen = new Array(threads).fill(0);
+      let calls = 0;
+      let resolve;
+      const promise = new Promise(r => (resolve = r));
+      const callback = new JSCallback(
+        (thread, i) => {
+          // calls from one thread arrive in order
+          expect(i).toBe(seen[thread]++);
+          if (++calls === threads * count) resolve();
+        },
+        { args: ["i32", "i32"], threadsafe: true },
+      );
+
+      threadsafe_start(callback, false, threads, count);
+      await promise;
+      threadsafe_join();
+      expect(seen).toEqual(new Array(threads).fill(count));
+      callback.close();
+    });
+
+    it("blocking calls return a value to C", async () => {
+      let calls = 0;
+      let resolve;
+      const promise = new Promise(r => (resolve = r));
+      const callback = new JSCallback(
+        value => {
+          if (++calls === threads * count) resolve();
+          return value * 2;
+        },
+        { args: ["i32"], returns: "i32", threadsafe: true, blocking: true },
+      );
+
+      threadsafe_start(callback, true, threads, count);
+      await promise;
+      const total = threads * count;
+      expect(threadsafe_join()).toBe(BigInt(total * (total - 1)));
+      callback.close();
+    });
+
+    it("close releases threads still inside a call", async () => {
+      let calls = 0;
+      const callback = new JSCallback(() => ++calls, {
+        args: ["i32"],
+        returns: "i32",
+        threadsafe: true,
+        blocking: true,
+      });
+
+      threadsafe_start(callback, true, threads, 1);
+      // The JS thread doesn't yield here, so every call stays queued and its
+      // thread stays blocked inside the generated code.
+      while (threadsafe_entered() < threads) Bun.sleepSync(1);
+      Bun.sleepSync(20);
+      callback.close();
+      // Each caller gets the zeroed result it started with.
+      expect(threadsafe_join()).toBe(0n);
+      await Bun.sleep(0);
+      expect(calls).toBe(0);
+
+      const next = new JSCallback(value => value + 1, {
+        args: ["i32"],
+        returns: "i32",
+        threadsafe: true,
+        blocking: true,
+      });
+      const call = new CFunction({ ptr: next.ptr, args: ["i32"], returns: "i32" });
+      expect(call(41)).toBe(42);
+      next.close();
+    });
+
+    it("blocking calls on the JS thread run immediately", () => {
+      const callback = new JSCallback(value => value + 1, {
+        args: ["i32"],
+        returns: "i32",
+        threadsafe: true,
+        blocking: true,
+      });
+      const call = new CFunction({ ptr: callback.ptr, args: ["i32"], returns: "i32" });
+      expect(call(41)).toBe(42);
+      callback.close();
+    });
+
+    it("non-blocking callbacks must return void", () => {
+      expect(() => new JSCallback(() => 1, { returns: "i32", threadsafe: true })).toThrow();
+      expect(() => new JSCallback(() => {}, { blocking: true })).toThrow();
+    });
+  });
+}
+
 if (ok) {
   describe("run ffi", () => {
     ffiRunner(false);
@@ -0,0 +1,18 @@
+import { isMainThread, threadId } from "worker_threads";
+
+const server = Bun.serve({
+  port: 0,
+  workers: 2,
+  fetch() {
+    return new Response(String(threadId));
+  },
+});
+
+if (isMainThread) {
+  console.log(server.port);
+  // Stopping the main thread's server terminates the other worker too.
+  for await (const line of console) {
+    server.stop(true);
+    break;
+  }
+}
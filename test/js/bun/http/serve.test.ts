@@ -1,7 +1,8 @@
-import { file, gc, Serve, serve, Server } from "bun";
+import { file, gc, Serve, serve, Server, spawn } from "bun";
 import { afterEach, describe, it, expect, afterAll } from "bun:test";
+import { bunEnv, bunExe } from "harness";
 import { readFileSync, writeFileSync } from "fs";
-import { resolve } from "path";
+import { join, resolve } from "path";
 import { renderToReadableStream } from "react-dom/server";
 import app_jsx from "./app.jsx";
 
@@ -1059,3 +1060,263 @@ it("does propagate type for Blob", async () => {
 
   server.stop(true);
 });
+
+it("caps the request body preallocation for a huge Content-Length", async () => {
+  let resolve: (length: number) => void;
+  const received = new Promise<number>(r => (resolve = r));
+  const server = Bun.serve({
+    port: 0,
+    maxRequestBodySize: Number.MAX_SAFE_INTEGER,
+    async fetch(req) {
+      // Let the first chunks buffer before reading, so both the server's
+      // request buffer and the stream's buffer are sized from the header.
+      await Bun.sleep(50);
+      const { value } = await req.body!.getReader().read();
+      resolve(value!.length);
+      return new Response("ok");
+    },
+  });
+
+  const socket = await Bun.connect({
+    hostname: server.hostname,
+    port: server.port,
+    socket: { data() {} },
+  });
+  try {
+    // Allocating this up front would fail.
+    socket.write(`POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: ${2 ** 50}\r\n\r\n`);
+    socket.write(Buffer.alloc(1024, "a"));
+    await Bun.sleep(10);
+    socket.write(Buffer.alloc(1024, "b"));
+    expect(await received).toBeGreaterThan(0);
+  } finally {
+    socket.end();
+    server.stop(true);
+  }
+});
+
+it("reusePort allows several servers to listen on the same port", () => {
+  const first = Bun.serve({
+    port: 0,
+    fetch() {
+      return new Response("first");
+    },
+  });
+
+  try {
+    const second = Bun.serve({
+      port: first.port,
+      fetch() {
+        return new Response("second");
+      },
+    });
+    second.stop(true);
+
+    expect(() =>
+      Bun.serve({
+        port: first.port,
+        reusePort: false,
+        fetch() {
+          return new Response("third");
+        },
+      }),
+    ).toThrow();
+  } finally {
+    first.stop(true);
+  }
+});
+
+it("workers requires reusePort", () => {
+  expect(() =>
+    Bun.serve({
+      port: 0,
+      workers: 2,
+      reusePort: false,
+      fetch() {
+        return new Response();
+      },
+    }),
+  ).toThrow("workers requires reusePort");
+});
+
+// The kernel only balances SO_REUSEPORT sockets on Linux.
+it.skipIf(process.platform !== "linux")("workers serve the same port from several threads", async () => {
+  const proc = spawn({
+    cmd: [bunExe(), join(import.meta.dir, "serve-workers-fixture.js")],
+    env: bunEnv,
+    stdin: "pipe",
+    stdout: "pipe",
+    stderr: "inherit",
+  });
+
+  try {
+    const { value } = await proc.stdout!.getReader().read();
+    const port = Number(new TextDecoder().decode(value).trim());
+
+    const seen = new Set();
+    for (let i = 0; i < 200 && seen.size < 2; i++) {
+      const response = await fetch(`http://127.0.0.1:${port}/`, { keepalive: false });
+      seen.add(await response.text());
+    }
+    expect(seen.size).toBe(2);
+    expect(seen.has("0")).toBe(true);
+
+    proc.stdin!.write("stop\n");
+    proc.stdin!.end();
+    expect(await proc.exited).toBe(0);
+  } finally {
+    proc.kill();
+  }
+}, 30000);
+
+describe("static", () => {
+  it("serves static routes without calling fetch", async () => {
+    let fetchCalls = 0;
+    const server = Bun.serve({
+      port: 0,
+      static: {
+        "/health": new Response("ok"),
+        "/json": new Response(JSON.stringify({ a: 1 }), {
+          status: 201,
+          headers: { "Content-Type": "application/json", "X-Static": "1" },
+        }),
+        "/file": new Response(Bun.file(import.meta.dir + "/fetch.js.txt")),
+      },
+      fetch() {
+        fetchCalls++;
+        return new Response("dynamic");
+      },
+    });
+
+    try {
+      const base = `http://${server.hostname}:${server.port}`;
+
+      const health = await fetch(`${base}/health`);
+      expect(health.status).toBe(200);
+      expect(health.headers.get("content-type")).toBe("text/plain;charset=utf-8");
+      expect(await health.text()).toBe("ok");
+
+      const json = await fetch(`${base}/json`);
+      expect(json.status).toBe(201);
+      expect(json.headers.get("content-type")).toBe("application/json");
+      expect(json.headers.get("x-static")).toBe("1");
+      expect(await json.json()).toEqual({ a: 1 });
+
+      const file = await fetch(`${base}/file`);
+      expect(await file.text()).toBe(readFileSync(import.meta.dir + "/fetch.js.txt", "utf8"));
+
+      const head = await fetch(`${base}/health`, { method: "HEAD" });
+      expect(head.status).toBe(200);
+      expect(head.headers.get("content-length")).toBe("2");
+
+      expect(fetchCalls).toBe(0);
+
+      expect(await (await fetch(`${base}/other`)).text()).toBe("dynamic");
+      expect(fetchCalls).toBe(1);
+    } finally {
+      server.stop(true);
+    }
+  });
+
+  it("answers If-None-Match with 304", async () => {
+    const server = Bun.serve({
+      port: 0,
+      static: {
+        "/asset": new Response("some asset"),
+      },
+      fetch() {
+        return new Response("dynamic");
+      },
+    });
+
+    try {
+      const url = `http://${server.hostname}:${server.port}/asset`;
+      const first = await fetch(url);
+      const etag = first.headers.get("etag");
+      expect(etag).toBeTruthy();
+      await first.text();
+
+      const second = await fetch(url, { headers: { "If-None-Match": etag! } });
+      expect(second.status).toBe(304);
+      expect(second.headers.get("etag")).toBe(etag);
+    } finally {
+      server.stop(true);
+    }
+  });
+
+  it("keeps the connection usable after HEAD and 304 responses", async () => {
+    const server = Bun.serve({
+      port: 0,
+      static: {
+        "/asset": new Response("some asset"),
+      },
+      fetch() {
+        return new Response("dynamic");
+      },
+    });
+
+    try {
+      const etag = (await fetch(`http://${server.hostname}:${server.port}/asset`)).headers.get("etag");
+
+      let received = "";
+      let onData: () => void;
+      const socket = await Bun.connect({
+        hostname: server.hostname,
+        port: server.port,
+        socket: {
+          data(socket, chunk) {
+            received += chunk.toString();
+            onData?.();
+          },
+        },
+      });
+
+      // Pipeline all three on one keep-alive connection. If the HEAD or 304
+      // response left its header block open, the final GET never completes.
+      socket.write(
+        "HEAD /asset HTTP/1.1\r\nHost: localhost\r\n\r\n" +
+          `GET /asset HTTP/1.1\r\nHost: localhost\r\nIf-None-Match: ${etag}\r\n\r\n` +
+          "GET /asset HTTP/1.1\r\nHost: localhost\r\n\r\n",
+      );
+      await new Promise<void>(resolve => {
+        onData = () => received.endsWith("some asset") && resolve();
+        onData();
+      });
+      socket.end();
+
+      const statuses = received.match(/^HTTP\/1\.1 \d+/gm);
+      expect(statuses).toEqual(["HTTP/1.1 200", "HTTP/1.1 304", "HTTP/1.1 200"]);
+    } finally {
+      server.stop(true);
+    }
+  });
+
+  it("frees static routes when the rest of the options are invalid", () => {
+    for (let i = 0; i < 100; i++) {
+      expect(() =>
+        Bun.serve({
+          port: 0,
+          static: { "/big": new Response(Buffer.alloc(8 * 1024 * 1024)) },
+          // @ts-expect-error
+          fetch: "not a function",
+        }),
+      ).toThrow();
+    }
+    Bun.gc(true);
+    // Leaking every body would hold on to 800 MB.
+    expect(process.memoryUsage().rss).toBeLessThan(1024 * 1024 * 512);
+  });
+
+  it("rejects values which are not Responses", () => {
+    expect(() =>
+      Bun.serve({
+        port: 0,
+        // @ts-expect-error
+        static: { "/nope": "not a response" },
+        fetch() {
+          return new Response("dynamic");
+        },
+      }),
+    ).toThrow();
+  });
+});
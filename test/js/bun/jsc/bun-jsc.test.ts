@@ -21,6 +21,7 @@ import {
   getProtectedObjects,
   reoptimizationRetryCount,
   drainMicrotasks,
+  eventLoopStats,
   startRemoteDebugger,
   setTimeZone,
 } from "bun:jsc";
@@ -140,4 +141,18 @@ describe("bun:jsc", () => {
 
     expect(Intl.DateTimeFormat().resolvedOptions().timeZone).toBe(origTimezone);
   });
+
+  it("eventLoopStats", async () => {
+    const before = eventLoopStats();
+    // Async transforms run on the thread pool and post back to this thread.
+    const transpiler = new Bun.Transpiler();
+    await Promise.all(Array.from({ length: 64 }, () => transpiler.transform("export const a = 1;")));
+    const after = eventLoopStats();
+
+    const tasks = after.concurrentTasks - before.concurrentTasks;
+    expect(tasks).toBeGreaterThanOrEqual(64);
+    expect(after.concurrentBatches - before.concurrentBatches).toBeLessThanOrEqual(tasks);
+    expect(after.wakeups - before.wakeups).toBeLessThanOrEqual(tasks);
+    expect(after.peakConcurrentDepth).toBeGreaterThanOrEqual(1);
+  });
 });
@@ -140,6 +140,31 @@ plugin({
   },
 });
 
+plugin({
+  name: "filter order",
+  setup(builder) {
+    builder.onResolve({ filter: /.*/, namespace: "filter-order" }, ({ path }) => ({
+      namespace: "filter-order",
+      path,
+    }));
+
+    const load = (filter: RegExp, which: string) =>
+      builder.onLoad({ filter, namespace: "filter-order" }, () => ({
+        exports: { which },
+        loader: "object",
+      }));
+
+    load(/^regex-first/, "regex first");
+    load(/\.(json5|yml)$/, "json5 or yml");
+    load(/\.module\.css$/, "module css");
+    load(/.*\.css$/, "css");
+    load(/\.scss$/i, "scss");
+    load(/.txt$/, "any character then txt");
+    load(/\.svg$/, "svg");
+    load(/^/, "fallback");
+  },
+});
+
 // This is to test that it works when imported from a separate file
 import "../../third_party/svelte";
 
@@ -167,6 +192,24 @@ describe("require", () => {
   });
 });
 
+describe("filters", () => {
+  it("the first matching filter wins, whatever its shape", () => {
+    expect(require("filter-order:regex-first.yml").which).toBe("regex first");
+    expect(require("filter-order:config.yml").which).toBe("json5 or yml");
+    expect(require("filter-order:config.json5").which).toBe("json5 or yml");
+    expect(require("filter-order:button.module.css").which).toBe("module css");
+    expect(require("filter-order:button.css").which).toBe("css");
+    expect(require("filter-order:theme.SCSS").which).toBe("scss");
+    expect(require("filter-order:readme-txt").which).toBe("any character then txt");
+    expect(require("filter-order:icon.svg").which).toBe("svg");
+  });
+
+  it("suffix filters only match at the end", () => {
+    expect(require("filter-order:icon.svg.js").which).toBe("fallback");
+    expect(require("filter-order:button.CSS").which).toBe("fallback");
+  });
+});
+
 describe("dynamic import", () => {
   it("SSRs `<h1>Hello world!</h1>` with Svelte", async () => {
     const { default: App }: any = await import("./hello.svelte");
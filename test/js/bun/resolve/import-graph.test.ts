@@ -0,0 +1,69 @@
+import { spawnSync } from "bun";
+import { describe, expect, it } from "bun:test";
+import { bunEnv, bunExe } from "harness";
+import { mkdtempSync, rmSync, writeFileSync } from "fs";
+import { tmpdir } from "os";
+import { join } from "path";
+
+// Modules in a static import graph are transpiled concurrently. These make sure
+// the result is still evaluated in order and that errors and CommonJS files
+// surface the same way they do when loaded one at a time.
+describe("static import graph", () => {
+  function withGraph(files: Record<string, string>, entry: string) {
+    const dir = mkdtempSync(join(tmpdir(), "bun-import-graph-"));
+    try {
+      for (const [name, contents] of Object.entries(files)) {
+        writeFileSync(join(dir, name), contents);
+      }
+      return spawnSync({
+        cmd: [bunExe(), join(dir, entry)],
+        env: bunEnv,
+        stdout: "pipe",
+        stderr: "pipe",
+        stdin: "ignore",
+      });
+    } finally {
+      rmSync(dir, { recursive: true, force: true });
+    }
+  }
+
+  it("evaluates a wide graph in import order", () => {
+    const files: Record<string, string> = {};
+    let entry = "";
+    for (let i = 0; i < 64; i++) {
+      files[`mod${i}.ts`] = `const id: number = ${i};\nexport default id;\nconsole.log("mod", id);\n`;
+      entry += `import m${i} from "./mod${i}.ts";\n`;
+    }
+    entry += `console.log("sum", ${Array.from({ length: 64 }, (_, i) => `m${i}`).join(" + ")});\n`;
+    files["entry.ts"] = entry;
+
+    const { stdout, exitCode } = withGraph(files, "entry.ts");
+    const expected = Array.from({ length: 64 }, (_, i) => `mod ${i}`).concat([`sum ${(63 * 64) / 2}`]);
+    expect(stdout.toString().trim().split("\n")).toEqual(expected);
+    expect(exitCode).toBe(0);
+  });
+
+  it("loads CommonJS dependencies", () => {
+    const { stdout, exitCode } = withGraph(
+      {
+        "cjs.js": "module.exports = { answer: 42 };",
+        "entry.mjs": 'import { answer } from "./cjs.js";\nconsole.log(answer);\n',
+      },
+      "entry.mjs",
+    );
+    expect(stdout.toString().trim()).toBe("42");
+    expect(exitCode).toBe(0);
+  });
+
+  it("reports syntax errors in a dependency", () => {
+    const { stderr, exitCode } = withGraph(
+      {
+        "broken.ts": "export const x = ;\n",
+        "entry.ts": 'import { x } from "./broken.ts";\nconsole.log(x);\n',
+      },
+      "entry.ts",
+    );
+    expect(stderr.toString()).toContain("broken.ts");
+    expect(exitCode).not.toBe(0);
+  });
+});
@@ -0,0 +1,57 @@
+import { test, expect } from "bun:test";
+import { requireResolutionCacheStats } from "bun:jsc";
+import { createRequire } from "module";
+import { join } from "path";
+import { tempDirWithFiles } from "harness";
+
+test("repeated require() calls reuse the cached resolution", () => {
+  const dir = tempDirWithFiles("require-resolution-cache", {
+    "dep.js": "module.exports = { value: 42 };",
+    "main.js": "",
+  });
+  const require = createRequire(join(dir, "main.js"));
+
+  const before = requireResolutionCacheStats();
+  for (let i = 0; i < 10; i++) {
+    expect(require("./dep.js").value).toBe(42);
+  }
+  const after = requireResolutionCacheStats();
+
+  expect(after.misses - before.misses).toBe(1);
+  expect(after.hits - before.hits).toBe(9);
+  expect(after.size).toBeGreaterThan(before.size);
+  expect(require.resolve("./dep.js")).toBe(join(dir, "dep.js"));
+});
+
+test("deleting from require.cache drops the cached resolution", () => {
+  const dir = tempDirWithFiles("require-resolution-cache-delete", {
+    "dep.js": "module.exports = {};",
+    "main.js": "",
+  });
+  const require = createRequire(join(dir, "main.js"));
+
+  const first = require("./dep.js");
+  const before = requireResolutionCacheStats();
+  delete require.cache[join(dir, "dep.js")];
+  expect(requireResolutionCacheStats().size).toBe(before.size - 1);
+
+  // Resolves again and re-evaluates the module.
+  const second = require("./dep.js");
+  expect(second).not.toBe(first);
+  expect(requireResolutionCacheStats().misses - before.misses).toBe(1);
+});
+
+test("failed resolutions are not cached", () => {
+  const dir = tempDirWithFiles("require-resolution-cache-missing", {
+    "main.js": "",
+  });
+  const require = createRequire(join(dir, "main.js"));
+
+  const before = requireResolutionCacheStats();
+  expect(() => require("./missing.js")).toThrow();
+  expect(() => require("./missing.js")).toThrow();
+  const after = requireResolutionCacheStats();
+
+  expect(after.hits - before.hits).toBe(0);
+  expect(after.size).toBe(before.size);
+});
@@ -0,0 +1,6 @@
+function fib(n) {
+  return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+const label = "fib";
+console.log(label, fib(20));
@@ -0,0 +1,40 @@
+import { spawnSync } from "bun";
+import { describe, expect, it } from "bun:test";
+import { bunEnv, bunExe } from "harness";
+import { mkdtempSync, readdirSync, rmSync, statSync } from "fs";
+import { tmpdir } from "os";
+import { join } from "path";
+
+describe("BUN_BYTECODE_CACHE_DIR", () => {
+  it("writes a cache entry and produces the same output when reusing it", () => {
+    const dir = mkdtempSync(join(tmpdir(), "bun-bytecode-cache-"));
+    try {
+      const run = () =>
+        spawnSync({
+          cmd: [bunExe(), join(import.meta.dir, "bytecode-cache-fixture.mjs")],
+          env: { ...bunEnv, BUN_BYTECODE_CACHE_DIR: dir },
+          stdout: "pipe",
+          stderr: "inherit",
+          stdin: "ignore",
+        });
+
+      const first = run();
+      expect(first.stdout.toString()).toBe("fib 6765\n");
+      expect(first.exitCode).toBe(0);
+
+      const entries = readdirSync(dir).filter(name => name.endsWith(".jsc"));
+      expect(entries.length).toBeGreaterThan(0);
+      for (const entry of entries) {
+        expect(statSync(join(dir, entry)).size).toBeGreaterThan(0);
+      }
+
+      for (let i = 0; i < 2; i++) {
+        const next = run();
+        expect(next.stdout.toString()).toBe("fib 6765\n");
+        expect(next.exitCode).toBe(0);
+      }
+    } finally {
+      rmSync(dir, { recursive: true, force: true });
+    }
+  });
+});
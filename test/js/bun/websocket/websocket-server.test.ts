@@ -144,6 +144,56 @@ describe("websocket server", () => {
     done();
   });
 
+  it("can do publishMany()", async () => {
+    var server = serve({
+      port: 0,
+      websocket: {
+        open(ws) {
+          ws.subscribe("a");
+          ws.subscribe("b");
+        },
+        message(ws, msg) {},
+        close(ws) {},
+      },
+      fetch(req, server) {
+        if (server.upgrade(req)) {
+          return;
+        }
+
+        return new Response("success");
+      },
+    });
+
+    const received: string[] = [];
+    await new Promise<void>(resolve => {
+      var socket = new WebSocket(`ws://${server.hostname}:${server.port}`);
+      socket.binaryType = "arraybuffer";
+
+      socket.onmessage = e => {
+        received.push(typeof e.data === "string" ? e.data : new TextDecoder().decode(e.data));
+        if (received.length === 3) {
+          socket.close();
+          resolve();
+        }
+      };
+      socket.onopen = () => {
+        queueMicrotask(() => {
+          expect(
+            server.publishMany([
+              ["a", "one"],
+              ["nobody", "dropped"],
+              ["b", new TextEncoder().encode("two")],
+              ["a", "three"],
+            ]),
+          ).toBe(3);
+        });
+      };
+    });
+    expect(received).toEqual(["one", "two", "three"]);
+    expect(() => server.publishMany([["a"]] as any)).toThrow();
+    server.stop(true);
+  });
+
   it("can do publish() with publishToSelf: false", async done => {
     var server = serve({
       port: 0,
@@ -0,0 +1,15 @@
+// Never imports node:cluster, node:http or node:net, so the runtime has to set
+// the worker up on its own.
+function clusterEnv() {
+  return [process.env.NODE_UNIQUE_ID ?? null, process.env.BUN_CLUSTER_IPC_PATH ?? null];
+}
+
+if (process.argv[2] === "child") {
+  console.log(JSON.stringify(clusterEnv()));
+} else {
+  process.on("message", message => {
+    const child = Bun.spawnSync({ cmd: [process.execPath, import.meta.path, "child"] });
+    process.send({ message, env: clusterEnv(), child: JSON.parse(child.stdout.toString()) });
+    process.disconnect();
+  });
+}
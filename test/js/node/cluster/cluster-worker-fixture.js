@@ -0,0 +1,11 @@
+import http from "node:http";
+
+if (process.env.CRASH_WITH_CODE) {
+  process.exit(Number(process.env.CRASH_WITH_CODE));
+}
+
+http
+  .createServer((req, res) => {
+    res.end(String(process.pid));
+  })
+  .listen(Number(process.env.PORT), "127.0.0.1");
@@ -0,0 +1,112 @@
+import { test, expect, beforeAll } from "bun:test";
+import cluster from "node:cluster";
+import { join } from "node:path";
+
+beforeAll(() => {
+  cluster.setupPrimary({
+    exec: join(import.meta.dir, "cluster-worker-fixture.js"),
+    execArgv: [],
+    args: [],
+  });
+});
+
+function freePort() {
+  const server = Bun.serve({ port: 0, fetch: () => new Response() });
+  const port = server.port;
+  server.stop(true);
+  return port;
+}
+
+function once(emitter, event) {
+  return new Promise(resolve => emitter.once(event, (...args) => resolve(args)));
+}
+
+// The kernel only balances SO_REUSEPORT sockets across processes on Linux.
+test.skipIf(process.platform !== "linux")("requests reach every worker", async () => {
+  const port = freePort();
+  const workers = [cluster.fork({ PORT: port }), cluster.fork({ PORT: port })];
+  const exited = workers.map(worker => once(worker, "exit"));
+
+  await Promise.all(workers.map(worker => once(worker, "listening")));
+  for (const worker of workers) {
+    expect(worker.isConnected()).toBe(true);
+    expect(cluster.workers[worker.id]).toBe(worker);
+  }
+
+  const seen = new Set();
+  for (let i = 0; i < 200 && seen.size < workers.length; i++) {
+    const response = await fetch(`http://127.0.0.1:${port}/`, { keepalive: false });
+    seen.add(Number(await response.text()));
+  }
+  expect([...seen].sort()).toEqual(workers.map(worker => worker.process.pid).sort());
+
+  await new Promise(resolve => cluster.disconnect(resolve));
+  for (const [code, signal] of await Promise.all(exited)) {
+    expect(code).toBe(0);
+    expect(signal).toBeNull();
+  }
+  for (const worker of workers) {
+    expect(worker.exitedAfterDisconnect).toBe(true);
+    expect(worker.isDead()).toBe(true);
+    expect(cluster.workers[worker.id]).toBeUndefined();
+  }
+}, 30000);
+
+test("a crashing worker is reported", async () => {
+  const events = [];
+  const onExit = (worker, code) => events.push([worker.id, code]);
+  cluster.on("exit", onExit);
+
+  try {
+    const worker = cluster.fork({ CRASH_WITH_CODE: "3" });
+    const [code, signal] = await once(worker, "exit");
+
+    expect(code).toBe(3);
+    expect(signal).toBeNull();
+    expect(worker.exitedAfterDisconnect).toBeUndefined();
+    expect(worker.isDead()).toBe(true);
+    expect(events).toEqual([[worker.id, 3]]);
+  } finally {
+    cluster.off("exit", onExit);
+  }
+});
+
+test("workers connect without importing node:cluster and don't pass it on", async () => {
+  cluster.setupPrimary({ exec: join(import.meta.dir, "cluster-message-fixture.js") });
+
+  try {
+    const worker = cluster.fork();
+    const exited = once(worker, "exit");
+    await once(worker, "online");
+
+    worker.send("ping");
+    const [reply] = await once(worker, "message");
+    expect(reply).toEqual({ message: "ping", env: [null, null], child: [null, null] });
+    expect((await exited)[0]).toBe(0);
+  } finally {
+    cluster.setupPrimary({ exec: join(import.meta.dir, "cluster-worker-fixture.js") });
+  }
+});
+
+test("round-robin scheduling is rejected instead of ignored", () => {
+  const policy = cluster.schedulingPolicy;
+  expect(policy).toBe(cluster.SCHED_NONE);
+
+  try {
+    cluster.schedulingPolicy = cluster.SCHED_RR;
+    expect(() => cluster.fork()).toThrow("cluster.SCHED_RR is not yet implemented");
+    expect(() => cluster.setupPrimary({ schedulingPolicy: 42 })).toThrow("Invalid cluster.schedulingPolicy: 42");
+    expect(Object.keys(cluster.workers)).toHaveLength(0);
+  } finally {
+    cluster.setupPrimary({ schedulingPolicy: policy });
+  }
+});
+
+test("NODE_UNIQUE_ID without a primary to connect to doesn't start a worker", () => {
+  const { exitCode, stdout } = Bun.spawnSync({
+    cmd: [process.execPath, join(import.meta.dir, "cluster-message-fixture.js"), "child"],
+    env: { ...process.env, NODE_UNIQUE_ID: "1" },
+  });
+  expect(JSON.parse(stdout.toString())).toEqual(["1", null]);
+  expect(exitCode).toBe(0);
+});
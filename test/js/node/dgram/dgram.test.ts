@@ -0,0 +1,118 @@
+import { test, expect } from "bun:test";
+import dgram from "node:dgram";
+
+function once(emitter, event) {
+  return new Promise(resolve => emitter.once(event, (...args) => resolve(args)));
+}
+
+async function bound(type = "udp4") {
+  const socket = dgram.createSocket(type);
+  socket.bind(0, type === "udp4" ? "127.0.0.1" : "::1");
+  await once(socket, "listening");
+  return socket;
+}
+
+test("sends and receives a datagram over loopback", async () => {
+  const server = await bound();
+  const client = dgram.createSocket("udp4");
+  const { port } = server.address();
+
+  const received = once(server, "message");
+  const sent = new Promise((resolve, reject) =>
+    client.send("hello", port, "127.0.0.1", (err, bytes) => (err ? reject(err) : resolve(bytes))),
+  );
+
+  expect(await sent).toBe(5);
+  const [message, rinfo] = await received;
+  expect(message).toBeInstanceOf(Buffer);
+  expect(message.toString()).toBe("hello");
+  expect(rinfo).toEqual({ address: "127.0.0.1", family: "IPv4", port: client.address().port, size: 5 });
+
+  client.close();
+  server.close();
+});
+
+test("address() throws before the socket is bound", () => {
+  const socket = dgram.createSocket("udp4");
+  expect(() => socket.address()).toThrow(expect.objectContaining({ code: "ERR_SOCKET_DGRAM_NOT_RUNNING" }));
+  socket.close();
+});
+
+test("connected sockets send without a destination", async () => {
+  const server = await bound();
+  const client = dgram.createSocket("udp4");
+  const { port } = server.address();
+
+  expect(() => client.remoteAddress()).toThrow(expect.objectContaining({ code: "ERR_SOCKET_DGRAM_NOT_CONNECTED" }));
+  client.connect(port, "127.0.0.1");
+  await once(client, "connect");
+  expect(client.remoteAddress()).toEqual({ address: "127.0.0.1", family: "IPv4", port });
+  expect(() => client.send("x", port, "127.0.0.1")).toThrow(
+    expect.objectContaining({ code: "ERR_SOCKET_DGRAM_IS_CONNECTED" }),
+  );
+
+  const received = once(server, "message");
+  client.send(Buffer.from("connected"));
+  const [message] = await received;
+  expect(message.toString()).toBe("connected");
+
+  client.disconnect();
+  expect(() => client.remoteAddress()).toThrow(expect.objectContaining({ code: "ERR_SOCKET_DGRAM_NOT_CONNECTED" }));
+  client.close();
+  server.close();
+});
+
+test("many sends in one tick all arrive", async () => {
+  const server = await bound();
+  const client = dgram.createSocket("udp4");
+  const { port } = server.address();
+  const count = 100;
+
+  const seen = new Set();
+  const done = new Promise(resolve =>
+    server.on("message", message => {
+      seen.add(message.toString());
+      if (seen.size === count) resolve();
+    }),
+  );
+
+  // Sends made in the same tick are flushed together on the next one.
+  for (let i = 0; i < count; i++) client.send(`packet ${i}`, port, "127.0.0.1");
+  expect(client.getSendQueueCount()).toBe(count);
+  await done;
+  expect(seen.size).toBe(count);
+  expect(client.getSendQueueCount()).toBe(0);
+
+  client.close();
+  server.close();
+});
+
+test("works over IPv6", async () => {
+  const server = await bound("udp6");
+  const client = dgram.createSocket("udp6");
+
+  const received = once(server, "message");
+  client.send(["hello ", "ipv6"], server.address().port, "::1");
+  const [message, rinfo] = await received;
+  expect(message.toString()).toBe("hello ipv6");
+  expect(rinfo.family).toBe("IPv6");
+  expect(rinfo.address).toBe("::1");
+
+  client.close();
+  server.close();
+});
+
+test("close() emits 'close' and further calls throw", async () => {
+  const socket = await bound();
+  const closed = once(socket, "close");
+  socket.close();
+  await closed;
+  expect(() => socket.close()).toThrow(expect.objectContaining({ code: "ERR_SOCKET_DGRAM_NOT_RUNNING" }));
+  expect(() => socket.send("x", 1234, "127.0.0.1")).toThrow(
+    expect.objectContaining({ code: "ERR_SOCKET_DGRAM_NOT_RUNNING" }),
+  );
+});
+
+test("rejects unknown socket types", () => {
+  expect(() => dgram.createSocket("udp5")).toThrow(expect.objectContaining({ code: "ERR_SOCKET_BAD_TYPE" }));
+});
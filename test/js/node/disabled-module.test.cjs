@@ -1,6 +1,6 @@
-test("not implemented yet module masquerades as undefined in cjs and throws an error", () => {
+test("worker_threads can be required from cjs", () => {
   const worker_threads = require("worker_threads");
 
-  expect(typeof worker_threads).toBe("undefined");
-  expect(typeof worker_threads.getEnvironmentData).toBe("undefined");
+  expect(worker_threads.isMainThread).toBe(true);
+  expect(typeof worker_threads.Worker).toBe("function");
 });
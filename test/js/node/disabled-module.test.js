@@ -3,11 +3,10 @@ import { AsyncResource, AsyncLocalStorage } from "async_hooks";
 import * as worker_threads from "worker_threads";
 import worker_threads_default from "worker_threads";
 
-test("not implemented yet module masquerades as undefined and throws an error", () => {
-  expect(typeof worker_threads.default).toBe("undefined");
-  expect(typeof worker_threads_default).toBe("undefined");
-  expect(typeof worker_threads.getEnvironmentData).toBe("undefined");
-  expect(typeof worker_threads_default.getEnvironmentData).toBe("undefined");
+test("worker_threads named and default exports agree", () => {
+  expect(worker_threads.default).toBe(worker_threads_default);
+  expect(worker_threads.getEnvironmentData).toBe(worker_threads_default.getEnvironmentData);
+  expect(worker_threads.isMainThread).toBe(true);
 });
 
 test("AsyncLocalStorage polyfill", () => {
@@ -1,4 +1,4 @@
-import { it } from "bun:test";
+import { expect, it } from "bun:test";
 
 it("process.nextTick", async () => {
   // You can verify this test is correct by copy pasting this into a browser's console and checking it doesn't throw an error.
@@ -97,3 +97,70 @@ it("process.nextTick 5 args", async () => {
     }, ...args);
   });
 });
+
+it("process.nextTick runs queued ticks before promise jobs", async () => {
+  const order = [];
+  await new Promise(resolve => {
+    process.nextTick(() => order.push("tick 1"));
+    Promise.resolve().then(() => order.push("promise"));
+    process.nextTick(() => {
+      order.push("tick 2");
+      process.nextTick(() => order.push("tick 3"));
+    });
+    setTimeout(resolve, 0);
+  });
+  expect(order).toEqual(["tick 1", "tick 2", "tick 3", "promise"]);
+});
+
+it("process.nextTick runs before promise jobs queued ahead of it", async () => {
+  const order = [];
+  await new Promise(resolve => {
+    setTimeout(() => {
+      Promise.resolve().then(() => order.push("promise"));
+      process.nextTick(() => order.push("tick"));
+      setTimeout(resolve, 0);
+    }, 0);
+  });
+  expect(order).toEqual(["tick", "promise"]);
+});
+
+it("process.nextTick queued by a promise job runs after the other promise jobs", async () => {
+  const order = [];
+  await new Promise(resolve => {
+    setTimeout(() => {
+      Promise.resolve().then(() => {
+        order.push("promise 1");
+        process.nextTick(() => order.push("tick"));
+      });
+      Promise.resolve().then(() => order.push("promise 2"));
+      setTimeout(resolve, 0);
+    }, 0);
+  });
+  expect(order).toEqual(["promise 1", "promise 2", "tick"]);
+});
+
+it("process.nextTick queue depth is tracked", async () => {
+  const { nextTickQueueStats } = require("bun:jsc");
+  for (let i = 0; i < 100; i++) process.nextTick(() => {}, i, i, i, i, i);
+  expect(nextTickQueueStats().depth).toBe(100);
+  expect(nextTickQueueStats().peakDepth).toBeGreaterThanOrEqual(100);
+  await new Promise(resolve => process.nextTick(resolve));
+  expect(nextTickQueueStats().depth).toBe(0);
+});
+
+it("process.nextTick releases ticks that already ran", async () => {
+  const { heapStats } = require("bun:jsc");
+  const total = 20000;
+  const live = await new Promise(resolve => {
+    let remaining = total;
+    process.nextTick(function tick() {
+      if (--remaining === 0) {
+        Bun.gc(true);
+        resolve(heapStats().objectTypeCounts.Headers ?? 0);
+        return;
+      }
+      process.nextTick(tick, new Headers());
+    }, new Headers());
+  });
+  expect(live).toBeLessThan(total / 2);
+});
@@ -42,6 +42,67 @@ describe("Script", () => {
       return script.runInThisContext(context);
     });
   });
+  describe("cachedData", () => {
+    const code = "function add(a, b) { return a + b; } add(40, 2);";
+
+    test("createCachedData() returns a non-empty Buffer", () => {
+      const script = new Script(code);
+      const data = script.createCachedData();
+      expect(data).toBeInstanceOf(Buffer);
+      expect(data.length).toBeGreaterThan(0);
+      expect(script.cachedDataRejected).toBeUndefined();
+    });
+    test("accepts cached data for the same source", () => {
+      const cachedData = new Script(code).createCachedData();
+      const script = new Script(code, { cachedData });
+      expect(script.cachedDataRejected).toBe(false);
+      expect(script.runInThisContext()).toBe(42);
+      expect(script.runInContext(createContext({}))).toBe(42);
+    });
+    test("rejects cached data for a different source", () => {
+      const cachedData = new Script(code).createCachedData();
+      const script = new Script("1 + 1", { cachedData });
+      expect(script.cachedDataRejected).toBe(true);
+      expect(script.runInThisContext()).toBe(2);
+    });
+    test("rejects garbage", () => {
+      const script = new Script(code, { cachedData: Buffer.from("not bytecode") });
+      expect(script.cachedDataRejected).toBe(true);
+      expect(script.runInThisContext()).toBe(42);
+    });
+    test("produceCachedData sets script.cachedData", () => {
+      // @ts-expect-error
+      const script = new Script(code, { produceCachedData: true });
+      // @ts-expect-error
+      expect(script.cachedDataProduced).toBe(true);
+      expect(new Script(code, { cachedData: script.cachedData }).cachedDataRejected).toBe(false);
+    });
+    test("runs an accepted script with let and var like an uncached one", () => {
+      const code = "var count = (typeof count === 'number' ? count : 0) + 1; let doubled = count * 2; doubled";
+      const cached = new Script(code, { cachedData: new Script(code).createCachedData() });
+      expect(cached.cachedDataRejected).toBe(false);
+      const uncached = new Script(code);
+      const cachedContext = createContext({});
+      const uncachedContext = createContext({});
+      for (let i = 0; i < 3; i++) {
+        expect(cached.runInContext(cachedContext)).toBe(uncached.runInContext(uncachedContext));
+      }
+      expect(cachedContext.count).toBe(uncachedContext.count);
+      expect("doubled" in cachedContext).toBe("doubled" in uncachedContext);
+    });
+    test("re-runs an accepted script that declares let in a context", () => {
+      const code = "let value = 1; value";
+      const script = new Script(code, { cachedData: new Script(code).createCachedData() });
+      const context = createContext({});
+      expect(script.runInContext(context)).toBe(1);
+      expect(script.runInContext(context)).toBe(1);
+      expect("value" in context).toBe(false);
+    });
+    test("throws on invalid cachedData", () => {
+      // @ts-expect-error
+      expect(() => new Script(code, { cachedData: "nope" })).toThrow(TypeError);
+    });
+  });
 });
 
 function testRunInContext(
@@ -0,0 +1,40 @@
+import { parentPort, workerData, isMainThread, threadId } from "node:worker_threads";
+
+switch (workerData?.mode) {
+  case "echo":
+    parentPort.postMessage({ isMainThread, threadId, workerData });
+    parentPort.on("message", message => {
+      if (message === "close") {
+        parentPort.close();
+        return;
+      }
+      parentPort.postMessage(message, message instanceof ArrayBuffer ? [message] : []);
+    });
+    break;
+
+  case "atomics": {
+    const counter = new Int32Array(workerData.buffer);
+    for (let i = 0; i < workerData.iterations; i++) Atomics.add(counter, 0, 1);
+    Atomics.store(counter, 1, 1);
+    Atomics.notify(counter, 1);
+    break;
+  }
+
+  case "exit":
+    process.exit(workerData.code);
+    break;
+
+  case "exit-in-tick": {
+    const flag = new Int32Array(workerData.buffer);
+    process.nextTick(() => process.exit(workerData.code));
+    process.nextTick(() => Atomics.store(flag, 0, 1));
+    break;
+  }
+
+  case "throw":
+    throw new Error("boom from worker");
+
+  case "spin":
+    parentPort.postMessage("spinning");
+    while (true) {}
+}
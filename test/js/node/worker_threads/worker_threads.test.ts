@@ -0,0 +1,167 @@
+import { test, expect, describe } from "bun:test";
+import { Worker, MessageChannel, receiveMessageOnPort, isMainThread, threadId, parentPort } from "node:worker_threads";
+import { join } from "node:path";
+
+const fixture = join(import.meta.dir, "worker-fixture.js");
+
+function once(emitter, event) {
+  return new Promise(resolve => emitter.once(event, (...args) => resolve(args)));
+}
+
+test("main thread", () => {
+  expect(isMainThread).toBe(true);
+  expect(threadId).toBe(0);
+  expect(parentPort).toBeNull();
+});
+
+test("workerData and messages round trip", async () => {
+  const worker = new Worker(fixture, { workerData: { mode: "echo", list: [1, 2, 3] } });
+  const [hello] = await once(worker, "message");
+  expect(hello.isMainThread).toBe(false);
+  expect(hello.threadId).toBe(worker.threadId);
+  expect(hello.workerData).toEqual({ mode: "echo", list: [1, 2, 3] });
+
+  const payload = { date: new Date(0), map: new Map([[1, "a"]]), set: new Set(["b"]), big: 10n };
+  worker.postMessage(payload);
+  const [echoed] = await once(worker, "message");
+  expect(echoed).toEqual(payload);
+  expect(echoed.date).toBeInstanceOf(Date);
+
+  const exited = once(worker, "exit");
+  worker.postMessage("close");
+  expect(await exited).toEqual([0]);
+});
+
+test("transferred ArrayBuffers are detached", async () => {
+  const worker = new Worker(fixture, { workerData: { mode: "echo" } });
+  await once(worker, "message");
+
+  const buffer = new Uint8Array([1, 2, 3]).buffer;
+  worker.postMessage(buffer, [buffer]);
+  expect(buffer.byteLength).toBe(0);
+  const [echoed] = await once(worker, "message");
+  expect([...new Uint8Array(echoed)]).toEqual([1, 2, 3]);
+
+  await worker.terminate();
+});
+
+test("SharedArrayBuffer is shared with the worker", async () => {
+  const buffer = new SharedArrayBuffer(8);
+  const worker = new Worker(fixture, { workerData: { mode: "atomics", buffer, iterations: 1000 } });
+  expect(await once(worker, "exit")).toEqual([0]);
+  const counter = new Int32Array(buffer);
+  expect(Atomics.load(counter, 0)).toBe(1000);
+  expect(Atomics.load(counter, 1)).toBe(1);
+});
+
+test("process.exit() inside a worker only stops the worker", async () => {
+  const worker = new Worker(fixture, { workerData: { mode: "exit", code: 42 } });
+  expect(await once(worker, "exit")).toEqual([42]);
+});
+
+test("process.exit() in a nextTick stops the remaining ticks", async () => {
+  const buffer = new SharedArrayBuffer(4);
+  const worker = new Worker(fixture, { workerData: { mode: "exit-in-tick", code: 7, buffer } });
+  expect(await once(worker, "exit")).toEqual([7]);
+  expect(Atomics.load(new Int32Array(buffer), 0)).toBe(0);
+});
+
+test("uncaught errors are reported on the worker", async () => {
+  const worker = new Worker(fixture, { workerData: { mode: "throw" } });
+  const exited = once(worker, "exit");
+  const [error] = await once(worker, "error");
+  expect(error.message).toBe("boom from worker");
+  expect(await exited).toEqual([1]);
+});
+
+test("terminate() stops a busy worker", async () => {
+  const worker = new Worker(fixture, { workerData: { mode: "spin" } });
+  await once(worker, "message");
+  expect(await worker.terminate()).toBe(1);
+});
+
+test("relative paths must start with ./ or ../", () => {
+  expect(() => new Worker("worker-fixture.js")).toThrow(expect.objectContaining({ code: "ERR_WORKER_PATH" }));
+});
+
+describe("MessageChannel", () => {
+  test("delivers messages in order", async () => {
+    const { port1, port2 } = new MessageChannel();
+    const received = [];
+    const done = new Promise(resolve =>
+      port2.on("message", message => {
+        received.push(message);
+        if (received.length === 3) resolve();
+      }),
+    );
+    port1.postMessage(1);
+    port1.postMessage({ two: 2 });
+    port1.postMessage([3]);
+    await done;
+    expect(received).toEqual([1, { two: 2 }, [3]]);
+    port1.close();
+  });
+
+  test("receiveMessageOnPort reads synchronously", () => {
+    const { port1, port2 } = new MessageChannel();
+    port1.postMessage("hi");
+    expect(receiveMessageOnPort(port2)).toEqual({ message: "hi" });
+    expect(receiveMessageOnPort(port2)).toBeUndefined();
+    port1.close();
+  });
+
+  test("ports can be transferred", () => {
+    const { port1, port2 } = new MessageChannel();
+    const inner = new MessageChannel();
+    port1.postMessage({ port: inner.port1 }, [inner.port1]);
+    const { message } = receiveMessageOnPort(port2);
+    message.port.postMessage("through");
+    expect(receiveMessageOnPort(inner.port2)).toEqual({ message: "through" });
+    port1.close();
+    inner.port2.close();
+  });
+
+  test("transferring the sending port throws DataCloneError", () => {
+    const { port1 } = new MessageChannel();
+    expect(() => port1.postMessage(port1, [port1])).toThrow(expect.objectContaining({ name: "DataCloneError" }));
+    port1.close();
+  });
+
+  test("closing one side emits close on both", async () => {
+    const { port1, port2 } = new MessageChannel();
+    const closed = Promise.all([once(port1, "close"), once(port2, "close")]);
+    port1.close();
+    await closed;
+  });
+});
+
+describe("structuredClone", () => {
+  test("preserves cycles and shared references", () => {
+    const shared = { value: 1 };
+    const input = { a: shared, b: shared };
+    input.self = input;
+    const output = structuredClone(input);
+    expect(output).not.toBe(input);
+    expect(output.self).toBe(output);
+    expect(output.a).toBe(output.b);
+  });
+
+  test("clones errors and typed arrays", () => {
+    const error = structuredClone(new RangeError("bad"));
+    expect(error).toBeInstanceOf(RangeError);
+    expect(error.message).toBe("bad");
+    expect(structuredClone(new Float64Array([1.5, 2.5]))).toEqual(new Float64Array([1.5, 2.5]));
+  });
+
+  test("rejects functions and symbols", () => {
+    expect(() => structuredClone(() => {})).toThrow(expect.objectContaining({ name: "DataCloneError" }));
+    expect(() => structuredClone(Symbol("s"))).toThrow(expect.objectContaining({ name: "DataCloneError" }));
+  });
+
+  test("transfer detaches the source", () => {
+    const buffer = new ArrayBuffer(4);
+    const copy = structuredClone(buffer, { transfer: [buffer] });
+    expect(buffer.byteLength).toBe(0);
+    expect(copy.byteLength).toBe(4);
+  });
+});
@@ -37,3 +37,68 @@ describe("zlib.gunzip", () => {
     });
   });
 });
+
+describe("zlib streams", () => {
+  const input = buffer.Buffer.from("The quick brown fox jumps over the lazy dog. ".repeat(2000));
+
+  it("round-trips every format synchronously", () => {
+    expect(zlib.inflateSync(zlib.deflateSync(input))).toEqual(input);
+    expect(zlib.gunzipSync(zlib.gzipSync(input))).toEqual(input);
+    expect(zlib.inflateRawSync(zlib.deflateRawSync(input))).toEqual(input);
+    expect(zlib.unzipSync(zlib.gzipSync(input))).toEqual(input);
+    expect(zlib.unzipSync(zlib.deflateSync(input))).toEqual(input);
+  });
+
+  it("decompresses concatenated gzip members", () => {
+    const first = buffer.Buffer.from("hello ");
+    const second = buffer.Buffer.from("world");
+    const joined = buffer.Buffer.concat([zlib.gzipSync(first), zlib.gzipSync(second)]);
+    expect(zlib.gunzipSync(joined).toString()).toBe("hello world");
+  });
+
+  it("uses the dictionary", () => {
+    const dictionary = buffer.Buffer.from("quick brown fox lazy dog");
+    const compressed = zlib.deflateSync(input, { dictionary });
+    expect(zlib.inflateSync(compressed, { dictionary })).toEqual(input);
+    expect(() => zlib.inflateSync(compressed)).toThrow("Missing dictionary");
+  });
+
+  it("compresses a stream written in many chunks", async () => {
+    const gzip = zlib.createGzip();
+    const chunks = [];
+    const done = new Promise((resolve, reject) => {
+      gzip.on("data", chunk => chunks.push(chunk));
+      gzip.on("end", resolve);
+      gzip.on("error", reject);
+    });
+    for (let offset = 0; offset < input.length; offset += 1000) {
+      gzip.write(input.subarray(offset, offset + 1000));
+    }
+    gzip.end();
+    await done;
+
+    expect(zlib.gunzipSync(buffer.Buffer.concat(chunks))).toEqual(input);
+  });
+
+  it("reports corrupt input to the callback", async () => {
+    const corrupt = zlib.gzipSync(input);
+    corrupt[20] ^= 0xff;
+    const error = await new Promise(resolve => zlib.gunzip(corrupt, resolve));
+    expect(error).toBeInstanceOf(Error);
+    expect(error.code).toBe("Z_DATA_ERROR");
+  });
+
+  it("changes parameters mid-stream", async () => {
+    const deflate = zlib.createDeflate({ level: 1 });
+    const chunks = [];
+    deflate.on("data", chunk => chunks.push(chunk));
+    const ended = new Promise(resolve => deflate.on("end", resolve));
+
+    deflate.write(input.subarray(0, input.length / 2));
+    await new Promise(resolve => deflate.params(9, zlib.constants.Z_DEFAULT_STRATEGY, resolve));
+    deflate.end(input.subarray(input.length / 2));
+    await ended;
+
+    expect(zlib.inflateSync(buffer.Buffer.concat(chunks))).toEqual(input);
+  });
+});
@@ -71,6 +71,90 @@ describe("Web Crypto", () => {
     const isSigValid = await verifySignature(msg, signature, SECRET);
     expect(isSigValid).toBe(true);
   });
+
+  it("should return a separate ArrayBuffer for each result", async () => {
+    const key = await crypto.subtle.generateKey({ name: "AES-GCM", length: 256 }, false, ["encrypt", "decrypt"]);
+    const iv = new Uint8Array(12);
+    const data = new Uint8Array(4 * 1024 * 1024).fill(7);
+    const [first, second] = await Promise.all([
+      crypto.subtle.encrypt({ name: "AES-GCM", iv }, key, data),
+      crypto.subtle.encrypt({ name: "AES-GCM", iv }, key, data),
+    ]);
+    expect(first).not.toBe(second);
+    expect(first.byteLength).toBe(data.byteLength + 16);
+    new Uint8Array(first).fill(0);
+    const decrypted = await crypto.subtle.decrypt({ name: "AES-GCM", iv }, key, second);
+    expect(new Uint8Array(decrypted)).toEqual(data);
+
+    const empty = await crypto.subtle.digest("SHA-256", new Uint8Array(0));
+    expect(Buffer.from(empty).toString("hex")).toBe("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  });
+
+  it("should reuse an HMAC key for small and large messages", async () => {
+    const key = await crypto.subtle.importKey(
+      "raw",
+      new TextEncoder().encode("secret"),
+      { name: "HMAC", hash: "SHA-256" },
+      false,
+      ["sign", "verify"],
+    );
+    for (const size of [0, 64, 16 * 1024, 16 * 1024 + 1, 1024 * 1024]) {
+      const data = new Uint8Array(size).fill(42);
+      const first = await crypto.subtle.sign("HMAC", key, data);
+      const second = await crypto.subtle.sign("HMAC", key, data);
+      expect(new Uint8Array(first)).toEqual(new Uint8Array(second));
+      expect(await crypto.subtle.verify("HMAC", key, first, data)).toBe(true);
+      const tampered = new Uint8Array(first);
+      tampered[0] ^= 1;
+      expect(await crypto.subtle.verify("HMAC", key, tampered, data)).toBe(false);
+    }
+
+    // RFC 4231 test case 2
+    const rfcKey = await crypto.subtle.importKey(
+      "raw",
+      new TextEncoder().encode("Jefe"),
+      { name: "HMAC", hash: "SHA-256" },
+      false,
+      ["sign"],
+    );
+    const signature = await crypto.subtle.sign("HMAC", rfcKey, new TextEncoder().encode("what do ya want for nothing?"));
+    expect(Buffer.from(signature).toString("hex")).toBe(
+      "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843",
+    );
+  });
+
+  it("digestMany matches digest", async () => {
+    const inputs = Array.from({ length: 2000 }, (_, i) => new TextEncoder().encode(`object ${i}`.repeat(i % 50)));
+    inputs.push(new Uint8Array(256 * 1024).fill(1).subarray(1));
+    for (const algorithm of ["SHA-1", "SHA-256", "SHA-384", "SHA-512"]) {
+      const digests = await crypto.subtle.digestMany(algorithm, inputs);
+      expect(digests).toHaveLength(inputs.length);
+      for (const i of [0, 1, 999, 1999, 2000]) {
+        expect(new Uint8Array(digests[i])).toEqual(new Uint8Array(await crypto.subtle.digest(algorithm, inputs[i])));
+      }
+    }
+    expect(await crypto.subtle.digestMany("SHA-256", [])).toEqual([]);
+    expect(await crypto.subtle.digestMany("AES-GCM", [new Uint8Array(1)]).catch(e => e)).toBeInstanceOf(Error);
+  });
+
+  it("should run many operations concurrently", async () => {
+    const { publicKey, privateKey } = await crypto.subtle.generateKey(
+      { name: "ECDSA", namedCurve: "P-256" },
+      false,
+      ["sign", "verify"],
+    );
+    const algorithm = { name: "ECDSA", hash: "SHA-256" };
+    const messages = Array.from({ length: 256 }, (_, i) => new TextEncoder().encode(`message ${i}`));
+    const signatures = await Promise.all(messages.map(message => crypto.subtle.sign(algorithm, privateKey, message)));
+    const results = await Promise.all(
+      messages.map((message, i) => crypto.subtle.verify(algorithm, publicKey, signatures[(i + 1) % 256], message)),
+    );
+    expect(results.every(result => result === false)).toBe(true);
+    const valid = await Promise.all(
+      messages.map((message, i) => crypto.subtle.verify(algorithm, publicKey, signatures[i], message)),
+    );
+    expect(valid.every(result => result === true)).toBe(true);
+  });
 });
 
 describe("Ed25519", () => {
@@ -277,3 +277,25 @@ it("setTimeout should not refresh after clearTimeout", done => {
     done();
   }, 100);
 });
+
+it("setTimeout runs timers with the same deadline in creation order", async () => {
+  const order = [];
+  await new Promise(resolve => {
+    for (let i = 0; i < 1000; i++) {
+      setTimeout(() => {
+        order.push(i);
+        if (i === 999) resolve();
+      }, 5);
+    }
+  });
+  expect(order).toEqual(Array.from({ length: 1000 }, (_, i) => i));
+});
+
+it("setTimeout still fires after many timers were cleared", async () => {
+  for (let i = 0; i < 100_000; i++) {
+    clearTimeout(setTimeout(() => expect(false).toBe(true), 1));
+  }
+  const start = performance.now();
+  await new Promise(resolve => setTimeout(resolve, 10));
+  expect(performance.now() - start).toBeGreaterThanOrEqual(9);
+});